@@ -0,0 +1,558 @@
+/*
+ * ConjugateGradient.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#include "ConjugateGradient.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+ConjugateGradient::ConjugateGradient(void)
+{
+    this->cPreconditioner = ConjugateGradient::cPrecondIC;
+    this->dTolerance = 1.0E-12;
+    this->clear();
+}
+
+ConjugateGradient::~ConjugateGradient(void)
+{
+    this->clear();
+}
+
+void ConjugateGradient::clear(void)
+{
+    this->iSize = 0;
+    this->vectRowPtr.clear();
+    this->vectCols.clear();
+    this->vectValues.clear();
+    this->vectFactor.clear();
+    this->vectPivotInverse.clear();
+
+    this->dShift = 0.0;
+    this->dMatrixNorm = 0.0;
+    this->vectCaseIterations.clear();
+    this->vectCaseResidual.clear();
+}
+
+void ConjugateGradient::setPreconditioner(char cNewPreconditioner)
+{
+    this->cPreconditioner = cNewPreconditioner;
+}
+
+char ConjugateGradient::getPreconditioner(void)
+{
+    return this->cPreconditioner;
+}
+
+void ConjugateGradient::setTolerance(double dNewTolerance)
+{
+    this->dTolerance = dNewTolerance;
+}
+
+double ConjugateGradient::getTolerance(void)
+{
+    return this->dTolerance;
+}
+
+//***************************************************************************
+//*
+//* ConjugateGradient::analyze
+//*     This function finds the nonzero structure of the matrix's lower
+//*     triangle from the given matrix size and members.  The member DoF
+//*     indices (1 based, 0 = FIXED) are the matrix equations.  The entries
+//*     are allocated and cleared to 0 ready for add().
+//*
+//***************************************************************************
+
+bool ConjugateGradient::analyze(int iMatrixSize, std::vector<Member *> & members)
+{
+    this->clear();
+    this->iSize = iMatrixSize;
+
+    // Lower adjacency of each equation...
+    std::vector<std::vector<int>> vectLower(this->iSize);
+    for (Member * memberCurr : members)
+    {
+        int aiPositionIndex[6];
+        aiPositionIndex[0] = memberCurr->nodeNeg->iHorzFlag;
+        aiPositionIndex[1] = memberCurr->nodeNeg->iVertFlag;
+        aiPositionIndex[2] = memberCurr->nodeNeg->iRotFlag;
+        aiPositionIndex[3] = memberCurr->nodePos->iHorzFlag;
+        aiPositionIndex[4] = memberCurr->nodePos->iVertFlag;
+        aiPositionIndex[5] = memberCurr->nodePos->iRotFlag;
+
+        for (short int siIndex1 = 0; siIndex1 < 6; siIndex1++)
+        {
+            if ( ! aiPositionIndex[siIndex1] ) // ...element is FIXED...
+                continue;
+            for (short int siIndex2 = 0; siIndex2 < 6; siIndex2++)
+            {
+                if ( ! aiPositionIndex[siIndex2] ) // ...element is FIXED...
+                    continue;
+                if (aiPositionIndex[siIndex2] < aiPositionIndex[siIndex1])
+                    vectLower[ aiPositionIndex[siIndex1] - 1 ].push_back( aiPositionIndex[siIndex2] - 1 );
+            }
+        }
+    }
+
+    // Compressed rows, each ending with its diagonal...
+    this->vectRowPtr.assign(this->iSize + 1, 0);
+    for (int iRow = 0; iRow < this->iSize; iRow++)
+    {
+        std::vector<int> & vectRow = vectLower[iRow];
+        std::sort( vectRow.begin(), vectRow.end() );
+        vectRow.erase( std::unique( vectRow.begin(), vectRow.end() ), vectRow.end() );
+        this->vectRowPtr[iRow + 1] = this->vectRowPtr[iRow] + (int) vectRow.size() + 1;
+    }
+    this->vectCols.resize( this->vectRowPtr[this->iSize] );
+    for (int iRow = 0; iRow < this->iSize; iRow++)
+    {
+        int * aiCols = this->vectCols.data() + this->vectRowPtr[iRow];
+        for (int iCol : vectLower[iRow])
+            *aiCols++ = iCol;
+        *aiCols = iRow;
+    }
+
+    this->vectValues.assign( this->vectRowPtr[this->iSize], 0.0 );
+    this->vectPivotInverse.assign(this->iSize, 0.0);
+
+    return true;
+}
+
+//*
+//* End of ConjugateGradient::analyze
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* ConjugateGradient::add
+//*     This function adds a value to the matrix at the given (0 based)
+//*     row and column.  Only one of each symmetric pair is added.
+//*
+//***************************************************************************
+
+void ConjugateGradient::add(int iRow, int iCol, double dValue)
+{
+    if (iRow < iCol)
+        std::swap(iRow, iCol);
+
+    const int * aiCols = this->vectCols.data();
+    int iPos = (int) ( std::lower_bound( aiCols + this->vectRowPtr[iRow],
+                                         aiCols + this->vectRowPtr[iRow + 1],
+                                         iCol ) - aiCols );
+    this->vectValues[iPos] += dValue;
+}
+
+//*
+//* End of ConjugateGradient::add
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* ConjugateGradient::precondition
+//*     This function sets up the preconditioner of the assembled matrix.
+//*     An IC(0) factor may break down (a pivot at or below 0) even for a
+//*     positive definite matrix, so the diagonal is then shifted up and
+//*     the factor retried (Manteuffel).  The matrix norm (the greatest row
+//*     sum of the full matrix's magnitudes) is found for the scaled
+//*     residuals.
+//*
+//***************************************************************************
+
+bool ConjugateGradient::precondition(void)
+{
+    // Every equation needs stiffness...
+    for (int iRow = 0; iRow < this->iSize; iRow++)
+    {
+        double dDiagonal = this->vectValues[ this->vectRowPtr[iRow + 1] - 1 ];
+        if (dDiagonal <= 0.0)
+        {
+            std::cerr << "\n WARNING: Stiffness Matrix is SINGULAR!\n"
+                      <<   "          Unable to find solution for Plane Frame!\n";
+            return false;
+        }
+        this->vectPivotInverse[iRow] = 1.0 / dDiagonal;
+    }
+
+    // Each lower entry also sums into its column's row...
+    std::vector<double> vectRowSum(this->iSize, 0.0);
+    for (int iRow = 0; iRow < this->iSize; iRow++)
+    {
+        for (int iEntry = this->vectRowPtr[iRow]; iEntry < this->vectRowPtr[iRow + 1]; iEntry++)
+        {
+            int iCol = this->vectCols[iEntry];
+            double dValue = std::fabs(this->vectValues[iEntry]);
+            vectRowSum[iRow] += dValue;
+            if (iCol != iRow)
+                vectRowSum[iCol] += dValue;
+        }
+    }
+    this->dMatrixNorm = *std::max_element( vectRowSum.begin(), vectRowSum.end() );
+
+    if (this->cPreconditioner == ConjugateGradient::cPrecondJacobi)
+        return true;
+
+    this->dShift = 0.0;
+    while ( ! this->factorIncomplete(this->dShift) )
+    {
+        this->dShift = (this->dShift == 0.0) ? 1.0E-3 : this->dShift * 2.0;
+        if (this->dShift > 1.0)
+        {
+            std::cerr << "\n ERROR: Incomplete Cholesky IC(0) preconditioner BREAKDOWN!\n"
+                      <<   "        Use the Jacobi preconditioner or a direct solver.\n";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//*
+//* End of ConjugateGradient::precondition
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* ConjugateGradient::factorIncomplete
+//*     This function finds the IC(0) factor L D Lt of the matrix with its
+//*     diagonal scaled by (1 + shift).  Each row entry of L only takes the
+//*     products of the earlier entries both rows share.
+//*
+//***************************************************************************
+
+bool ConjugateGradient::factorIncomplete(double dNewShift)
+{
+    const int * aiRowPtr = this->vectRowPtr.data();
+    const int * aiCols = this->vectCols.data();
+    const double * adValues = this->vectValues.data();
+
+    this->vectFactor.assign(this->vectValues.size(), 0.0);
+    double * adFactor = this->vectFactor.data();
+    std::vector<double> vectPivot(this->iSize, 0.0);
+
+    for (int iRow = 0; iRow < this->iSize; iRow++)
+    {
+        int iDiag = aiRowPtr[iRow + 1] - 1;
+        double dPivot = adValues[iDiag] * (1.0 + dNewShift);
+
+        for (int iPos = aiRowPtr[iRow]; iPos < iDiag; iPos++)
+        {
+            int iCol = aiCols[iPos];
+
+            // Shared earlier entries of this row and row iCol...
+            double dValue = adValues[iPos];
+            int iPosRow = aiRowPtr[iRow];
+            int iPosCol = aiRowPtr[iCol];
+            int iEndCol = aiRowPtr[iCol + 1] - 1;
+            while (iPosRow < iPos && iPosCol < iEndCol)
+            {
+                if (aiCols[iPosRow] < aiCols[iPosCol])
+                    iPosRow++;
+                else if (aiCols[iPosRow] > aiCols[iPosCol])
+                    iPosCol++;
+                else
+                {
+                    dValue -= adFactor[iPosRow] * vectPivot[ aiCols[iPosRow] ] * adFactor[iPosCol];
+                    iPosRow++;
+                    iPosCol++;
+                }
+            }
+
+            adFactor[iPos] = dValue * this->vectPivotInverse[iCol];
+            dPivot -= adFactor[iPos] * dValue;
+        }
+
+        if ( ! (dPivot > 0.0) )
+            return false;
+        vectPivot[iRow] = dPivot;
+        this->vectPivotInverse[iRow] = 1.0 / dPivot;
+    }
+
+    return true;
+}
+
+//*
+//* End of ConjugateGradient::factorIncomplete
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* ConjugateGradient::multiply
+//*     This function finds y = K x from the lower triangle.
+//*
+//***************************************************************************
+
+void ConjugateGradient::multiply(const double * adX, double * adY)
+{
+    const int * aiRowPtr = this->vectRowPtr.data();
+    const int * aiCols = this->vectCols.data();
+    const double * adValues = this->vectValues.data();
+
+    std::fill(adY, adY + this->iSize, 0.0);
+    for (int iRow = 0; iRow < this->iSize; iRow++)
+    {
+        int iDiag = aiRowPtr[iRow + 1] - 1;
+        double dSum = adValues[iDiag] * adX[iRow];
+        for (int iPos = aiRowPtr[iRow]; iPos < iDiag; iPos++)
+        {
+            dSum += adValues[iPos] * adX[ aiCols[iPos] ];
+            adY[ aiCols[iPos] ] += adValues[iPos] * adX[iRow];
+        }
+        adY[iRow] += dSum;
+    }
+}
+
+//*
+//* End of ConjugateGradient::multiply
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* ConjugateGradient::applyPreconditioner
+//*     This function finds z = M^-1 r for the preconditioner M.
+//*
+//***************************************************************************
+
+void ConjugateGradient::applyPreconditioner(const double * adR, double * adZ)
+{
+    if (this->cPreconditioner == ConjugateGradient::cPrecondJacobi)
+    {
+        for (int iRow = 0; iRow < this->iSize; iRow++)
+            adZ[iRow] = adR[iRow] * this->vectPivotInverse[iRow];
+        return;
+    }
+
+    const int * aiRowPtr = this->vectRowPtr.data();
+    const int * aiCols = this->vectCols.data();
+    const double * adFactor = this->vectFactor.data();
+
+    // Forward: L y = r...
+    for (int iRow = 0; iRow < this->iSize; iRow++)
+    {
+        double dValue = adR[iRow];
+        for (int iPos = aiRowPtr[iRow]; iPos < aiRowPtr[iRow + 1] - 1; iPos++)
+            dValue -= adFactor[iPos] * adZ[ aiCols[iPos] ];
+        adZ[iRow] = dValue;
+    }
+
+    // Diagonal: D w = y...
+    for (int iRow = 0; iRow < this->iSize; iRow++)
+        adZ[iRow] *= this->vectPivotInverse[iRow];
+
+    // Back: Lt z = w...
+    for (int iRow = this->iSize - 1; iRow >= 0; iRow--)
+    {
+        for (int iPos = aiRowPtr[iRow]; iPos < aiRowPtr[iRow + 1] - 1; iPos++)
+            adZ[ aiCols[iPos] ] -= adFactor[iPos] * adZ[iRow];
+    }
+}
+
+//*
+//* End of ConjugateGradient::applyPreconditioner
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* ConjugateGradient::solve
+//*     This function solves for the displacements given the forces of a
+//*     batch of force vectors (each Matrix Size long).  Each vector is
+//*     iterated on its own and keeps its iteration count and residual.
+//*
+//***************************************************************************
+
+bool ConjugateGradient::solve(double * adDisplace, double * adForce, int iCount)
+{
+    this->vectCaseIterations.assign(iCount, 0);
+    this->vectCaseResidual.assign(iCount, 0.0);
+
+    bool bConverged = true;
+    for (int iCase = 0; iCase < iCount; iCase++)
+    {
+        long int lOffset = (long int) iCase * this->iSize;
+        if ( ! this->solveOne( adDisplace + lOffset, adForce + lOffset,
+                               this->vectCaseIterations[iCase], this->vectCaseResidual[iCase] ) )
+            bConverged = false;
+    }
+
+    return bConverged;
+}
+
+//*
+//* End of ConjugateGradient::solve
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* ConjugateGradient::findResidual
+//*     This function sets the true residual (f - Kx) of the given
+//*     displacements and returns its scaled norm.
+//*
+//***************************************************************************
+
+double ConjugateGradient::findResidual(const double * adDisplace, const double * adForce, double * adResidual,
+                                       double dForceNorm)
+{
+    this->multiply(adDisplace, adResidual);
+    double dResidualNorm = 0.0;
+    double dDisplaceNorm = 0.0;
+    for (int iRow = 0; iRow < this->iSize; iRow++)
+    {
+        adResidual[iRow] = adForce[iRow] - adResidual[iRow];
+        dResidualNorm = std::max( dResidualNorm, std::fabs(adResidual[iRow]) );
+        dDisplaceNorm = std::max( dDisplaceNorm, std::fabs(adDisplace[iRow]) );
+    }
+    return dResidualNorm / (this->dMatrixNorm * dDisplaceNorm + dForceNorm);
+}
+
+//*
+//* End of ConjugateGradient::findResidual
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* ConjugateGradient::solveOne
+//*     This function solves for one force vector's displacements by PCG
+//*     iteration from zero displacements.  The recurrence residual drifts
+//*     from the true residual, so once it reaches the tolerance the true
+//*     residual is found from the displacements.  While that is still
+//*     above the tolerance, the iteration restarts from it (up to the
+//*     restart limit).  The reported accuracy is always the true residual.
+//*
+//*     The residual is scaled by |K| |x| + |f| (greatest magnitudes), not
+//*     by |f| alone.  Round off in forming Kx alone leaves a residual near
+//*     machine precision times |K| |x|, which for a stiff structure is far
+//*     above |f|, so only the scaled residual can reach any tolerance.  It
+//*     is the smallest relative change of K and f that the displacements
+//*     solve exactly (the backward error).
+//*
+//*     A solution that does not reach the tolerance within the limits is
+//*     still returned, but fails with a warning.
+//*
+//***************************************************************************
+
+bool ConjugateGradient::solveOne(double * adDisplace, const double * adForce, int & iIterations, double & dResidual)
+{
+    int iSize = this->iSize;
+    std::vector<double> vectResidual(adForce, adForce + iSize);
+    std::vector<double> vectSearch(iSize);
+    std::vector<double> vectPrecond(iSize);
+    std::vector<double> vectProduct(iSize);
+    double * adResidual = vectResidual.data();
+    double * adSearch = vectSearch.data();
+    double * adPrecond = vectPrecond.data();
+    double * adProduct = vectProduct.data();
+
+    std::fill(adDisplace, adDisplace + iSize, 0.0);
+    iIterations = 0;
+    dResidual = 0.0;
+
+    double dForceNorm = 0.0;
+    for (int iRow = 0; iRow < iSize; iRow++)
+        dForceNorm = std::max( dForceNorm, std::fabs(adForce[iRow]) );
+    if (dForceNorm == 0.0) // ...no load, no displacement...
+        return true;
+
+    int iMaxIterations = ConjugateGradient::iIterationFactor * iSize;
+    int iRestarts = 0;
+    bool bConverged = false;
+    bool bStart = true;
+    double dRZ = 0.0;
+    while (iIterations < iMaxIterations)
+    {
+        // Start (or restart) the search from the residual...
+        if (bStart)
+        {
+            this->applyPreconditioner(adResidual, adPrecond);
+            std::copy(adPrecond, adPrecond + iSize, adSearch);
+            dRZ = 0.0;
+            for (int iRow = 0; iRow < iSize; iRow++)
+                dRZ += adResidual[iRow] * adPrecond[iRow];
+            bStart = false;
+        }
+
+        this->multiply(adSearch, adProduct);
+        double dPQ = 0.0;
+        for (int iRow = 0; iRow < iSize; iRow++)
+            dPQ += adSearch[iRow] * adProduct[iRow];
+        if (dPQ == 0.0)
+            break;
+
+        double dAlpha = dRZ / dPQ;
+        double dResidualNorm = 0.0;
+        double dDisplaceNorm = 0.0;
+        for (int iRow = 0; iRow < iSize; iRow++)
+        {
+            adDisplace[iRow] += dAlpha * adSearch[iRow];
+            adResidual[iRow] -= dAlpha * adProduct[iRow];
+            dResidualNorm = std::max( dResidualNorm, std::fabs(adResidual[iRow]) );
+            dDisplaceNorm = std::max( dDisplaceNorm, std::fabs(adDisplace[iRow]) );
+        }
+        iIterations++;
+
+        // Check the true residual once the recurrence reaches the tolerance...
+        if ( dResidualNorm / (this->dMatrixNorm * dDisplaceNorm + dForceNorm) <= this->dTolerance )
+        {
+            dResidual = this->findResidual(adDisplace, adForce, adResidual, dForceNorm);
+            if (dResidual <= this->dTolerance)
+            {
+                bConverged = true;
+                break;
+            }
+            if (++iRestarts > ConjugateGradient::iRestartLimit)
+                break;
+            bStart = true;
+            continue;
+        }
+
+        this->applyPreconditioner(adResidual, adPrecond);
+        double dRZNew = 0.0;
+        for (int iRow = 0; iRow < iSize; iRow++)
+            dRZNew += adResidual[iRow] * adPrecond[iRow];
+        double dBeta = dRZNew / dRZ;
+        dRZ = dRZNew;
+        for (int iRow = 0; iRow < iSize; iRow++)
+            adSearch[iRow] = adPrecond[iRow] + dBeta * adSearch[iRow];
+    }
+
+    if ( ! bConverged )
+    {
+        dResidual = this->findResidual(adDisplace, adForce, adResidual, dForceNorm);
+        if (dResidual > this->dTolerance)
+        {
+            std::cerr << "\n WARNING: Conjugate Gradient did NOT converge!\n"
+                      <<   "          Iterations = " << iIterations << ",\n"
+                      <<   "          Scaled Residual = " << dResidual << "\n";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//*
+//* End of ConjugateGradient::solveOne
+//***************************************************************************
+
+long int ConjugateGradient::getMatrixEntries(void)
+{
+    return (long int) this->vectValues.size();
+}
+
+double ConjugateGradient::getShift(void)
+{
+    return this->dShift;
+}
+
+int ConjugateGradient::getIterations(int iCase)
+{
+    return this->vectCaseIterations[iCase];
+}
+
+double ConjugateGradient::getResidual(int iCase)
+{
+    return this->vectCaseResidual[iCase];
+}
@@ -0,0 +1,79 @@
+/*
+ * ConjugateGradient.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#ifndef CONJUGATEGRADIENT_HPP_
+#define CONJUGATEGRADIENT_HPP_
+
+#include "Member.hpp"
+
+#include <vector>
+
+// Preconditioned Conjugate Gradient (PCG) Solution of the System Stiffness Matrix...
+//
+//   The assembled matrix is kept in compressed rows of its lower triangle
+//   and is never factored, so the memory is only the matrix itself plus a
+//   preconditioner of the same size or smaller:
+//     Jacobi - the inverse of the diagonal
+//     IC(0)  - an incomplete L D Lt factor keeping only the matrix's own
+//              nonzero pattern
+//   Each solution iterates until the scaled residual
+//   |f - Kx| / (|K| |x| + |f|) falls to the tolerance.  The recurrence
+//   residual drifts from the true one, so when it reaches the tolerance
+//   the true residual is checked, and the iteration restarts from it while
+//   it is still too large.
+
+class ConjugateGradient
+{
+public:
+    static const char cPrecondJacobi = 'J'; // Jacobi (Diagonal)
+    static const char cPrecondIC = 'I';     // Incomplete Cholesky IC(0)
+    static const int iIterationFactor = 10; // Iteration limit: factor * matrix size
+    static const int iRestartLimit = 10;    // Restarts from the true residual
+
+    ConjugateGradient(void);
+    ~ConjugateGradient(void);
+    void clear(void);
+
+    void setPreconditioner(char);
+    char getPreconditioner(void);
+    void setTolerance(double);
+    double getTolerance(void);
+
+    bool analyze(int, std::vector<Member *> &);
+    void add(int, int, double);
+    bool precondition(void);
+    bool solve(double *, double *, int);
+
+    long int getMatrixEntries(void);
+    double getShift(void);
+    int getIterations(int);
+    double getResidual(int);
+
+private:
+    int iSize;                              // Matrix size (equations)
+    char cPreconditioner;                   // Preconditioner Indicator (see cPrecond...)
+    double dTolerance;                      // Scaled residual tolerance
+
+    std::vector<int> vectRowPtr;            // Start of each row (+ end)
+    std::vector<int> vectCols;              // Columns of each row (ascending, diagonal last)
+    std::vector<double> vectValues;         // Lower triangle entries
+    std::vector<double> vectFactor;         // IC(0): L entries (unit diagonal not kept)
+    std::vector<double> vectPivotInverse;   // Jacobi or IC(0): D^-1
+
+    double dShift;                          // IC(0): diagonal shift used to avoid breakdown
+    double dMatrixNorm;                     // Greatest row sum of magnitudes (for scaled residuals)
+    std::vector<int> vectCaseIterations;    // Last batch: iterations of each solution
+    std::vector<double> vectCaseResidual;   // Last batch: scaled residual of each solution
+
+    void multiply(const double *, double *);
+    void applyPreconditioner(const double *, double *);
+    bool factorIncomplete(double);
+    double findResidual(const double *, const double *, double *, double);
+    bool solveOne(double *, const double *, int &, double &);
+};
+
+#endif /* CONJUGATEGRADIENT_HPP_ */
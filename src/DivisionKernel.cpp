@@ -0,0 +1,601 @@
+/*
+ * DivisionKernel.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#include "DivisionKernel.hpp"
+#include "SystemDef.hpp"
+
+#include <cstddef>
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#define CAPS_KERNEL_X86
+#include <immintrin.h>
+#endif
+
+DivisionKernel::Trapezoidal DivisionKernel::fnTrapezoidal = DivisionKernel::trapezoidalScalar;
+DivisionKernel::End DivisionKernel::fnEnd = DivisionKernel::endScalar;
+DivisionKernel::Distributed DivisionKernel::fnDistributed = DivisionKernel::distributedScalar;
+DivisionKernel::Concentrated DivisionKernel::fnConcentrated = DivisionKernel::concentratedScalar;
+const char * DivisionKernel::strName = "Scalar";
+
+DivisionStations::DivisionStations(void)
+{
+    this->iCount = 0;
+    this->siDivisions = -1;
+    this->adFraction = nullptr;
+    this->adLength = nullptr;
+    this->adAxial = nullptr;
+    this->adShear = nullptr;
+    this->adBend = nullptr;
+    this->adTrapAxial = nullptr;
+    this->adTrapShear = nullptr;
+    this->adTrapBend = nullptr;
+}
+
+//***************************************************************************
+//*
+//* DivisionStations::set
+//*     This function sets the stations along a Member of the given length
+//*     at the given number of divisions, and clears the Trapezoidal Loads.
+//*     The arrays and division fractions are only set up again for another
+//*     number of divisions.
+//*
+//***************************************************************************
+
+void DivisionStations::set(double dLength, short int siDivisions)
+{
+    // Set up the arrays and division fractions for the number of divisions...
+    if (this->siDivisions != siDivisions)
+    {
+        this->reserve(siDivisions + 2);
+        this->iCount = siDivisions + 2;
+        this->siDivisions = siDivisions;
+
+        double dReciprocalDivision = 1.0 / (double)(siDivisions + 1);
+        for (int iStation = 0; iStation < this->iCount; iStation++)
+            this->adFraction[iStation] = (double)iStation * dReciprocalDivision;
+    }
+
+    for (int iStation = 0; iStation < this->iCount; iStation++)
+    {
+        this->adLength[iStation] = dLength * this->adFraction[iStation];
+        this->adTrapAxial[iStation] = 0.0;
+        this->adTrapShear[iStation] = 0.0;
+        this->adTrapBend[iStation] = 0.0;
+    }
+}
+
+//*
+//* End of DivisionStations::set
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* DivisionStations::reserve
+//*     This function sets up the arrays for at least the given number of
+//*     stations (they only grow).  The stations are then set by the caller
+//*     (not by division), so the division fractions are cleared.
+//*
+//***************************************************************************
+
+void DivisionStations::reserve(int iStations)
+{
+    std::size_t uiCount = (std::size_t) iStations;
+    if (this->vectData.size() < uiCount * 8)
+    {
+        this->vectData.assign(uiCount * 8, 0.0);
+
+        double * adData = this->vectData.data();
+        this->adFraction  = adData;
+        this->adLength    = adData + uiCount;
+        this->adAxial     = adData + uiCount * 2;
+        this->adShear     = adData + uiCount * 3;
+        this->adBend      = adData + uiCount * 4;
+        this->adTrapAxial = adData + uiCount * 5;
+        this->adTrapShear = adData + uiCount * 6;
+        this->adTrapBend  = adData + uiCount * 7;
+    }
+    this->iCount = 0;
+    this->siDivisions = -1;
+}
+
+//*
+//* End of DivisionStations::reserve
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* Scalar Kernels
+//*     Each kernel evaluates the stations from the given first station, so
+//*     the vector kernels finish their remaining stations with them.
+//*
+//***************************************************************************
+
+static void trapezoidalFrom(DivisionStations & ds, int iFirst, double dStart, double dEnd,
+                            const double * adLoadStart, const double * adLoadEnd)
+{
+    double dLengthTrap = dEnd - dStart;
+    double dDeltaX = adLoadEnd[X] - adLoadStart[X];
+    double dDeltaY = adLoadEnd[Y] - adLoadStart[Y];
+
+    for (int iStation = iFirst; iStation < ds.iCount; iStation++)
+    {
+        double dIntraLengthMember = ds.adLength[iStation];
+        if (dIntraLengthMember > dStart)
+        {
+            double dIntraLengthTrap  = dIntraLengthMember - dStart;
+            double dIntraLengthTrap2 = dIntraLengthTrap * dIntraLengthTrap;
+            double dIntraLengthTrap3 = dIntraLengthTrap * dIntraLengthTrap2;
+            if (dIntraLengthMember < dEnd)
+            {
+                // The PPSA Axial and Shear within the load, kept for comparison
+                // with PPSA (the Exact option uses the load up to the station)...
+                ds.adTrapAxial[iStation] -= (adLoadStart[X] * dDeltaX * dIntraLengthTrap3 / (dLengthTrap * 2.0));
+                ds.adTrapShear[iStation] += (adLoadStart[Y] * dDeltaY * dIntraLengthTrap3 / (dLengthTrap * 2.0));
+                ds.adTrapBend[iStation]  += (dIntraLengthTrap2 * (adLoadStart[Y] +
+                                                dDeltaY * dIntraLengthTrap / (dLengthTrap * 3.0)) / 2.0);
+            }
+            else
+            {
+                ds.adTrapAxial[iStation] -= (dLengthTrap * (adLoadStart[X] + dDeltaX / 2.0));
+                ds.adTrapShear[iStation] += (dLengthTrap * (adLoadStart[Y] + dDeltaY / 2.0));
+                ds.adTrapBend[iStation]  += (dLengthTrap * (adLoadStart[Y]  * (dIntraLengthTrap - dLengthTrap / 2.0) +
+                                                dDeltaY / 2.0 * (dIntraLengthTrap - dLengthTrap * 2.0 / 3.0)));
+            }
+        }
+    }
+}
+
+static void endFrom(DivisionStations & ds, int iFirst, const double * adLocalForce)
+{
+    for (int iStation = iFirst; iStation < ds.iCount; iStation++)
+    {
+        ds.adAxial[iStation] = -adLocalForce[0] + ds.adTrapAxial[iStation];
+        ds.adShear[iStation] =  adLocalForce[1] + ds.adTrapShear[iStation];
+        ds.adBend[iStation]  = (adLocalForce[1] * ds.adLength[iStation] - adLocalForce[2]) + ds.adTrapBend[iStation];
+    }
+}
+
+static void distributedFrom(DivisionStations & ds, int iFirst, const double * adLoad)
+{
+    for (int iStation = iFirst; iStation < ds.iCount; iStation++)
+    {
+        double dIntraLengthMember = ds.adLength[iStation];
+        ds.adAxial[iStation] -= adLoad[X] * dIntraLengthMember;
+        ds.adShear[iStation] += adLoad[Y] * dIntraLengthMember;
+        ds.adBend[iStation]  += adLoad[Y] / 2.0 * (dIntraLengthMember * dIntraLengthMember);
+    }
+}
+
+static void concentratedFrom(DivisionStations & ds, int iFirst, double dLoadDist, const double * adLoad)
+{
+    for (int iStation = iFirst; iStation < ds.iCount; iStation++)
+    {
+        double dIntraLengthMember = ds.adLength[iStation];
+        if (dIntraLengthMember > dLoadDist)
+        {
+            ds.adAxial[iStation] -= adLoad[X];
+            ds.adShear[iStation] += adLoad[Y];
+            ds.adBend[iStation]  += adLoad[Y] * (dIntraLengthMember - dLoadDist);
+        }
+    }
+}
+
+void DivisionKernel::trapezoidalScalar(DivisionStations & ds, double dStart, double dEnd,
+                                       const double * adLoadStart, const double * adLoadEnd)
+{
+    trapezoidalFrom(ds, 0, dStart, dEnd, adLoadStart, adLoadEnd);
+}
+
+void DivisionKernel::endScalar(DivisionStations & ds, const double * adLocalForce)
+{
+    endFrom(ds, 0, adLocalForce);
+}
+
+void DivisionKernel::distributedScalar(DivisionStations & ds, const double * adLoad)
+{
+    distributedFrom(ds, 0, adLoad);
+}
+
+void DivisionKernel::concentratedScalar(DivisionStations & ds, double dLoadDist, const double * adLoad)
+{
+    concentratedFrom(ds, 0, dLoadDist, adLoad);
+}
+
+#ifdef CAPS_KERNEL_X86
+
+//***************************************************************************
+//*
+//* AVX2 Kernels
+//*     One 4 lane register holds 4 stations.  A load applied past a point
+//*     is blended into the stations past it.  The kernels are called between
+//*     scalar code, so each clears the upper registers before its remaining
+//*     stations to avoid the AVX to SSE transition penalty.
+//*
+//***************************************************************************
+
+__attribute__((target("avx2")))
+static void trapezoidalAVX2(DivisionStations & ds, double dStart, double dEnd,
+                            const double * adLoadStart, const double * adLoadEnd)
+{
+    double dLengthTrap = dEnd - dStart;
+    double dDeltaX = adLoadEnd[X] - adLoadStart[X];
+    double dDeltaY = adLoadEnd[Y] - adLoadStart[Y];
+
+    __m256d vStart = _mm256_set1_pd(dStart);
+    __m256d vEnd = _mm256_set1_pd(dEnd);
+    __m256d vStartDeltaX = _mm256_set1_pd(adLoadStart[X] * dDeltaX);
+    __m256d vStartDeltaY = _mm256_set1_pd(adLoadStart[Y] * dDeltaY);
+    __m256d vStartY = _mm256_set1_pd(adLoadStart[Y]);
+    __m256d vDeltaY = _mm256_set1_pd(dDeltaY);
+    __m256d vHalfDeltaY = _mm256_set1_pd(dDeltaY / 2.0);
+    __m256d vLengthTrap = _mm256_set1_pd(dLengthTrap);
+    __m256d vLengthTrap2 = _mm256_set1_pd(dLengthTrap * 2.0);
+    __m256d vLengthTrap3 = _mm256_set1_pd(dLengthTrap * 3.0);
+    __m256d vHalfLengthTrap = _mm256_set1_pd(dLengthTrap / 2.0);
+    __m256d vTwoThirdsLengthTrap = _mm256_set1_pd(dLengthTrap * 2.0 / 3.0);
+    __m256d vTwo = _mm256_set1_pd(2.0);
+    __m256d vPastAxial = _mm256_set1_pd( dLengthTrap * (adLoadStart[X] + dDeltaX / 2.0) );
+    __m256d vPastShear = _mm256_set1_pd( dLengthTrap * (adLoadStart[Y] + dDeltaY / 2.0) );
+
+    int iStation = 0;
+    for ( ; iStation + 4 <= ds.iCount; iStation += 4)
+    {
+        __m256d vLength = _mm256_loadu_pd(ds.adLength + iStation);
+        __m256d vAfter = _mm256_cmp_pd(vLength, vStart, _CMP_GT_OQ);
+        if ( _mm256_movemask_pd(vAfter) == 0 )
+            continue;
+        __m256d vWithin = _mm256_cmp_pd(vLength, vEnd, _CMP_LT_OQ);
+
+        __m256d vTrap = _mm256_sub_pd(vLength, vStart);
+        __m256d vTrap2 = _mm256_mul_pd(vTrap, vTrap);
+        __m256d vTrap3 = _mm256_mul_pd(vTrap, vTrap2);
+
+        // Within the load...
+        __m256d vAxialIn = _mm256_div_pd( _mm256_mul_pd(vStartDeltaX, vTrap3), vLengthTrap2 );
+        __m256d vShearIn = _mm256_div_pd( _mm256_mul_pd(vStartDeltaY, vTrap3), vLengthTrap2 );
+        __m256d vBendIn = _mm256_div_pd( _mm256_mul_pd( vTrap2,
+                                                        _mm256_add_pd( vStartY,
+                                                                       _mm256_div_pd( _mm256_mul_pd(vDeltaY, vTrap),
+                                                                                      vLengthTrap3 ) ) ),
+                                         vTwo );
+
+        // Past the load...
+        __m256d vBendPast = _mm256_mul_pd( vLengthTrap,
+                                           _mm256_add_pd( _mm256_mul_pd( vStartY, _mm256_sub_pd(vTrap, vHalfLengthTrap) ),
+                                                          _mm256_mul_pd( vHalfDeltaY,
+                                                                         _mm256_sub_pd(vTrap, vTwoThirdsLengthTrap) ) ) );
+
+        __m256d vAxial = _mm256_blendv_pd(vPastAxial, vAxialIn, vWithin);
+        __m256d vShear = _mm256_blendv_pd(vPastShear, vShearIn, vWithin);
+        __m256d vBend = _mm256_blendv_pd(vBendPast, vBendIn, vWithin);
+
+        __m256d vTrapAxial = _mm256_loadu_pd(ds.adTrapAxial + iStation);
+        __m256d vTrapShear = _mm256_loadu_pd(ds.adTrapShear + iStation);
+        __m256d vTrapBend = _mm256_loadu_pd(ds.adTrapBend + iStation);
+        _mm256_storeu_pd( ds.adTrapAxial + iStation,
+                          _mm256_blendv_pd( vTrapAxial, _mm256_sub_pd(vTrapAxial, vAxial), vAfter ) );
+        _mm256_storeu_pd( ds.adTrapShear + iStation,
+                          _mm256_blendv_pd( vTrapShear, _mm256_add_pd(vTrapShear, vShear), vAfter ) );
+        _mm256_storeu_pd( ds.adTrapBend + iStation,
+                          _mm256_blendv_pd( vTrapBend, _mm256_add_pd(vTrapBend, vBend), vAfter ) );
+    }
+
+    _mm256_zeroupper();
+    trapezoidalFrom(ds, iStation, dStart, dEnd, adLoadStart, adLoadEnd);
+}
+
+__attribute__((target("avx2")))
+static void endAVX2(DivisionStations & ds, const double * adLocalForce)
+{
+    __m256d vAxial = _mm256_set1_pd(-adLocalForce[0]);
+    __m256d vShear = _mm256_set1_pd(adLocalForce[1]);
+    __m256d vMoment = _mm256_set1_pd(adLocalForce[2]);
+
+    int iStation = 0;
+    for ( ; iStation + 4 <= ds.iCount; iStation += 4)
+    {
+        __m256d vLength = _mm256_loadu_pd(ds.adLength + iStation);
+        _mm256_storeu_pd( ds.adAxial + iStation,
+                          _mm256_add_pd( vAxial, _mm256_loadu_pd(ds.adTrapAxial + iStation) ) );
+        _mm256_storeu_pd( ds.adShear + iStation,
+                          _mm256_add_pd( vShear, _mm256_loadu_pd(ds.adTrapShear + iStation) ) );
+        _mm256_storeu_pd( ds.adBend + iStation,
+                          _mm256_add_pd( _mm256_sub_pd( _mm256_mul_pd(vShear, vLength), vMoment ),
+                                         _mm256_loadu_pd(ds.adTrapBend + iStation) ) );
+    }
+
+    _mm256_zeroupper();
+    endFrom(ds, iStation, adLocalForce);
+}
+
+__attribute__((target("avx2")))
+static void distributedAVX2(DivisionStations & ds, const double * adLoad)
+{
+    __m256d vLoadX = _mm256_set1_pd(adLoad[X]);
+    __m256d vLoadY = _mm256_set1_pd(adLoad[Y]);
+    __m256d vHalfLoadY = _mm256_set1_pd(adLoad[Y] / 2.0);
+
+    int iStation = 0;
+    for ( ; iStation + 4 <= ds.iCount; iStation += 4)
+    {
+        __m256d vLength = _mm256_loadu_pd(ds.adLength + iStation);
+        _mm256_storeu_pd( ds.adAxial + iStation,
+                          _mm256_sub_pd( _mm256_loadu_pd(ds.adAxial + iStation), _mm256_mul_pd(vLoadX, vLength) ) );
+        _mm256_storeu_pd( ds.adShear + iStation,
+                          _mm256_add_pd( _mm256_loadu_pd(ds.adShear + iStation), _mm256_mul_pd(vLoadY, vLength) ) );
+        _mm256_storeu_pd( ds.adBend + iStation,
+                          _mm256_add_pd( _mm256_loadu_pd(ds.adBend + iStation),
+                                         _mm256_mul_pd( vHalfLoadY, _mm256_mul_pd(vLength, vLength) ) ) );
+    }
+
+    _mm256_zeroupper();
+    distributedFrom(ds, iStation, adLoad);
+}
+
+__attribute__((target("avx2")))
+static void concentratedAVX2(DivisionStations & ds, double dLoadDist, const double * adLoad)
+{
+    __m256d vLoadDist = _mm256_set1_pd(dLoadDist);
+    __m256d vLoadX = _mm256_set1_pd(adLoad[X]);
+    __m256d vLoadY = _mm256_set1_pd(adLoad[Y]);
+
+    int iStation = 0;
+    for ( ; iStation + 4 <= ds.iCount; iStation += 4)
+    {
+        __m256d vLength = _mm256_loadu_pd(ds.adLength + iStation);
+        __m256d vAfter = _mm256_cmp_pd(vLength, vLoadDist, _CMP_GT_OQ);
+        if ( _mm256_movemask_pd(vAfter) == 0 )
+            continue;
+
+        __m256d vAxial = _mm256_loadu_pd(ds.adAxial + iStation);
+        __m256d vShear = _mm256_loadu_pd(ds.adShear + iStation);
+        __m256d vBend = _mm256_loadu_pd(ds.adBend + iStation);
+        _mm256_storeu_pd( ds.adAxial + iStation,
+                          _mm256_blendv_pd( vAxial, _mm256_sub_pd(vAxial, vLoadX), vAfter ) );
+        _mm256_storeu_pd( ds.adShear + iStation,
+                          _mm256_blendv_pd( vShear, _mm256_add_pd(vShear, vLoadY), vAfter ) );
+        _mm256_storeu_pd( ds.adBend + iStation,
+                          _mm256_blendv_pd( vBend,
+                                            _mm256_add_pd( vBend,
+                                                           _mm256_mul_pd( vLoadY, _mm256_sub_pd(vLength, vLoadDist) ) ),
+                                            vAfter ) );
+    }
+
+    _mm256_zeroupper();
+    concentratedFrom(ds, iStation, dLoadDist, adLoad);
+}
+
+//***************************************************************************
+//*
+//* AVX-512 Kernels
+//*     One 8 lane register holds 8 stations.  A load applied past a point
+//*     is masked into the stations past it.  As for AVX2, each clears the
+//*     upper registers before its remaining stations.
+//*
+//***************************************************************************
+
+__attribute__((target("avx512f")))
+static void trapezoidalAVX512(DivisionStations & ds, double dStart, double dEnd,
+                              const double * adLoadStart, const double * adLoadEnd)
+{
+    double dLengthTrap = dEnd - dStart;
+    double dDeltaX = adLoadEnd[X] - adLoadStart[X];
+    double dDeltaY = adLoadEnd[Y] - adLoadStart[Y];
+
+    __m512d vStart = _mm512_set1_pd(dStart);
+    __m512d vEnd = _mm512_set1_pd(dEnd);
+    __m512d vStartDeltaX = _mm512_set1_pd(adLoadStart[X] * dDeltaX);
+    __m512d vStartDeltaY = _mm512_set1_pd(adLoadStart[Y] * dDeltaY);
+    __m512d vStartY = _mm512_set1_pd(adLoadStart[Y]);
+    __m512d vDeltaY = _mm512_set1_pd(dDeltaY);
+    __m512d vHalfDeltaY = _mm512_set1_pd(dDeltaY / 2.0);
+    __m512d vLengthTrap = _mm512_set1_pd(dLengthTrap);
+    __m512d vLengthTrap2 = _mm512_set1_pd(dLengthTrap * 2.0);
+    __m512d vLengthTrap3 = _mm512_set1_pd(dLengthTrap * 3.0);
+    __m512d vHalfLengthTrap = _mm512_set1_pd(dLengthTrap / 2.0);
+    __m512d vTwoThirdsLengthTrap = _mm512_set1_pd(dLengthTrap * 2.0 / 3.0);
+    __m512d vTwo = _mm512_set1_pd(2.0);
+    __m512d vPastAxial = _mm512_set1_pd( dLengthTrap * (adLoadStart[X] + dDeltaX / 2.0) );
+    __m512d vPastShear = _mm512_set1_pd( dLengthTrap * (adLoadStart[Y] + dDeltaY / 2.0) );
+
+    int iStation = 0;
+    for ( ; iStation + 8 <= ds.iCount; iStation += 8)
+    {
+        __m512d vLength = _mm512_loadu_pd(ds.adLength + iStation);
+        __mmask8 kAfter = _mm512_cmp_pd_mask(vLength, vStart, _CMP_GT_OQ);
+        if (kAfter == 0)
+            continue;
+        __mmask8 kWithin = _mm512_cmp_pd_mask(vLength, vEnd, _CMP_LT_OQ);
+
+        __m512d vTrap = _mm512_sub_pd(vLength, vStart);
+        __m512d vTrap2 = _mm512_mul_pd(vTrap, vTrap);
+        __m512d vTrap3 = _mm512_mul_pd(vTrap, vTrap2);
+
+        // Within the load...
+        __m512d vAxialIn = _mm512_div_pd( _mm512_mul_pd(vStartDeltaX, vTrap3), vLengthTrap2 );
+        __m512d vShearIn = _mm512_div_pd( _mm512_mul_pd(vStartDeltaY, vTrap3), vLengthTrap2 );
+        __m512d vBendIn = _mm512_div_pd( _mm512_mul_pd( vTrap2,
+                                                        _mm512_add_pd( vStartY,
+                                                                       _mm512_div_pd( _mm512_mul_pd(vDeltaY, vTrap),
+                                                                                      vLengthTrap3 ) ) ),
+                                         vTwo );
+
+        // Past the load...
+        __m512d vBendPast = _mm512_mul_pd( vLengthTrap,
+                                           _mm512_add_pd( _mm512_mul_pd( vStartY, _mm512_sub_pd(vTrap, vHalfLengthTrap) ),
+                                                          _mm512_mul_pd( vHalfDeltaY,
+                                                                         _mm512_sub_pd(vTrap, vTwoThirdsLengthTrap) ) ) );
+
+        __m512d vAxial = _mm512_mask_blend_pd(kWithin, vPastAxial, vAxialIn);
+        __m512d vShear = _mm512_mask_blend_pd(kWithin, vPastShear, vShearIn);
+        __m512d vBend = _mm512_mask_blend_pd(kWithin, vBendPast, vBendIn);
+
+        __m512d vTrapAxial = _mm512_loadu_pd(ds.adTrapAxial + iStation);
+        __m512d vTrapShear = _mm512_loadu_pd(ds.adTrapShear + iStation);
+        __m512d vTrapBend = _mm512_loadu_pd(ds.adTrapBend + iStation);
+        _mm512_storeu_pd( ds.adTrapAxial + iStation, _mm512_mask_sub_pd(vTrapAxial, kAfter, vTrapAxial, vAxial) );
+        _mm512_storeu_pd( ds.adTrapShear + iStation, _mm512_mask_add_pd(vTrapShear, kAfter, vTrapShear, vShear) );
+        _mm512_storeu_pd( ds.adTrapBend + iStation, _mm512_mask_add_pd(vTrapBend, kAfter, vTrapBend, vBend) );
+    }
+
+    _mm256_zeroupper();
+    trapezoidalFrom(ds, iStation, dStart, dEnd, adLoadStart, adLoadEnd);
+}
+
+__attribute__((target("avx512f")))
+static void endAVX512(DivisionStations & ds, const double * adLocalForce)
+{
+    __m512d vAxial = _mm512_set1_pd(-adLocalForce[0]);
+    __m512d vShear = _mm512_set1_pd(adLocalForce[1]);
+    __m512d vMoment = _mm512_set1_pd(adLocalForce[2]);
+
+    int iStation = 0;
+    for ( ; iStation + 8 <= ds.iCount; iStation += 8)
+    {
+        __m512d vLength = _mm512_loadu_pd(ds.adLength + iStation);
+        _mm512_storeu_pd( ds.adAxial + iStation,
+                          _mm512_add_pd( vAxial, _mm512_loadu_pd(ds.adTrapAxial + iStation) ) );
+        _mm512_storeu_pd( ds.adShear + iStation,
+                          _mm512_add_pd( vShear, _mm512_loadu_pd(ds.adTrapShear + iStation) ) );
+        _mm512_storeu_pd( ds.adBend + iStation,
+                          _mm512_add_pd( _mm512_sub_pd( _mm512_mul_pd(vShear, vLength), vMoment ),
+                                         _mm512_loadu_pd(ds.adTrapBend + iStation) ) );
+    }
+
+    _mm256_zeroupper();
+    endFrom(ds, iStation, adLocalForce);
+}
+
+__attribute__((target("avx512f")))
+static void distributedAVX512(DivisionStations & ds, const double * adLoad)
+{
+    __m512d vLoadX = _mm512_set1_pd(adLoad[X]);
+    __m512d vLoadY = _mm512_set1_pd(adLoad[Y]);
+    __m512d vHalfLoadY = _mm512_set1_pd(adLoad[Y] / 2.0);
+
+    int iStation = 0;
+    for ( ; iStation + 8 <= ds.iCount; iStation += 8)
+    {
+        __m512d vLength = _mm512_loadu_pd(ds.adLength + iStation);
+        _mm512_storeu_pd( ds.adAxial + iStation,
+                          _mm512_sub_pd( _mm512_loadu_pd(ds.adAxial + iStation), _mm512_mul_pd(vLoadX, vLength) ) );
+        _mm512_storeu_pd( ds.adShear + iStation,
+                          _mm512_add_pd( _mm512_loadu_pd(ds.adShear + iStation), _mm512_mul_pd(vLoadY, vLength) ) );
+        _mm512_storeu_pd( ds.adBend + iStation,
+                          _mm512_add_pd( _mm512_loadu_pd(ds.adBend + iStation),
+                                         _mm512_mul_pd( vHalfLoadY, _mm512_mul_pd(vLength, vLength) ) ) );
+    }
+
+    _mm256_zeroupper();
+    distributedFrom(ds, iStation, adLoad);
+}
+
+__attribute__((target("avx512f")))
+static void concentratedAVX512(DivisionStations & ds, double dLoadDist, const double * adLoad)
+{
+    __m512d vLoadDist = _mm512_set1_pd(dLoadDist);
+    __m512d vLoadX = _mm512_set1_pd(adLoad[X]);
+    __m512d vLoadY = _mm512_set1_pd(adLoad[Y]);
+
+    int iStation = 0;
+    for ( ; iStation + 8 <= ds.iCount; iStation += 8)
+    {
+        __m512d vLength = _mm512_loadu_pd(ds.adLength + iStation);
+        __mmask8 kAfter = _mm512_cmp_pd_mask(vLength, vLoadDist, _CMP_GT_OQ);
+        if (kAfter == 0)
+            continue;
+
+        __m512d vAxial = _mm512_loadu_pd(ds.adAxial + iStation);
+        __m512d vShear = _mm512_loadu_pd(ds.adShear + iStation);
+        __m512d vBend = _mm512_loadu_pd(ds.adBend + iStation);
+        _mm512_storeu_pd( ds.adAxial + iStation, _mm512_mask_sub_pd(vAxial, kAfter, vAxial, vLoadX) );
+        _mm512_storeu_pd( ds.adShear + iStation, _mm512_mask_add_pd(vShear, kAfter, vShear, vLoadY) );
+        _mm512_storeu_pd( ds.adBend + iStation,
+                          _mm512_mask_add_pd( vBend, kAfter, vBend,
+                                              _mm512_mul_pd( vLoadY, _mm512_sub_pd(vLength, vLoadDist) ) ) );
+    }
+
+    _mm256_zeroupper();
+    concentratedFrom(ds, iStation, dLoadDist, adLoad);
+}
+
+#endif /* CAPS_KERNEL_X86 */
+
+//***************************************************************************
+//*
+//* DivisionKernel::select
+//*     This function selects the kernels for the best instruction set
+//*     supported by the running CPU.
+//*
+//***************************************************************************
+
+void DivisionKernel::select(void)
+{
+    DivisionKernel::selectScalar();
+
+#ifdef CAPS_KERNEL_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") )
+    {
+        DivisionKernel::fnTrapezoidal = trapezoidalAVX512;
+        DivisionKernel::fnEnd = endAVX512;
+        DivisionKernel::fnDistributed = distributedAVX512;
+        DivisionKernel::fnConcentrated = concentratedAVX512;
+        DivisionKernel::strName = "AVX-512";
+    }
+    else if ( __builtin_cpu_supports("avx2") )
+    {
+        DivisionKernel::fnTrapezoidal = trapezoidalAVX2;
+        DivisionKernel::fnEnd = endAVX2;
+        DivisionKernel::fnDistributed = distributedAVX2;
+        DivisionKernel::fnConcentrated = concentratedAVX2;
+        DivisionKernel::strName = "AVX2";
+    }
+#endif
+}
+
+//*
+//* End of DivisionKernel::select
+//***************************************************************************
+
+void DivisionKernel::selectScalar(void)
+{
+    DivisionKernel::fnTrapezoidal = DivisionKernel::trapezoidalScalar;
+    DivisionKernel::fnEnd = DivisionKernel::endScalar;
+    DivisionKernel::fnDistributed = DivisionKernel::distributedScalar;
+    DivisionKernel::fnConcentrated = DivisionKernel::concentratedScalar;
+    DivisionKernel::strName = "Scalar";
+}
+
+const char * DivisionKernel::getName(void)
+{
+    return DivisionKernel::strName;
+}
+
+void DivisionKernel::trapezoidal(DivisionStations & ds, double dStart, double dEnd,
+                                 const double * adLoadStart, const double * adLoadEnd)
+{
+    DivisionKernel::fnTrapezoidal(ds, dStart, dEnd, adLoadStart, adLoadEnd);
+}
+
+void DivisionKernel::end(DivisionStations & ds, const double * adLocalForce)
+{
+    DivisionKernel::fnEnd(ds, adLocalForce);
+}
+
+void DivisionKernel::distributed(DivisionStations & ds, const double * adLoad)
+{
+    DivisionKernel::fnDistributed(ds, adLoad);
+}
+
+void DivisionKernel::concentrated(DivisionStations & ds, double dLoadDist, const double * adLoad)
+{
+    DivisionKernel::fnConcentrated(ds, dLoadDist, adLoad);
+}
+
+// Select the kernels once at start up...
+[[maybe_unused]] static const bool bKernelSelected = ( DivisionKernel::select(), true );
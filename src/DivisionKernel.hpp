@@ -0,0 +1,81 @@
+/*
+ * DivisionKernel.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#ifndef DIVISIONKERNEL_HPP_
+#define DIVISIONKERNEL_HPP_
+
+#include <vector>
+
+// Member Division Stations...
+//
+//   The Axial force, Shear force and Bending moment at every division point
+//   (station) of a Member, stored as arrays by quantity (SoA) so the load
+//   contributions to all the stations are found together.
+
+struct DivisionStations
+{
+    int iCount;                     // Stations (siDivisions + 2: the divisions, start, and end)
+    short int siDivisions;          // Divisions of the fractions (-1 = stations set otherwise)
+    double * adFraction;            // Fraction of the Member's length
+    double * adLength;              // Length from the Member's Neg end
+    double * adAxial;               // Axial Force
+    double * adShear;               // Shear Force
+    double * adBend;                // Bending Moment
+    double * adTrapAxial;           // Trapezoidal Loads Axial Force
+    double * adTrapShear;           // Trapezoidal Loads Shear Force
+    double * adTrapBend;            // Trapezoidal Loads Bending Moment
+    std::vector<double> vectData;   // Storage of the arrays
+
+    DivisionStations(void);
+    void set(double, short int);
+    void reserve(int);
+};
+
+// Member Division kernels...
+//
+//   The kernels add a Member's loads to all its stations.  They are
+//   selected at run time for the best instruction set the CPU supports
+//   (AVX-512, AVX2 or Scalar).  Every kernel evaluates each station as the
+//   scalar division loop did, in the same order and never fusing
+//   multiplies into adds, so all kernels give identical results on every
+//   CPU.
+
+class DivisionKernel
+{
+public:
+    // Trapezoidal Load (Start, End Distance; Start, End Load)...
+    static void trapezoidal(DivisionStations &, double, double, const double *, const double *);
+    // End Forces (Local Force) and the Trapezoidal Loads...
+    static void end(DivisionStations &, const double *);
+    // Distributed Load (Load Vector)...
+    static void distributed(DivisionStations &, const double *);
+    // Concentrated Load (Distance, Load Vector)...
+    static void concentrated(DivisionStations &, double, const double *);
+
+    static void select(void);
+    static void selectScalar(void);
+    static const char * getName(void);
+
+    static void trapezoidalScalar(DivisionStations &, double, double, const double *, const double *);
+    static void endScalar(DivisionStations &, const double *);
+    static void distributedScalar(DivisionStations &, const double *);
+    static void concentratedScalar(DivisionStations &, double, const double *);
+
+private:
+    typedef void (* Trapezoidal)(DivisionStations &, double, double, const double *, const double *);
+    typedef void (* End)(DivisionStations &, const double *);
+    typedef void (* Distributed)(DivisionStations &, const double *);
+    typedef void (* Concentrated)(DivisionStations &, double, const double *);
+
+    static Trapezoidal fnTrapezoidal;
+    static End fnEnd;
+    static Distributed fnDistributed;
+    static Concentrated fnConcentrated;
+    static const char * strName;
+};
+
+#endif /* DIVISIONKERNEL_HPP_ */
@@ -0,0 +1,291 @@
+/*
+ * DivisionSegments.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#include "DivisionSegments.hpp"
+#include "SystemDef.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+DivisionSegments::DivisionSegments(void)
+{
+    this->set(0.0);
+}
+
+//***************************************************************************
+//*
+//* DivisionSegments::set
+//*     This function sets the Member length and clears the loads.
+//*
+//***************************************************************************
+
+void DivisionSegments::set(double dLength)
+{
+    this->dLength = dLength;
+    this->adDistributed[X] = 0.0;
+    this->adDistributed[Y] = 0.0;
+    this->vectTrapezoidal.clear();
+    this->vectConcentrated.clear();
+}
+
+//*
+//* End of DivisionSegments::set
+//***************************************************************************
+
+void DivisionSegments::trapezoidal(double dStart, double dEnd, const double * adLoadStart, const double * adLoadEnd)
+{
+    this->vectTrapezoidal.push_back( { dStart, dEnd, adLoadStart, adLoadEnd } );
+}
+
+void DivisionSegments::distributed(const double * adLoad)
+{
+    this->adDistributed[X] += adLoad[X];
+    this->adDistributed[Y] += adLoad[Y];
+}
+
+void DivisionSegments::concentrated(double dLoadDist, const double * adLoad)
+{
+    this->vectConcentrated.push_back( { dLoadDist, adLoad } );
+}
+
+//***************************************************************************
+//*
+//* Polynomials
+//*     A polynomial holds its 4 coefficients (constant to cubic) of the
+//*     length from the start of a segment.  A load's polynomial of the
+//*     length from its own start (H before the segment start) is shifted to
+//*     the segment start when added.
+//*
+//***************************************************************************
+
+static void addShifted(double * adPoly, double dShift, double dC0, double dC1, double dC2, double dC3)
+{
+    adPoly[0] += dC0 + dShift * (dC1 + dShift * (dC2 + dShift * dC3));
+    adPoly[1] += dC1 + dShift * (2.0 * dC2 + dShift * 3.0 * dC3);
+    adPoly[2] += dC2 + dShift * 3.0 * dC3;
+    adPoly[3] += dC3;
+}
+
+static double evaluate(const double * adPoly, double dU)
+{
+    return adPoly[0] + dU * (adPoly[1] + dU * (adPoly[2] + dU * adPoly[3]));
+}
+
+//
+// Find the zeros of the polynomial's derivative inside the segment
+//      (3 C3 U^2 + 2 C2 U + C1 = 0, 0 < U < Span)...
+//
+static int findCritical(const double * adPoly, double dSpan, double * adCritical)
+{
+    double dA = 3.0 * adPoly[3];
+    double dB = 2.0 * adPoly[2];
+    double dC = adPoly[1];
+    double adRoot[2];
+    int iRoots = 0;
+
+    if (dA == 0.0)
+    {
+        if (dB != 0.0)
+            adRoot[iRoots++] = -dC / dB;
+    }
+    else
+    {
+        double dDiscriminant = dB * dB - 4.0 * dA * dC;
+        if (dDiscriminant >= 0.0)
+        {
+            // Stable roots (no cancellation)...
+            double dQ = -0.5 * ( dB + std::copysign( std::sqrt(dDiscriminant), dB ) );
+            adRoot[iRoots++] = dQ / dA;
+            if (dQ != 0.0)
+                adRoot[iRoots++] = dC / dQ;
+        }
+    }
+
+    int iCritical = 0;
+    for (int iRoot = 0; iRoot < iRoots; iRoot++)
+    {
+        if (adRoot[iRoot] > 0.0 && adRoot[iRoot] < dSpan)
+            adCritical[iCritical++] = adRoot[iRoot];
+    }
+    return iCritical;
+}
+
+//***************************************************************************
+//*
+//* DivisionSegments::findPolynomials
+//*     This function finds the Axial, Shear and Bending polynomials of the
+//*     segment between the given lengths.  The loads apply as they do at the
+//*     divisions inside the segment or, for a point, at the given length
+//*     itself.  The load expressions are those of the Division kernels.
+//*
+//***************************************************************************
+
+void DivisionSegments::findPolynomials(double dFrom, double dTo, bool bPoint, const double * adLocalForce,
+                                       double * adAxial, double * adShear, double * adBend)
+{
+    for (int iCoeff = 0; iCoeff < 4; iCoeff++)
+    {
+        adAxial[iCoeff] = 0.0;
+        adShear[iCoeff] = 0.0;
+        adBend[iCoeff]  = 0.0;
+    }
+
+    // Start with the End Forces...
+    adAxial[0] = -adLocalForce[0];
+    adShear[0] =  adLocalForce[1];
+    addShifted(adBend, dFrom, -adLocalForce[2], adLocalForce[1], 0.0, 0.0);
+
+    // Add Distributed Load contributions...
+    addShifted(adAxial, dFrom, 0.0, -this->adDistributed[X], 0.0, 0.0);
+    addShifted(adShear, dFrom, 0.0,  this->adDistributed[Y], 0.0, 0.0);
+    addShifted(adBend,  dFrom, 0.0, 0.0, this->adDistributed[Y] / 2.0, 0.0);
+
+    // Add Concentrated Load contributions (past the load)...
+    for (Concentrated & concCurr : this->vectConcentrated)
+    {
+        if ( bPoint ? (dFrom > concCurr.dLoadDist) : (dFrom >= concCurr.dLoadDist) )
+        {
+            adAxial[0] -= concCurr.adLoad[X];
+            adShear[0] += concCurr.adLoad[Y];
+            addShifted(adBend, dFrom - concCurr.dLoadDist, 0.0, concCurr.adLoad[Y], 0.0, 0.0);
+        }
+    }
+
+    // Add Trapezoidal Load contributions (on or past the load)...
+    for (Trapezoidal & trapCurr : this->vectTrapezoidal)
+    {
+        if ( bPoint ? (dFrom > trapCurr.dStart) : (dFrom >= trapCurr.dStart) )
+        {
+            double dLengthTrap = trapCurr.dEnd - trapCurr.dStart;
+            double dDeltaX = trapCurr.adLoadEnd[X] - trapCurr.adLoadStart[X];
+            double dDeltaY = trapCurr.adLoadEnd[Y] - trapCurr.adLoadStart[Y];
+            double dShift = dFrom - trapCurr.dStart;
+
+            if ( bPoint ? (dFrom < trapCurr.dEnd) : (dTo <= trapCurr.dEnd) )
+            {
+                // The Axial and Shear of the load up to the station,
+                // Start * U + Delta * U^2 / (2 Length), not the PPSA
+                // Start * Delta * U^3 / (2 Length) of the Sample option...
+                addShifted(adAxial, dShift, 0.0, -trapCurr.adLoadStart[X],
+                           -(dDeltaX / (dLengthTrap * 2.0)), 0.0);
+                addShifted(adShear, dShift, 0.0, trapCurr.adLoadStart[Y],
+                           dDeltaY / (dLengthTrap * 2.0), 0.0);
+                addShifted(adBend,  dShift, 0.0, 0.0,
+                           trapCurr.adLoadStart[Y] / 2.0, dDeltaY / (dLengthTrap * 6.0));
+            }
+            else
+            {
+                adAxial[0] -= (dLengthTrap * (trapCurr.adLoadStart[X] + dDeltaX / 2.0));
+                adShear[0] += (dLengthTrap * (trapCurr.adLoadStart[Y] + dDeltaY / 2.0));
+                addShifted(adBend, dShift,
+                           -(dLengthTrap * (trapCurr.adLoadStart[Y] * dLengthTrap / 2.0 +
+                                            dDeltaY / 2.0 * dLengthTrap * 2.0 / 3.0)),
+                           dLengthTrap * (trapCurr.adLoadStart[Y] + dDeltaY / 2.0), 0.0, 0.0);
+            }
+        }
+    }
+}
+
+//*
+//* End of DivisionSegments::findPolynomials
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* DivisionSegments::end
+//*     This function adds the End Forces and sets the critical stations of
+//*     the Member: its ends, and each segment's ends (from both sides of a
+//*     load point) and the zeros of its Axial, Shear and Bending
+//*     derivatives.  The stations are in order along the Member.
+//*
+//***************************************************************************
+
+void DivisionSegments::end(DivisionStations & ds, const double * adLocalForce)
+{
+    //
+    // Find the segment ends...
+    //
+    this->vectBreaks.clear();
+    this->vectBreaks.push_back(0.0);
+    for (Trapezoidal & trapCurr : this->vectTrapezoidal)
+    {
+        if (trapCurr.dStart > 0.0 && trapCurr.dStart < this->dLength)
+            this->vectBreaks.push_back(trapCurr.dStart);
+        if (trapCurr.dEnd > 0.0 && trapCurr.dEnd < this->dLength)
+            this->vectBreaks.push_back(trapCurr.dEnd);
+    }
+    for (Concentrated & concCurr : this->vectConcentrated)
+    {
+        if (concCurr.dLoadDist > 0.0 && concCurr.dLoadDist < this->dLength)
+            this->vectBreaks.push_back(concCurr.dLoadDist);
+    }
+    this->vectBreaks.push_back(this->dLength);
+    std::sort( this->vectBreaks.begin(), this->vectBreaks.end() );
+    this->vectBreaks.erase( std::unique( this->vectBreaks.begin(), this->vectBreaks.end() ), this->vectBreaks.end() );
+
+    // Stations: the Member ends and, for each segment, its ends and up to 6 zeros...
+    int iSegments = (int) this->vectBreaks.size() - 1;
+    ds.reserve(2 + iSegments * 8);
+
+    double adAxial[4];
+    double adShear[4];
+    double adBend[4];
+    auto addStation = [&](double dIntraLengthMember, double dU)
+    {
+        ds.adLength[ds.iCount] = dIntraLengthMember;
+        ds.adAxial[ds.iCount]  = evaluate(adAxial, dU);
+        ds.adShear[ds.iCount]  = evaluate(adShear, dU);
+        ds.adBend[ds.iCount]   = evaluate(adBend,  dU);
+        ds.iCount++;
+    };
+
+    // Neg End...
+    this->findPolynomials(0.0, 0.0, true, adLocalForce, adAxial, adShear, adBend);
+    addStation(0.0, 0.0);
+
+    //
+    // Segment Loop...
+    //
+    for (int iSegment = 0; iSegment < iSegments; iSegment++)
+    {
+        double dFrom = this->vectBreaks[iSegment];
+        double dTo = this->vectBreaks[iSegment + 1];
+        double dSpan = dTo - dFrom;
+        this->findPolynomials(dFrom, dTo, false, adLocalForce, adAxial, adShear, adBend);
+
+        std::array<double, 6> adCritical;
+        int iCritical = 0;
+        iCritical += findCritical(adAxial, dSpan, adCritical.data() + iCritical);
+        iCritical += findCritical(adShear, dSpan, adCritical.data() + iCritical);
+        iCritical += findCritical(adBend,  dSpan, adCritical.data() + iCritical);
+
+        // Order the (at most 6) zeros by insertion...
+        for (int iCurr = 1; iCurr < iCritical && iCurr < (int) adCritical.size(); iCurr++)
+        {
+            double dCritical = adCritical[iCurr];
+            int iPrev = iCurr - 1;
+            for ( ; iPrev >= 0 && adCritical[iPrev] > dCritical; iPrev--)
+                adCritical[iPrev + 1] = adCritical[iPrev];
+            adCritical[iPrev + 1] = dCritical;
+        }
+
+        addStation(dFrom, 0.0);
+        for (int iCurr = 0; iCurr < iCritical; iCurr++)
+            addStation(dFrom + adCritical[iCurr], adCritical[iCurr]);
+        addStation(dTo, dSpan);
+    }
+
+    // Pos End...
+    this->findPolynomials(this->dLength, this->dLength, true, adLocalForce, adAxial, adShear, adBend);
+    addStation(this->dLength, 0.0);
+}
+
+//*
+//* End of DivisionSegments::end
+//***************************************************************************
@@ -0,0 +1,62 @@
+/*
+ * DivisionSegments.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#ifndef DIVISIONSEGMENTS_HPP_
+#define DIVISIONSEGMENTS_HPP_
+
+#include "DivisionKernel.hpp"
+
+#include <vector>
+
+// Member Division Segments...
+//
+//   Between the points where its loads start and end, a Member's Axial
+//   force, Shear force and Bending moment are polynomials (at most cubic) of
+//   the length from its Neg end.  The extremes of each segment are at its
+//   ends or where a derivative is zero, so only those critical stations are
+//   evaluated instead of every division.  The loads are added as for the
+//   Division kernels, and the critical stations are set in place of the
+//   divisions.
+
+class DivisionSegments
+{
+public:
+    DivisionSegments(void);
+    void set(double);
+    // Trapezoidal Load (Start, End Distance; Start, End Load)...
+    void trapezoidal(double, double, const double *, const double *);
+    // Distributed Load (Load Vector)...
+    void distributed(const double *);
+    // Concentrated Load (Distance, Load Vector)...
+    void concentrated(double, const double *);
+    // End Forces (Local Force): set the critical stations...
+    void end(DivisionStations &, const double *);
+
+private:
+    struct Trapezoidal
+    {
+        double dStart;
+        double dEnd;
+        const double * adLoadStart;
+        const double * adLoadEnd;
+    };
+    struct Concentrated
+    {
+        double dLoadDist;
+        const double * adLoad;
+    };
+
+    double dLength;                             // Member Length
+    double adDistributed[2];                    // Distributed Loads (X, Y)
+    std::vector<Trapezoidal> vectTrapezoidal;   // Trapezoidal Loads
+    std::vector<Concentrated> vectConcentrated; // Concentrated Loads
+    std::vector<double> vectBreaks;             // Segment ends along the Member
+
+    void findPolynomials(double, double, bool, const double *, double *, double *, double *);
+};
+
+#endif /* DIVISIONSEGMENTS_HPP_ */
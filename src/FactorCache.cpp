@@ -0,0 +1,296 @@
+/*
+ * FactorCache.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#include "FactorCache.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+static const char acCacheMagic[8] = { 'C', 'A', 'P', 'S', 'S', 'S', 'M', '\0' };
+static const std::uint32_t uiCacheByteOrder = 0x01020304;
+
+FactorCache::FactorCache(void)
+{
+    this->pMap = nullptr;
+    this->uiMapSize = 0;
+    this->header = nullptr;
+    this->clear();
+}
+
+FactorCache::~FactorCache(void)
+{
+    this->clear();
+}
+
+//***************************************************************************
+//*
+//* FactorCache::clear
+//*     This function closes any mapped file.  The directory is kept.
+//*
+//***************************************************************************
+
+void FactorCache::clear(void)
+{
+    if (this->pMap != nullptr)
+        munmap(this->pMap, this->uiMapSize);
+    this->pMap = nullptr;
+    this->uiMapSize = 0;
+    this->header = nullptr;
+    this->strFile.clear();
+}
+
+void FactorCache::setDirectory(std::string strNewDirectory)
+{
+    this->strDirectory = strNewDirectory;
+}
+
+std::string FactorCache::getDirectory(void)
+{
+    return this->strDirectory;
+}
+
+bool FactorCache::isEnabled(void)
+{
+    return ( ! this->strDirectory.empty() );
+}
+
+std::string FactorCache::getFile(void)
+{
+    return this->strFile;
+}
+
+//***************************************************************************
+//*
+//* FactorCache::hash
+//*     These functions build a key from a structure's values (FNV-1a over
+//*     64 bit words).  Doubles are hashed by their bits, so any change to
+//*     a value changes the key.
+//*
+//***************************************************************************
+
+std::uint64_t FactorCache::hashStart(void)
+{
+    return FactorCache::hash( (std::uint64_t) 0xCBF29CE484222325ULL, (std::uint64_t) FactorCache::uiVersion );
+}
+
+std::uint64_t FactorCache::hash(std::uint64_t uiKey, std::uint64_t uiValue)
+{
+    uiKey ^= uiValue;
+    uiKey *= 0x100000001B3ULL;
+    return uiKey;
+}
+
+std::uint64_t FactorCache::hash(std::uint64_t uiKey, double dValue)
+{
+    std::uint64_t uiValue;
+    std::memcpy( &uiValue, &dValue, sizeof(uiValue) );
+    return FactorCache::hash(uiKey, uiValue);
+}
+
+//*
+//* End of FactorCache::hash
+//***************************************************************************
+
+std::string FactorCache::path(std::uint64_t uiKey)
+{
+    return ( std::filesystem::path(this->strDirectory) / fmt::format("{:016x}.ssm", uiKey) ).string();
+}
+
+std::size_t FactorCache::payloadSize(int iNodes, int iMatrixSize, std::size_t uiArraySize)
+{
+    // Location and Pivot Inverse entries, then the node sequence padded to 8 bytes...
+    std::size_t uiSequenceSize = ( (std::size_t) iNodes * sizeof(std::int32_t) + 7 ) / 8 * 8;
+    return ( (std::size_t) uiArraySize + iMatrixSize ) * sizeof(double) + uiSequenceSize;
+}
+
+std::uint64_t FactorCache::checksum(const void * pData, std::size_t uiSize)
+{
+    std::uint64_t uiSum = FactorCache::hashStart();
+    const unsigned char * pucData = (const unsigned char *) pData;
+    for (std::size_t uiPos = 0; uiPos < uiSize; uiPos += sizeof(std::uint64_t))
+    {
+        std::uint64_t uiWord;
+        std::memcpy( &uiWord, pucData + uiPos, sizeof(uiWord) );
+        uiSum = FactorCache::hash(uiSum, uiWord);
+    }
+    return uiSum;
+}
+
+//***************************************************************************
+//*
+//* FactorCache::open
+//*     This function maps the cache file for the given key and node count
+//*     and returns its node sequence.  Any file that does not fully agree
+//*     with the key, this build and its own checksum is ignored.
+//*
+//***************************************************************************
+
+bool FactorCache::open(std::uint64_t uiKey, int iNodes, std::vector<int> & vectSequence)
+{
+    this->clear();
+    if ( ! this->isEnabled() )
+        return false;
+
+    int iFile = ::open(this->path(uiKey).c_str(), O_RDONLY);
+    if (iFile < 0) // ...not cached...
+        return false;
+
+    struct stat statFile;
+    if ( fstat(iFile, &statFile) != 0 || (std::size_t) statFile.st_size < sizeof(Header) )
+    {
+        ::close(iFile);
+        return false;
+    }
+
+    this->uiMapSize = (std::size_t) statFile.st_size;
+    this->pMap = mmap(nullptr, this->uiMapSize, PROT_READ, MAP_PRIVATE, iFile, 0);
+    ::close(iFile);
+    if (this->pMap == MAP_FAILED)
+    {
+        this->pMap = nullptr;
+        this->uiMapSize = 0;
+        return false;
+    }
+
+    const Header * headerFile = (const Header *) this->pMap;
+    const unsigned char * pucPayload = (const unsigned char *) this->pMap + sizeof(Header);
+    if ( std::memcmp(headerFile->acMagic, acCacheMagic, sizeof(acCacheMagic)) != 0 ||
+         headerFile->uiVersion != FactorCache::uiVersion ||
+         headerFile->uiByteOrder != uiCacheByteOrder ||
+         headerFile->uiKey != uiKey ||
+         headerFile->iNodes != iNodes ||
+         headerFile->iMatrixSize < 1 ||
+         headerFile->iBandwidth < 1 || headerFile->iBandwidth > headerFile->iMatrixSize ||
+         headerFile->uiArraySize > this->uiMapSize / sizeof(double) ||
+         this->uiMapSize != sizeof(Header) + FactorCache::payloadSize(iNodes,
+                                                                     headerFile->iMatrixSize,
+                                                                     (std::size_t) headerFile->uiArraySize) ||
+         headerFile->uiChecksum != FactorCache::checksum(pucPayload, this->uiMapSize - sizeof(Header)) )
+    {
+        this->clear();
+        return false;
+    }
+    this->header = headerFile;
+    this->strFile = this->path(uiKey);
+
+    const std::int32_t * aiSequence =
+            (const std::int32_t *) ( pucPayload + ( (std::size_t) headerFile->uiArraySize + headerFile->iMatrixSize ) * sizeof(double) );
+    vectSequence.assign(aiSequence, aiSequence + iNodes);
+
+    return true;
+}
+
+//*
+//* End of FactorCache::open
+//***************************************************************************
+
+bool FactorCache::isOpen(void)
+{
+    return (this->header != nullptr);
+}
+
+int FactorCache::getMatrixSize(void)
+{
+    return this->header->iMatrixSize;
+}
+
+int FactorCache::getBandwidth(void)
+{
+    return this->header->iBandwidth;
+}
+
+std::size_t FactorCache::getArraySize(void)
+{
+    return (std::size_t) this->header->uiArraySize;
+}
+
+const double * FactorCache::getLocation(void)
+{
+    return (const double *) ( (const unsigned char *) this->pMap + sizeof(Header) );
+}
+
+const double * FactorCache::getPivotInverse(void)
+{
+    return this->getLocation() + this->header->uiArraySize;
+}
+
+//***************************************************************************
+//*
+//* FactorCache::save
+//*     This function writes the decomposed Skyline and the node sequence
+//*     for the given key.  A failure only warns: the run itself has its
+//*     factor already.
+//*
+//***************************************************************************
+
+bool FactorCache::save(std::uint64_t uiKey, const std::vector<int> & vectSequence,
+                       int iMatrixSize, int iBandwidth, std::size_t uiArraySize,
+                       const double * adLocation, const double * adPivotInverse)
+{
+    if ( ! this->isEnabled() )
+        return false;
+
+    int iNodes = (int) vectSequence.size();
+    std::vector<unsigned char> vectPayload( FactorCache::payloadSize(iNodes, iMatrixSize, uiArraySize), 0 );
+    unsigned char * pucPayload = vectPayload.data();
+    std::memcpy( pucPayload, adLocation, (std::size_t) uiArraySize * sizeof(double) );
+    pucPayload += (std::size_t) uiArraySize * sizeof(double);
+    std::memcpy( pucPayload, adPivotInverse, (std::size_t) iMatrixSize * sizeof(double) );
+    pucPayload += (std::size_t) iMatrixSize * sizeof(double);
+    for (int iNode = 0; iNode < iNodes; iNode++)
+    {
+        std::int32_t iSequence = vectSequence[iNode];
+        std::memcpy( pucPayload + iNode * sizeof(std::int32_t), &iSequence, sizeof(iSequence) );
+    }
+
+    Header headerFile;
+    std::memset( &headerFile, 0, sizeof(headerFile) );
+    std::memcpy( headerFile.acMagic, acCacheMagic, sizeof(acCacheMagic) );
+    headerFile.uiVersion = FactorCache::uiVersion;
+    headerFile.uiByteOrder = uiCacheByteOrder;
+    headerFile.uiKey = uiKey;
+    headerFile.iNodes = iNodes;
+    headerFile.iMatrixSize = iMatrixSize;
+    headerFile.iBandwidth = iBandwidth;
+    headerFile.uiArraySize = uiArraySize;
+    headerFile.uiChecksum = FactorCache::checksum( vectPayload.data(), vectPayload.size() );
+
+    std::string strPath = this->path(uiKey);
+    std::string strTemp = strPath + fmt::format(".{}.tmp", getpid());
+
+    std::error_code ecDirectory;
+    std::filesystem::create_directories(this->strDirectory, ecDirectory);
+
+    std::ofstream ofCache(strTemp, std::ios::binary | std::ios::trunc);
+    ofCache.write( (const char *) &headerFile, sizeof(headerFile) );
+    ofCache.write( (const char *) vectPayload.data(), vectPayload.size() );
+    ofCache.close();
+    if ( ! ofCache || std::rename( strTemp.c_str(), strPath.c_str() ) != 0 )
+    {
+        std::remove( strTemp.c_str() );
+        std::cerr << "\n WARNING: Unable to write the factor cache file!\n"
+                  <<   "          " << strPath << "\n";
+        return false;
+    }
+
+    this->strFile = strPath;
+    return true;
+}
+
+//*
+//* End of FactorCache::save
+//***************************************************************************
@@ -0,0 +1,83 @@
+/*
+ * FactorCache.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#ifndef FACTORCACHE_HPP_
+#define FACTORCACHE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Factored System Stiffness Matrix Cache...
+//
+//   A decomposed Skyline SSM is stored on disk with the node sequence that
+//   ordered it, named by a key hashed from the structure.  A later run of
+//   the same structure memory maps the file instead of resequencing and
+//   decomposing.  A file is only used when its header (magic, version,
+//   byte order, key and sizes) and payload checksum all agree, so a stale,
+//   foreign or damaged file is simply refactored and replaced.  Files are
+//   written to a temporary name and renamed into place, so a reader never
+//   sees a partial file.
+
+class FactorCache
+{
+public:
+    static const std::uint32_t uiVersion = 2;   // Bump when the factor or layout changes
+
+    FactorCache(void);
+    ~FactorCache(void);
+    void clear(void);
+
+    void setDirectory(std::string);
+    std::string getDirectory(void);
+    bool isEnabled(void);
+    std::string getFile(void);
+
+    static std::uint64_t hashStart(void);
+    static std::uint64_t hash(std::uint64_t, std::uint64_t);
+    static std::uint64_t hash(std::uint64_t, double);
+
+    bool open(std::uint64_t, int, std::vector<int> &);
+    bool isOpen(void);
+    int getMatrixSize(void);
+    int getBandwidth(void);
+    std::size_t getArraySize(void);
+    const double * getLocation(void);
+    const double * getPivotInverse(void);
+
+    bool save(std::uint64_t, const std::vector<int> &, int, int,
+              std::size_t, const double *, const double *);
+
+private:
+    struct Header
+    {
+        char acMagic[8];            // "CAPSSSM"
+        std::uint32_t uiVersion;    // Cache layout version
+        std::uint32_t uiByteOrder;  // 0x01020304 in the writer's byte order
+        std::uint64_t uiKey;        // Structure key
+        std::int32_t iNodes;        // Node count
+        std::int32_t iMatrixSize;   // Matrix Side
+        std::int32_t iBandwidth;    // Bandwidth
+        std::uint32_t uiPad;
+        std::uint64_t uiArraySize;  // Skyline (Profile) entries
+        std::uint64_t uiChecksum;   // Payload checksum
+        std::uint64_t uiReserved;
+    };
+
+    std::string strDirectory;       // Cache directory ("" = bypass)
+    std::string strFile;            // File last mapped or saved ("" = none)
+    void * pMap;                    // Mapped file
+    std::size_t uiMapSize;          // Mapped file size
+    const Header * header;          // Mapped header
+
+    std::string path(std::uint64_t);
+    static std::size_t payloadSize(int, int, std::size_t);
+    static std::uint64_t checksum(const void *, std::size_t);
+};
+
+#endif /* FACTORCACHE_HPP_ */
@@ -0,0 +1,135 @@
+/*
+ * IDTable.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#ifndef IDTABLE_HPP_
+#define IDTABLE_HPP_
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+// ID Lookup Table for the structure's items (Nodes, Members, Member Properties)...
+//
+//   Items are found by their iID.  When the IDs are near a count of the
+//   items (as input numbering usually is), the table is a dense vector
+//   indexed by ID - lowest ID.  Otherwise, it is a hash map.  Like a search
+//   of the item list, the first item of a repeated ID is found.
+
+template <typename Item>
+class IDTable
+{
+public:
+    static const int iSparseSlack = 16;     // Dense: ID range may exceed twice the items by this
+
+    IDTable(void)
+    {
+        this->clear();
+    }
+
+    ~IDTable(void)
+    {
+        this->clear();
+    }
+
+    void clear(void)
+    {
+        this->iLowID = 0;
+        this->uiItems = 0;
+        this->bDense = true;
+        this->vectDense.clear();
+        this->mapSparse.clear();
+    }
+
+    //***************************************************************************
+    //*
+    //* IDTable::create
+    //*     This function indexes the given items by their IDs.
+    //*
+    //***************************************************************************
+
+    void create(std::vector<Item *> & vectItems)
+    {
+        this->clear();
+        this->uiItems = vectItems.size();
+        if ( vectItems.empty() )
+            return;
+
+        long int liLowID = vectItems[0]->iID;
+        long int liHighID = vectItems[0]->iID;
+        for (Item * itemCurr : vectItems)
+        {
+            if (liLowID > itemCurr->iID)
+                liLowID = itemCurr->iID;
+            if (liHighID < itemCurr->iID)
+                liHighID = itemCurr->iID;
+        }
+
+        this->iLowID = (int) liLowID;
+        this->bDense = ( (std::size_t) (liHighID - liLowID) < 2 * vectItems.size() + IDTable::iSparseSlack );
+        if (this->bDense)
+        {
+            this->vectDense.assign( (std::size_t) (liHighID - liLowID) + 1, nullptr );
+            for (Item * itemCurr : vectItems)
+            {
+                Item * & itemSlot = this->vectDense[ (std::size_t) ( (long int) itemCurr->iID - liLowID ) ];
+                if (itemSlot == nullptr) // ...first of the ID
+                    itemSlot = itemCurr;
+            }
+        }
+        else
+        {
+            this->mapSparse.reserve( vectItems.size() );
+            for (Item * itemCurr : vectItems)
+                this->mapSparse.emplace(itemCurr->iID, itemCurr); // ...first of the ID
+        }
+    }
+
+    //*
+    //* End of IDTable::create
+    //***************************************************************************
+
+    //***************************************************************************
+    //*
+    //* IDTable::find
+    //*     This function finds the item of the given ID (nullptr if none).
+    //*
+    //***************************************************************************
+
+    Item * find(int iID)
+    {
+        if (this->bDense)
+        {
+            long int liSlot = (long int) iID - this->iLowID;
+            if ( liSlot < 0 || (std::size_t) liSlot >= this->vectDense.size() )
+                return nullptr;
+            return this->vectDense[ (std::size_t) liSlot ];
+        }
+
+        auto iterItem = this->mapSparse.find(iID);
+        if ( iterItem == this->mapSparse.end() )
+            return nullptr;
+        return iterItem->second;
+    }
+
+    //*
+    //* End of IDTable::find
+    //***************************************************************************
+
+    bool isEmpty(void)
+    {
+        return (this->uiItems == 0);
+    }
+
+private:
+    int iLowID;                             // Dense: lowest ID
+    std::size_t uiItems;                    // Items indexed
+    bool bDense;                            // Dense vector, else hash map
+    std::vector<Item *> vectDense;          // Dense: item of each ID - lowest ID
+    std::unordered_map<int, Item *> mapSparse; // Sparse: item of each ID
+};
+
+#endif /* IDTABLE_HPP_ */
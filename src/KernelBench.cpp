@@ -0,0 +1,252 @@
+/*
+ * KernelBench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+//***************************************************************************
+//*
+//* CAPS SSM Kernel Benchmark
+//*     This program times the Skyline decomposition and solution of a
+//*     synthetic System Stiffness Matrix using the original scalar loop
+//*     (dividing by each pivot) against the StiffnessKernel kernels
+//*     (multiplying by the pivot reciprocals).
+//*
+//*     Usage: caps_bench [matrix_side [bandwidth [repeats]]]
+//*
+//***************************************************************************
+
+#include "StiffnessKernel.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+struct Skyline
+{
+    int iSize;
+    std::vector<int> aiSkyline;         // first nonzero row of each column
+    std::vector<size_t> auiColumnTop;   // position of each column's first entry
+    std::vector<double> adLocation;     // Skyline entries
+};
+
+static Skyline createSkyline(int iSize, int iBandwidth)
+{
+    Skyline sky;
+    sky.iSize = iSize;
+    sky.aiSkyline.resize(iSize);
+    sky.auiColumnTop.resize(iSize);
+
+    // Ragged column heights up to the bandwidth...
+    size_t uiPosition = 0;
+    for (int iCol = 0; iCol < iSize; iCol++)
+    {
+        int iHeight = iBandwidth - (iCol * 7919) % (iBandwidth / 2 + 1);
+        int iTop = iCol - iHeight + 1;
+        sky.aiSkyline[iCol] = (iTop < 0) ? 0 : iTop;
+        sky.auiColumnTop[iCol] = uiPosition;
+        uiPosition += iCol - sky.aiSkyline[iCol] + 1;
+    }
+
+    // Diagonally dominant entries...
+    sky.adLocation.resize(uiPosition);
+    unsigned int uiSeed = 12345;
+    for (int iCol = 0; iCol < iSize; iCol++)
+    {
+        size_t uiTop = sky.auiColumnTop[iCol];
+        int iCount = iCol - sky.aiSkyline[iCol];
+        for (int iIndex = 0; iIndex < iCount; iIndex++)
+        {
+            uiSeed = uiSeed * 1103515245u + 12345u;
+            sky.adLocation[uiTop + iIndex] = ( (double) (uiSeed >> 16 & 0x7FFF) / 32768.0 ) - 0.5;
+        }
+        sky.adLocation[uiTop + iCount] = 2.0 * iBandwidth;
+    }
+
+    return sky;
+}
+
+//***************************************************************************
+//*
+//* Original scalar loop: divide by each pivot.
+//*
+//***************************************************************************
+
+static void decomposeScalarLoop(Skyline & sky, std::vector<double> & adPivot)
+{
+    for (int iCol = 0; iCol < sky.iSize; iCol++)
+    {
+        int iSkyCol = sky.aiSkyline[iCol];
+        double * adCol = sky.adLocation.data() + sky.auiColumnTop[iCol];
+        for (int iRow1 = iSkyCol + 1; iRow1 <= iCol; iRow1++)
+        {
+            int iSkyRow = sky.aiSkyline[iRow1];
+            int iTop = (iSkyRow > iSkyCol) ? iSkyRow : iSkyCol;
+            const double * pdRow = sky.adLocation.data() + sky.auiColumnTop[iRow1] + (iTop - iSkyRow);
+            const double * pdCol = adCol + (iTop - iSkyCol);
+            const double * pdPivot = adPivot.data() + iTop;
+            double dValue = adCol[iRow1 - iSkyCol];
+            for (int iIndex = 0; iIndex < iRow1 - iTop; iIndex++)
+                dValue -= pdRow[iIndex] * pdCol[iIndex] / pdPivot[iIndex];
+            adCol[iRow1 - iSkyCol] = dValue;
+        }
+        adPivot[iCol] = adCol[iCol - iSkyCol];
+    }
+}
+
+static void solveScalarLoop(Skyline & sky, std::vector<double> & adPivot,
+                            std::vector<double> & adForce, std::vector<double> & adDisplace)
+{
+    for (int iCol = 1; iCol < sky.iSize; iCol++)
+    {
+        int iSkyCol = sky.aiSkyline[iCol];
+        const double * pdCol = sky.adLocation.data() + sky.auiColumnTop[iCol];
+        for (int iIndex = 0; iIndex < iCol - iSkyCol; iIndex++)
+            adForce[iCol] -= pdCol[iIndex] * adForce[iSkyCol + iIndex] / adPivot[iSkyCol + iIndex];
+    }
+    for (int iCol = sky.iSize - 1; iCol >= 0; iCol--)
+    {
+        int iSkyCol = sky.aiSkyline[iCol];
+        const double * pdCol = sky.adLocation.data() + sky.auiColumnTop[iCol];
+        adDisplace[iCol] = adForce[iCol] / adPivot[iCol];
+        for (int iIndex = 0; iIndex < iCol - iSkyCol; iIndex++)
+            adForce[iSkyCol + iIndex] -= pdCol[iIndex] * adDisplace[iCol];
+    }
+}
+
+//***************************************************************************
+//*
+//* Kernel loop: multiply by the hoisted pivot reciprocals.
+//*
+//***************************************************************************
+
+static void decomposeKernel(Skyline & sky, std::vector<double> & adPivotInverse)
+{
+    for (int iCol = 0; iCol < sky.iSize; iCol++)
+    {
+        int iSkyCol = sky.aiSkyline[iCol];
+        double * adCol = sky.adLocation.data() + sky.auiColumnTop[iCol];
+        for (int iRow1 = iSkyCol + 1; iRow1 <= iCol; iRow1++)
+        {
+            int iSkyRow = sky.aiSkyline[iRow1];
+            int iTop = (iSkyRow > iSkyCol) ? iSkyRow : iSkyCol;
+            adCol[iRow1 - iSkyCol] -=
+                    StiffnessKernel::dot( sky.adLocation.data() + sky.auiColumnTop[iRow1] + (iTop - iSkyRow),
+                                          adCol + (iTop - iSkyCol),
+                                          adPivotInverse.data() + iTop,
+                                          iRow1 - iTop );
+        }
+        adPivotInverse[iCol] = 1.0 / adCol[iCol - iSkyCol];
+    }
+}
+
+static void solveKernel(Skyline & sky, std::vector<double> & adPivotInverse,
+                        std::vector<double> & adForce, std::vector<double> & adDisplace)
+{
+    for (int iCol = 1; iCol < sky.iSize; iCol++)
+    {
+        int iSkyCol = sky.aiSkyline[iCol];
+        adForce[iCol] -= StiffnessKernel::dot( sky.adLocation.data() + sky.auiColumnTop[iCol],
+                                               adForce.data() + iSkyCol,
+                                               adPivotInverse.data() + iSkyCol,
+                                               iCol - iSkyCol );
+    }
+    for (int iCol = sky.iSize - 1; iCol >= 0; iCol--)
+    {
+        int iSkyCol = sky.aiSkyline[iCol];
+        adDisplace[iCol] = adForce[iCol] * adPivotInverse[iCol];
+        StiffnessKernel::axpy( adForce.data() + iSkyCol,
+                               sky.adLocation.data() + sky.auiColumnTop[iCol],
+                               adDisplace[iCol],
+                               iCol - iSkyCol );
+    }
+}
+
+//***************************************************************************
+//*
+//* Timing
+//*
+//***************************************************************************
+
+static double timeRun(const Skyline & skyOriginal, int iRepeats, bool bKernel, std::vector<double> & adDisplace)
+{
+    double dBest = 0.0;
+    for (int iRepeat = 0; iRepeat < iRepeats; iRepeat++)
+    {
+        Skyline sky = skyOriginal;
+        std::vector<double> adPivot(sky.iSize);
+        std::vector<double> adForce(sky.iSize, 1.0);
+        adDisplace.assign(sky.iSize, 0.0);
+
+        auto tStart = std::chrono::steady_clock::now();
+        if (bKernel)
+        {
+            decomposeKernel(sky, adPivot);
+            solveKernel(sky, adPivot, adForce, adDisplace);
+        }
+        else
+        {
+            decomposeScalarLoop(sky, adPivot);
+            solveScalarLoop(sky, adPivot, adForce, adDisplace);
+        }
+        auto tEnd = std::chrono::steady_clock::now();
+
+        double dTime = std::chrono::duration<double, std::milli>(tEnd - tStart).count();
+        if (iRepeat == 0 || dTime < dBest)
+            dBest = dTime;
+    }
+    return dBest;
+}
+
+int main(int iArgCount, char * astrArgs[])
+{
+    int iSize = (iArgCount > 1) ? std::atoi(astrArgs[1]) : 3000;
+    int iBandwidth = (iArgCount > 2) ? std::atoi(astrArgs[2]) : 300;
+    int iRepeats = (iArgCount > 3) ? std::atoi(astrArgs[3]) : 5;
+    if (iSize < 2 || iBandwidth < 2 || iBandwidth > iSize || iRepeats < 1)
+    {
+        std::cerr << "\n ERROR: Usage: caps_bench [matrix_side [bandwidth [repeats]]]\n";
+        return 1;
+    }
+
+    Skyline sky = createSkyline(iSize, iBandwidth);
+    std::cout << " Skyline: " << iSize << " side, " << iBandwidth << " band, "
+              << sky.adLocation.size() << " entries, best of " << iRepeats << "\n\n";
+
+    std::vector<double> adLoop, adScalar, adBest;
+    double dLoop = timeRun(sky, iRepeats, false, adLoop);
+
+    StiffnessKernel::selectScalar();
+    double dScalar = timeRun(sky, iRepeats, true, adScalar);
+
+    StiffnessKernel::select();
+    double dBest = timeRun(sky, iRepeats, true, adBest);
+
+    // Compare displacements...
+    double dDiffLoop = 0.0;
+    bool bIdentical = true;
+    for (int iIndex = 0; iIndex < iSize; iIndex++)
+    {
+        double dDiff = std::fabs(adBest[iIndex] - adLoop[iIndex]) / std::fabs(adLoop[iIndex]);
+        if (dDiff > dDiffLoop)
+            dDiffLoop = dDiff;
+        if (adBest[iIndex] != adScalar[iIndex])
+            bIdentical = false;
+    }
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "   Original scalar loop : " << std::setw(10) << dLoop   << " ms\n"
+              << "   Kernel (Scalar)      : " << std::setw(10) << dScalar << " ms  x"
+              << dLoop / dScalar << "\n"
+              << "   Kernel (" << std::setw(7) << std::left << StiffnessKernel::getName() << std::right
+              << ")     : " << std::setw(10) << dBest << " ms  x" << dLoop / dBest << "\n\n"
+              << std::scientific << std::setprecision(3)
+              << "   Max relative displacement difference from original loop: " << dDiffLoop << "\n"
+              << "   Kernel results identical to Scalar kernel: " << (bIdentical ? "YES" : "NO") << "\n";
+
+    return bIdentical ? 0 : 1;
+}
@@ -0,0 +1,60 @@
+/*
+ * LoadCase.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#include "LoadCase.hpp"
+
+LoadCase::LoadCase(void)
+{
+    this->clear();
+}
+
+LoadCase::~LoadCase(void)
+{
+    this->clear();
+}
+
+void LoadCase::clear(void)
+{
+    this->li.clear();
+
+    for (LoadPoint * plCurr : this->pl)
+        delete plCurr;
+    this->pl.clear();
+
+    for (LoadUniform * ulCurr : this->ul)
+        delete ulCurr;
+    this->ul.clear();
+
+    for (LoadNodal * nlCurr : this->nl)
+        delete nlCurr;
+    this->nl.clear();
+
+    for (LoadTrapezoidal * tlCurr : this->tl)
+        delete tlCurr;
+    this->tl.clear();
+
+    this->bWarnTPIConcLoad = false;
+    this->bWarnTPITrapLoad = false;
+    this->bLoaded = false;
+    this->combo = nullptr;
+
+    for (std::vector<ConcentratedSystem *> & vectConc : this->conc)
+        for (ConcentratedSystem * concCurr : vectConc)
+            delete concCurr;
+    this->conc.clear();
+
+    for (std::vector<DistributedSystem *> & vectDist : this->dist)
+        for (DistributedSystem * distCurr : vectDist)
+            delete distCurr;
+    this->dist.clear();
+
+    this->bProcessed = false;
+    this->adCombinedExt[0] = 0.0;
+    this->adCombinedExt[1] = 0.0;
+    this->adCombinedExt[2] = 0.0;
+    this->adGlobalForce.clear();
+}
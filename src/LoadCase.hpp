@@ -0,0 +1,56 @@
+/*
+ * LoadCase.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#ifndef LOADCASE_HPP_
+#define LOADCASE_HPP_
+
+#include "LoadAndInteraction.hpp"
+#include "LoadPoint.hpp"
+#include "LoadUniform.hpp"
+#include "LoadNodal.hpp"
+#include "LoadTrapezoidal.hpp"
+#include "LoadCombination.hpp"
+#include "ConcentratedSystem.hpp"
+#include "DistributedSystem.hpp"
+
+#include <vector>
+
+// Load Case Definition...
+//
+//   Holds a loading condition read ahead of its analysis so all of the
+//   structure's load cases can be solved together.  A basic case also keeps
+//   its processed loading so it is not processed again for its analysis.
+//   A Load Combination's case holds the factored loads of its basic load
+//   cases.
+
+class LoadCase
+{
+public:
+    LoadAndInteraction li;                  // Load and interaction equation
+    std::vector<LoadPoint *> pl;            // Concentrated (point on member) Load
+    std::vector<LoadUniform *> ul;          // Uniform Load
+    std::vector<LoadNodal *> nl;            // Nodal (point at node) Load
+    std::vector<LoadTrapezoidal *> tl;      // Trapezoidal Load
+
+    bool bWarnTPIConcLoad;                  // Concentrated Loads ignored (TPI)
+    bool bWarnTPITrapLoad;                  // Trapezoidal Loads ignored (TPI)
+    bool bLoaded;                           // Force Matrix assembled?
+    LoadCombination * combo;                // Combination of basic Load Cases (nullptr = basic)
+
+    // Processed loading kept from the read ahead (see PlaneFrame::storeLoadCase)...
+    bool bProcessed;                        // Processed loading kept?
+    double adCombinedExt[3];                // Combined External Forces (Horz, Vert, Rot)
+    std::vector<std::vector<ConcentratedSystem *>> conc;    // Members' Concentrated Load Systems
+    std::vector<std::vector<DistributedSystem *>> dist;     // Members' Distributed Load Systems
+    std::vector<double> adGlobalForce;      // Members' Global Force Systems (6 per Member)
+
+    LoadCase(void);
+    ~LoadCase(void);
+    void clear(void);
+};
+
+#endif /* LOADCASE_HPP_ */
@@ -0,0 +1,140 @@
+/*
+ * LoadCombination.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#include "LoadCombination.hpp"
+
+#include <climits>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <fmt/format.h>
+
+LoadCombination::LoadCombination(void)
+{
+    this->clear();
+}
+
+LoadCombination::~LoadCombination(void)
+{
+    this->clear();
+}
+
+void LoadCombination::clear(void)
+{
+    this->siNumber = 0;
+    this->strLabel.clear();
+    this->vectCase.clear();
+    this->vectFactor.clear();
+}
+
+std::string LoadCombination::report(void)
+{
+    std::string strReport;
+    for (std::size_t uiTerm = 0; uiTerm < this->vectCase.size(); uiTerm++)
+    {
+        if (uiTerm > 0)
+            strReport += " + ";
+        strReport += fmt::format( "{:.3f} x LC {:d}", this->vectFactor[uiTerm], this->vectCase[uiTerm] );
+    }
+    if ( ! this->strLabel.empty() )
+        strReport = this->strLabel + " = " + strReport;
+
+    return strReport;
+}
+
+//***************************************************************************
+//*
+//* LoadCombination::readFile
+//*     This function reads the Load Combinations of the given side file
+//*     (see LoadCombination.hpp for its format).
+//*
+//***************************************************************************
+
+bool LoadCombination::readFile(std::string & strFile, std::vector<LoadCombination *> & vectCombos)
+{
+    std::ifstream ifsFile(strFile);
+    if ( ! ifsFile.good() )
+    {
+        std::cerr << "\n ERROR: Could not open " << strFile << " for Load Combinations!" << std::endl;
+        return false;
+    }
+
+    std::string strLine;
+    int iLine = 0;
+    while ( std::getline(ifsFile, strLine) )
+    {
+        iLine++;
+
+        // Remove any comment...
+        std::size_t uiComment = strLine.find('#');
+        if (uiComment != std::string::npos)
+            strLine.erase(uiComment);
+
+        // Split off any label...
+        std::string strLabel;
+        std::size_t uiLabel = strLine.find(':');
+        if (uiLabel != std::string::npos)
+        {
+            strLabel = strLine.substr(0, uiLabel);
+            strLine.erase(0, uiLabel + 1);
+            strLabel.erase( 0, strLabel.find_first_not_of(" \t") );
+            strLabel.erase( strLabel.find_last_not_of(" \t\r") + 1 );
+        }
+
+        std::stringstream strRead(strLine);
+        LoadCombination * comboNew = new LoadCombination;
+        comboNew->strLabel = strLabel;
+
+        double dFactor;
+        while (strRead >> dFactor)
+        {
+            int iCase = 0;
+            if ( ! (strRead >> iCase) || iCase < 1 || iCase > SHRT_MAX )
+            {
+                std::cerr << "\n ERROR: Load Combination file " << strFile << ", line " << iLine << ":\n"
+                          <<   "        Each factor must be followed by a Load Case number (1 to " << SHRT_MAX << ")!\n";
+                delete comboNew;
+                return false;
+            }
+            comboNew->vectFactor.push_back(dFactor);
+            comboNew->vectCase.push_back( (short int) iCase );
+        }
+        strRead.clear();
+        std::string strRest;
+        if (strRead >> strRest)
+        {
+            std::cerr << "\n ERROR: Load Combination file " << strFile << ", line " << iLine << ":\n"
+                      <<   "        '" << strRest << "' is not a factor!\n";
+            delete comboNew;
+            return false;
+        }
+
+        // Skip blank lines...
+        if ( comboNew->vectCase.empty() )
+        {
+            if ( ! strLabel.empty() )
+            {
+                std::cerr << "\n ERROR: Load Combination file " << strFile << ", line " << iLine << ":\n"
+                          <<   "        Combination " << strLabel << " has no Load Cases!\n";
+                delete comboNew;
+                return false;
+            }
+            delete comboNew;
+            continue;
+        }
+
+        comboNew->siNumber = (short int) ( vectCombos.size() + 1 );
+        vectCombos.push_back(comboNew);
+    }
+
+    return true;
+}
+
+//*
+//* End of LoadCombination::readFile
+//***************************************************************************
@@ -0,0 +1,45 @@
+/*
+ * LoadCombination.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#ifndef LOADCOMBINATION_HPP_
+#define LOADCOMBINATION_HPP_
+
+#include <string>
+#include <vector>
+
+// Load Combination Definition...
+//
+//   A linear combination of the structure's basic load cases, as factors on
+//   the cases (for example, 1.0 D + 0.75 (L + S)).  A combination is not
+//   solved: its displacements are superposed from the basic cases'
+//   solutions, and its member analysis uses the factored basic loads.
+//
+//   The combinations are read from a side file.  Each line (after any '#'
+//   comment) defines a combination as an optional label ending in ':' and
+//   then pairs of a factor and a (1 based) load case:
+//
+//       # Label: Factor Case [Factor Case ...]
+//       D+L:     1.0 1  1.0 2
+//       D+.75LS: 1.0 1  0.75 2  0.75 3
+
+class LoadCombination
+{
+public:
+    short int siNumber;                 // Combination number (1 based, in file order)
+    std::string strLabel;               // Label (may be empty)
+    std::vector<short int> vectCase;    // Basic Load Cases (1 based)
+    std::vector<double> vectFactor;     // Factor of each Load Case
+
+    LoadCombination(void);
+    ~LoadCombination(void);
+    void clear(void);
+    std::string report(void);
+
+    static bool readFile(std::string &, std::vector<LoadCombination *> &);
+};
+
+#endif /* LOADCOMBINATION_HPP_ */
@@ -0,0 +1,149 @@
+/*
+ * LoadMoving.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#include "LoadMoving.hpp"
+
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <fmt/format.h>
+
+LoadMoving::LoadMoving(void)
+{
+    this->clear();
+}
+
+LoadMoving::~LoadMoving(void)
+{
+    this->clear();
+}
+
+void LoadMoving::clear(void)
+{
+    this->vectOffset.clear();
+    this->vectLoadX.clear();
+    this->vectLoadY.clear();
+    this->vectPath.clear();
+    this->dStep = 0.0;
+}
+
+bool LoadMoving::isSet(void)
+{
+    return ( ! this->vectOffset.empty() );
+}
+
+double LoadMoving::getTrainLength(void)
+{
+    double dTrainLength = 0.0;
+    for (double dOffset : this->vectOffset)
+    {
+        if (dOffset > dTrainLength)
+            dTrainLength = dOffset;
+    }
+    return dTrainLength;
+}
+
+std::string LoadMoving::report(void)
+{
+    return fmt::format( "{:d} Loads over {:.3f} in, Path of {:d} Members, Step {:.3f} in",
+                        this->vectOffset.size(), this->getTrainLength(), this->vectPath.size(), this->dStep );
+}
+
+//***************************************************************************
+//*
+//* LoadMoving::readFile
+//*     This function reads the Moving Load train and path of the given
+//*     side file (see LoadMoving.hpp for its format).
+//*
+//***************************************************************************
+
+bool LoadMoving::readFile(std::string & strFile)
+{
+    this->clear();
+
+    std::ifstream ifsFile(strFile);
+    if ( ! ifsFile.good() )
+    {
+        std::cerr << "\n ERROR: Could not open " << strFile << " for the Moving Load!" << std::endl;
+        return false;
+    }
+
+    std::string strLine;
+    int iLine = 0;
+    while ( std::getline(ifsFile, strLine) )
+    {
+        iLine++;
+
+        // Remove any comment...
+        std::size_t uiComment = strLine.find('#');
+        if (uiComment != std::string::npos)
+            strLine.erase(uiComment);
+
+        std::stringstream strRead(strLine);
+        std::string strKey;
+        if ( ! (strRead >> strKey) ) // ...skip blank lines
+            continue;
+
+        bool bRead = true;
+        if (strKey == "load")
+        {
+            double dOffset, dLoadX, dLoadY;
+            bRead = ( (strRead >> dOffset >> dLoadX >> dLoadY) && dOffset >= 0.0 );
+            if (bRead)
+            {
+                this->vectOffset.push_back(dOffset);
+                this->vectLoadX.push_back(dLoadX);
+                this->vectLoadY.push_back(dLoadY);
+            }
+        }
+        else if (strKey == "path")
+        {
+            int iMemberID;
+            while (strRead >> iMemberID)
+                this->vectPath.push_back(iMemberID);
+            bRead = strRead.eof();
+        }
+        else if (strKey == "step")
+            bRead = ( (strRead >> this->dStep) && this->dStep > 0.0 );
+        else
+        {
+            std::cerr << "\n ERROR: Moving Load file " << strFile << ", line " << iLine << ":\n"
+                      <<   "        '" << strKey << "' is not load, path or step!\n";
+            return false;
+        }
+
+        // Nothing else may follow...
+        if (bRead)
+        {
+            strRead.clear();
+            std::string strRest;
+            bRead = ! (strRead >> strRest);
+        }
+        if ( ! bRead )
+        {
+            std::cerr << "\n ERROR: Moving Load file " << strFile << ", line " << iLine << ":\n"
+                      <<   "        Expected: load Offset (0 or more) LoadX LoadY\n"
+                      <<   "                  path Member [Member ...]\n"
+                      <<   "                  step Length (more than 0)\n";
+            return false;
+        }
+    }
+
+    if ( this->vectOffset.empty() || this->vectPath.empty() || this->dStep == 0.0 )
+    {
+        std::cerr << "\n ERROR: Moving Load file " << strFile << "\n"
+                  <<   "        needs a load, a path and a step!\n";
+        return false;
+    }
+
+    return true;
+}
+
+//*
+//* End of LoadMoving::readFile
+//***************************************************************************
@@ -0,0 +1,57 @@
+/*
+ * LoadMoving.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#ifndef LOADMOVING_HPP_
+#define LOADMOVING_HPP_
+
+#include <string>
+#include <vector>
+
+// Moving Load Definition...
+//
+//   A train of Concentrated Loads stepped along a path of Members.  Each
+//   position of the train is a loading of the structure on its own: all
+//   positions are solved together against the structure's single System
+//   Stiffness Matrix factor, and each Member reports the envelope (the
+//   greatest and least values) of its forces and deflection over them.
+//
+//   The train and path are read from a side file.  Each line (after any
+//   '#' comment) starts with a keyword:
+//
+//       # load Offset LoadX LoadY   Load at Offset behind the lead load
+//       # path Member [Member ...]  Members in path order (lines add on)
+//       # step Length               Step of the lead load along the path
+//       load   0.0   0.0  -1000.0
+//       load  48.0   0.0  -1000.0
+//       path  25 26 27 28
+//       step   6.0
+//
+//   The loads are global vectors, as Concentrated Loads.  The path starts
+//   at the end of its first Member away from the second, and each Member
+//   must share a Node with the one before.  The lead load steps from the
+//   start of the path until the last load leaves its end.
+
+class LoadMoving
+{
+public:
+    std::vector<double> vectOffset;     // Offset of each load behind the lead load
+    std::vector<double> vectLoadX;      // X Load of each load
+    std::vector<double> vectLoadY;      // Y Load of each load
+    std::vector<int> vectPath;          // Members of the path (IDs, in path order)
+    double dStep;                       // Step of the lead load along the path
+
+    LoadMoving(void);
+    ~LoadMoving(void);
+    void clear(void);
+    bool isSet(void);
+    double getTrainLength(void);
+    std::string report(void);
+
+    bool readFile(std::string &);
+};
+
+#endif /* LOADMOVING_HPP_ */
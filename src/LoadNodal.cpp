@@ -24,7 +24,7 @@ LoadNodal::~LoadNodal(void)
 
 void LoadNodal::clear(void)
 {
-    siNodeID = 0;
+    iNodeID = 0;
     siLoadDirection = 0;
     dLoad = 0.0;
 }
@@ -39,7 +39,7 @@ std::string LoadNodal::report()
         fmt::vformat(
             strFormat,
             fmt::make_format_args(
-                this->siNodeID, strLoadDir[this->siLoadDirection - 1],
+                this->iNodeID, strLoadDir[this->siLoadDirection - 1],
                 this->dLoad
             )
         );
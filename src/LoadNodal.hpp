@@ -15,7 +15,7 @@
 class LoadNodal
 {
 public:
-    short int siNodeID;             // Node number to be loaded
+    int iNodeID;                   // Node number to be loaded
     short int siLoadDirection;      // Load Direction Indicator
                                     // Load Direction = 1: Force applied in x direction to the node.
                                     //                  2: Force applied in y direction to the node.
@@ -24,8 +24,8 @@ LoadPoint::~LoadPoint(void)
 
 void LoadPoint::clear(void)
 {
-    siMemberID = 0;
-    siID = 0;
+    iMemberID = 0;
+    iID = 0;
     adLoadVect[0] = 0.0;
     adLoadVect[1] = 0.0;
     dDistance = 0.0;
@@ -40,7 +40,7 @@ std::string LoadPoint::report()
         fmt::vformat(
             strFormat.c_str(),
             fmt::make_format_args(
-                this->siMemberID, this->siID,
+                this->iMemberID, this->iID,
                 this->adLoadVect[X], this->adLoadVect[Y],
                 this->dDistance
             )
@@ -15,8 +15,8 @@
 class LoadPoint
 {
 public:
-    short int siMemberID;       // Member to be loaded
-    short int siID;             // ID of the PLOAD
+    int iMemberID;             // Member to be loaded
+    int iID;                   // ID of the PLOAD
     double adLoadVect[2];       // Load Vector (x and y load)
     double dDistance;           // Distance to load from neg
 
@@ -24,8 +24,8 @@ LoadTrapezoidal::~LoadTrapezoidal(void)
 
 void LoadTrapezoidal::clear(void)
 {
-    this->siMemberID = 0;
-    this->siID = 0;
+    this->iMemberID = 0;
+    this->iID = 0;
     this->adLoad[0] = 0.0;
     this->adLoad[1] = 0.0;
     this->adDist[0] = 0.0;
@@ -50,7 +50,7 @@ std::string LoadTrapezoidal::report(void)
         fmt::vformat(
             strFormat,
             fmt::make_format_args(
-                this->siMemberID, this->siID,
+                this->iMemberID, this->iID,
                 this->adLoad[X], this->adLoad[Y], //adLoadVect
                 this->adDist[0], this->adDist[1],
                 this->dTheta
@@ -15,8 +15,8 @@
 class LoadTrapezoidal
 {
 public:
-    short int siMemberID;       // Member to be loaded
-    short int siID;             // ID of the load
+    int iMemberID;             // Member to be loaded
+    int iID;                   // ID of the load
     double adLoad[2];           // Load:     0=Start 1=End
     double adDist[2];           // Distance: 0=Start 1=End
     double dTheta;              // Angle of Load to Member
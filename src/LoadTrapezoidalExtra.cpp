@@ -0,0 +1,169 @@
+/*
+ * LoadTrapezoidalExtra.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#include "LoadTrapezoidalExtra.hpp"
+
+#include "SystemDef.hpp"
+
+//***************************************************************************
+//*
+//* LoadTrapezoidalExtra::set
+//*     This function compiles the deflection constants of the given
+//*     trapezoidal load on a Member of the given length.  A load of no
+//*     length is not set (no load).
+//*
+//***************************************************************************
+
+void LoadTrapezoidalExtra::set(LoadTrapezoidal * tlNew, double dLength)
+{
+    // TODO: Verify trapezoidal load calcs and against comparable uniform load since
+    //       a uniform load is a simplified trapezoidal load.
+
+    this->clear();
+
+    double dStart = tlNew->adDist[0]; // ...distance from member's neg end to start of load
+    double dEnd   = tlNew->adDist[1]; // ...distance from member's neg end to end of load
+    double dTLength = dEnd - dStart; // ...length of trapezoidal load
+    //if (dStart != 0.0 || dEnd != 0.0)
+    if (dTLength == 0.0)
+        return;
+
+    this->tl = tlNew;
+
+    double dLength2 = dLength * dLength;
+
+    double dStart2 = dStart  * dStart;
+    double dStart3 = dStart2 * dStart;
+    double dStart4 = dStart3 * dStart;
+    double dStartY = tlNew->adStart[Y];
+
+    double dEnd2 = dEnd * dEnd;
+    double dEndY = tlNew->adEnd[Y];
+
+    double dTLength2 = dTLength  * dTLength;
+    double dTLength3 = dTLength2 * dTLength;
+    double dTLength4 = dTLength3 * dTLength;
+    double dTLength5 = dTLength4 * dTLength;
+
+    //
+    // Start of trapezoidal load not at NegEnd...
+    //
+    // TODO: If dStart == 0.0, so what, shouldn't they calc to 0 since skipping will be 0...they don't!
+    //
+    if (dStart != 0.0)
+    {
+        this->vam1 = dTLength * ((3.0 * dLength - 2.0 * dTLength - 3.0 * dStart) * dEndY +
+                                 (3.0 * dLength -       dTLength - 3.0 * dStart) * dStartY);
+
+        this->mam3 = 10.0 * this->vam1;
+
+        this->mam1 =
+            dTLength * ((-40.0 * dTLength  -  60.0 * dStart) * dLength2 +
+                        ( 45.0 * dTLength2 + 120.0 * dStart * dTLength  + 90.0 * dStart2) * dLength -
+                        ( 12.0 * dTLength3 -  45.0 * dStart * dTLength2 - 60.0 * dStart2 * dTLength - 30.0 * dStart3)) * dEndY +
+            dTLength * ((-20.0 * dTLength  -  60.0 * dStart) * dLength2 +
+                        ( 15.0 * dTLength2 +  60.0 * dStart * dTLength  + 90.0 * dStart2) * dLength -
+                        (  3.0 * dTLength3 -  15.0 * dStart * dTLength2 - 30.0 * dStart2 * dTLength - 30.0 * dStart3)) * dStartY;
+    }
+
+    //
+    // The trapezoidal load...
+    //
+    this->mbm5 =  3.0 * dLength * (dEndY          - dStartY);
+
+    this->mbm4 = 15.0 * dLength * (dEnd * dStartY - dStart * dEndY);
+
+    this->mbm3 = 10.0 * (( 3.0 * dStart2 * dLength - dTLength2 * ( 3.0 * dStart + 3.0 * dLength + 2.0 * dTLength)) * dEndY +
+                         (-3.0 * dEnd2   * dLength + dTLength2 * ( 3.0 * dStart +                        dTLength)) * dStartY);
+
+    this->mbm2 = 30.0 * dLength * dStart2 * ((3.0 * dTLength + dStart) * dStartY -
+                                                               dStart  * dEndY);
+
+    this->mbm1 = (20.0 * dTLength2 * (3.0 * dStart + 2.0 * dTLength) * dLength2 +
+                  15.0 * (dStart4                             - 6.0 * dStart2 * dTLength2 -
+                                    8.0 * dStart  * dTLength3 - 3.0 * dTLength4) * dLength +
+                // or (dTLength3 * (8.0 * dStart              - 3.0 * dTLength)) * dLength + ???
+                  30.0 * dStart3 * dTLength2 +
+                  60.0 * dStart2 * dTLength3 +
+                  45.0 * dStart  * dTLength4 +
+                  12.0           * dTLength5
+                 ) * dEndY +
+                 (20.0 * dTLength2 * (3.0 * dStart +       dTLength) * dLength2 -
+                  15.0 * (dStart4 + 4.0 * dStart3 * dTLength  + 6.0 * dStart2 * dTLength2 +
+                                    4.0 * dStart  * dTLength3 +       dTLength4) * dLength +
+                  30.0 * dStart3 * dTLength2 +
+                  30.0 * dStart2 * dTLength3 +
+                  15.0 * dStart  * dTLength4 +
+                   3.0           * dTLength5
+                 ) * dStartY;
+
+    this->mbm0 = dStart4 * dLength * ((3.0 * dStart + 15.0 * dTLength) * dStartY -
+                                      (3.0 * dStart                  ) * dEndY);
+
+    this->vbm3 = dLength * (dEndY - dStartY);
+
+    this->vbm2 = dLength * (3.0 * dEnd   * dStartY -
+                            3.0 * dStart * dEndY);
+
+    this->vbm1 = ( 3.0 * (dStart2                           - dTLength2) * dLength +
+                   3.0 * dStart * dTLength2 +
+                   2.0 * dTLength3
+                 ) * dEndY +
+                 (-3.0 * (dStart2 + 2.0 * dStart * dTLength + dTLength2) * dLength +
+                   3.0 * dStart * dTLength2 +
+                         dTLength3
+                 ) * dStartY;
+
+    this->vbm0 = dLength * ((dStart3 + 3.0 * dStart2 * dTLength) * dStartY -
+                             dStart3                             * dEndY);
+
+    //
+    // End of trapezoidal load not at PosEnd...
+    //
+    // TODO: If dEnd == dLength, so what, shouldn't they calc to 0 since skipping will be 0...they don't!
+    //
+    if (dEnd != dLength)
+    {
+        this->vcm1 =  dTLength * ((3.0 * dStart +       dTLength) * dStartY +
+                                  (3.0 * dStart + 2.0 * dTLength) * dEndY);
+
+        this->vcm0 = -dLength * this->vcm1;
+
+        this->mcm3 =  10.0 * this->vcm1;
+
+        this->mcm2 = -30.0 * dLength * dTLength * ((3.0 * dStart +       dTLength) * dStartY -
+                                                   (3.0 * dStart + 2.0 * dTLength) * dEndY);
+
+        this->mcm1 = dTLength * ( 30.0 * dStart3 +
+                                  30.0 * dStart2 * dTLength +
+                                  15.0 * dStart  * dTLength2 +
+                                   3.0 * dTLength3 +
+                                  20.0 * (3.0 * dStart + dTLength) * dLength2
+                                ) * dStartY +
+                     dTLength * ( 30.0 * dStart3 +
+                                  60.0 * dStart2 * dTLength +
+                                  45.0 * dStart  * dTLength2 +
+                                  12.0 * dTLength3 +
+                                  20.0 * (3.0 * dStart + 2.0 * dTLength) * dLength2
+                                ) * dEndY;
+
+        this->mcm0 = -dTLength * ( 30.0 * dStart3 +
+                                   30.0 * dStart2 * dTLength +
+                                   15.0 * dStart  * dTLength2 +
+                                    3.0 * dTLength3
+                                 ) * dLength * dStartY -
+                      dTLength * ( 30.0 * dStart3 +
+                                   60.0 * dStart2 * dTLength +
+                                   45.0 * dStart  * dTLength2 +
+                                   12.0 * dTLength3
+                                 ) * dLength * dEndY;
+    }
+}
+
+//*
+//* End of LoadTrapezoidalExtra::set
+//***************************************************************************
@@ -11,6 +11,9 @@
 #include "LoadTrapezoidal.hpp"
 
 // Trapezoidal Load: Deflection calculation storage...
+//
+//   The constants are compiled once for each load of a load case (see
+//   PlaneFrame::binMemberLoads) and held with the Member's other loads.
 
 class LoadTrapezoidalExtra
 {
@@ -46,6 +49,8 @@ public:
         this->vcm0 = this->vcm1 = 0.0;
         this->mcm0 = this->mcm1 = this->mcm2 = this->mcm3 = 0.0;
     }
+
+    void set(LoadTrapezoidal *, double);
 };
 
 #endif /* LOADTRAPEZOIDALEXTRA_HPP_ */
@@ -24,7 +24,7 @@ LoadUniform::~LoadUniform(void)
 
 void LoadUniform::clear(void)
 {
-    siMemberID = 0;
+    iMemberID = 0;
     adLoadVect[0] = 0.0;
     adLoadVect[1] = 0.0;
 }
@@ -38,7 +38,7 @@ std::string LoadUniform::report()
         fmt::vformat(
             strFormat,
             fmt::make_format_args(
-                this->siMemberID,
+                this->iMemberID,
                 this->adLoadVect[X], this->adLoadVect[Y]
             )
         );
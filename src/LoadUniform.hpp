@@ -15,7 +15,7 @@
 class LoadUniform
 {
 public:
-    short int siMemberID;       // Member to be loaded
+    int iMemberID;             // Member to be loaded
     double adLoadVect[2];       // Load Vector (x and y load)
 
     LoadUniform(void);
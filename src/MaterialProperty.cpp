@@ -24,7 +24,7 @@ MaterialProperty::~MaterialProperty(void)
 
 void MaterialProperty::clear(void)
 {
-    this->siID = 0;
+    this->iID = 0;
     this->dMoE_IP = 0.0;
     this->dMoE_PP = 0.0;
     this->dMoE_Axial = 0.0;
@@ -206,7 +206,7 @@ void MaterialProperty::report(std::ostream & osOut, bool bIsSpecialCrossSection,
     osOut << std::right;
 
     // Print the current Material Property Group ID...
-    osOut << "   " << std::setw(3) << this->siID << "  ";
+    osOut << "   " << std::setw(3) << this->iID << "  ";
 
     if ( bIsSpecialCrossSection )
     {
@@ -17,7 +17,7 @@
 class MaterialProperty
 {
 public:
-    short int siID;                 // Group Number
+    int iID;                       // Group Number
     double dMoE_IP;                 // Modulus of Elasticity: In-Plane
     double dMoE_PP;                 // Modulus of Elasticity: Perp-Plane
     double dMoE_Axial;              // Modulus of Elasticity: Axial
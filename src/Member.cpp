@@ -33,10 +33,10 @@ Member::~Member(void)
 
 void Member::clear(void)
 {
-    this->siID = 0;
-    this->siNegNodeID = 0;
-    this->siPosNodeID = 0;
-    this->siMatPropID = 0;
+    this->iID = 0;
+    this->iNegNodeID = 0;
+    this->iPosNodeID = 0;
+    this->iMatPropID = 0;
     this->bJointNeg = false;
     this->bJointPos = false;
     this->dEffColumnLength_IP = 0.0;
@@ -44,6 +44,7 @@ void Member::clear(void)
     this->dEffBendingLength = 0.0;
     this->dVolumeFactor = 0.0;
 
+    this->iIndex = 0;
     this->dLength = 0.0;
     this->dCos = 0.0;
     this->dSin = 0.0;
@@ -60,6 +61,9 @@ void Member::clear(void)
     // Node *nodePos is a reference; deleted by Node
     this->nodePos = nullptr;
 
+    this->me.clear();
+    this->ce.clear();
+
     this->clearLoadAnalysis();
 }
 
@@ -169,36 +173,29 @@ bool Member::isMaterialMachineTested(void)
 //*
 //***************************************************************************
 
-bool Member::process(std::vector<MaterialProperty *> & mps, std::vector<Node *> & nodes)
+bool Member::process(IDTable<MaterialProperty> & tableMatProps, IDTable<Node> & tableNodes)
 {
     //
     // Find Member Property of Member in Member Properties...
     //
 
-    if ( mps.empty() )
+    if ( tableMatProps.isEmpty() )
     {
         std::cerr << "\n ERROR: No Member Properties for Member processing!\n";
         return false;
     }
 
-    if ( nodes.empty() )
+    if ( tableNodes.isEmpty() )
     {
         std::cerr << "\n ERROR: No Nodes for Member processing!\n";
         return false;
     }
 
-    for (MaterialProperty * mpCurr : mps)
-    {
-        if (this->siMatPropID == mpCurr->siID)
-        {
-            // Set Member Property pointer for Member...
-            this->mp = mpCurr;
-            break;
-        }
-    }
+    // Set Member Property pointer for Member...
+    this->mp = tableMatProps.find(this->iMatPropID);
     if (this->mp == nullptr)
     {
-        std::cerr << "\n ERROR: Material property (" << this->siMatPropID << ") in Member (" << this->siID  << ")\n"
+        std::cerr << "\n ERROR: Material property (" << this->iMatPropID << ") in Member (" << this->iID  << ")\n"
                   <<   "        not found in Material Properties!\n";
         return false;
     }
@@ -207,45 +204,31 @@ bool Member::process(std::vector<MaterialProperty *> & mps, std::vector<Node *>
     // Find NEG node of Member in Nodes...
     //
 
-    for (Node * nodeCurr : nodes)
-    {
-        if (this->siNegNodeID == nodeCurr->siID)
-        {
-            // Set Negative Node pointer for Member and Node Sequence...
-            this->nodeNeg = nodeCurr;
-            nodeCurr->siSequence = 1; // ...set node to "Used" (temporary use)
-            nodeCurr->siDegrees++;
-            break;
-        }
-    }
+    // Set Negative Node pointer for Member and Node Sequence...
+    this->nodeNeg = tableNodes.find(this->iNegNodeID);
     if (this->nodeNeg == nullptr)
     {
-        std::cerr << "\n ERROR: Neg Node (" << this->siNegNodeID << ") in  Member (" << this->siID << ")\n"
+        std::cerr << "\n ERROR: Neg Node (" << this->iNegNodeID << ") in  Member (" << this->iID << ")\n"
                   <<   "        not found in Nodes!\n";
         return false;
     }
+    this->nodeNeg->iSequence = 1; // ...set node to "Used" (temporary use)
+    this->nodeNeg->siDegrees++;
 
     //
     // Find POS node of Member in Nodes...
     //
 
-    for (Node * nodeCurr : nodes)
-    {
-        if (this->siPosNodeID == nodeCurr->siID)
-        {
-            // Set Positive Node pointer for Member and Node Sequence...
-            this->nodePos = nodeCurr;
-            nodeCurr->siSequence = 1; // ...set node to "Used" (temporary use)
-            nodeCurr->siDegrees++;
-            break;
-        }
-    }
+    // Set Positive Node pointer for Member and Node Sequence...
+    this->nodePos = tableNodes.find(this->iPosNodeID);
     if (this->nodePos == nullptr)
     {
-        std::cerr << "\n ERROR: Pos Node (" << this->siPosNodeID << ") in  Member (" << this->siID << ")\n"
+        std::cerr << "\n ERROR: Pos Node (" << this->iPosNodeID << ") in  Member (" << this->iID << ")\n"
                   <<   "        not found in Nodes!\n";
         return false;
     }
+    this->nodePos->iSequence = 1; // ...set node to "Used" (temporary use)
+    this->nodePos->siDegrees++;
 
     //
     // Load D Matrix...
@@ -256,7 +239,7 @@ bool Member::process(std::vector<MaterialProperty *> & mps, std::vector<Node *>
     this->dLength = sqrt(X_dist * X_dist + Y_dist * Y_dist);
     if (this->dLength == 0.0)
     {
-        std::cerr << "\n ERROR: Member " << this->siID << " has no length!!\n"
+        std::cerr << "\n ERROR: Member " << this->iID << " has no length!!\n"
                   <<   "        All members must have a length between nodes.\n";
         return false;
     }
@@ -303,9 +286,9 @@ bool Member::process(std::vector<MaterialProperty *> & mps, std::vector<Node *>
 //*
 //***************************************************************************
 
-bool Member::loadMember(std::vector<LoadPoint *> & pl,
-                        std::vector<LoadUniform *> & ul,
-                        std::vector<LoadTrapezoidal *> & tl,
+bool Member::loadMember(std::span<LoadPoint *> pl,
+                        std::span<LoadUniform *> ul,
+                        std::span<LoadTrapezoidal *> tl,
                         double * adForceMatrix)
 {
     double adConcForce[6] = { 0.0 };
@@ -333,9 +316,6 @@ bool Member::loadMember(std::vector<LoadPoint *> & pl,
 
     for (LoadPoint * plCurr : pl)
     {
-        if (plCurr->siMemberID != this->siID)
-            continue;
-
         //
         // Allocate Memory for Concentrated System...
         //
@@ -453,9 +433,6 @@ bool Member::loadMember(std::vector<LoadPoint *> & pl,
 
     for (LoadUniform * ulCurr : ul)
     {
-        if (ulCurr->siMemberID != this->siID)
-            continue;
-
         //
         // Allocate Memory for Distributed System...
         //
@@ -549,121 +526,118 @@ bool Member::loadMember(std::vector<LoadPoint *> & pl,
 
     for (LoadTrapezoidal * tlCurr : tl)
     {
-        if (tlCurr->siMemberID == this->siID)
+        if (tlCurr->adDist[0] != 0.0 || tlCurr->adDist[1] != 0.0)
         {
-            if (tlCurr->adDist[0] != 0.0 || tlCurr->adDist[1] != 0.0)
-            {
-                double dLengthStart = 0.0;
-                double dVectorStart[2] = { 0.0 };
-                double dLengthEnd = 0.0;
-                double dVectorEnd[2] = { 0.0 };
+            double dLengthStart = 0.0;
+            double dVectorStart[2] = { 0.0 };
+            double dLengthEnd = 0.0;
+            double dVectorEnd[2] = { 0.0 };
 
-                // (0 && 0), (0 && 1), (1 && 1)
-                if ( ! this->bJointNeg || this->bJointPos )
-                {
-                    dLengthStart = tlCurr->adDist[0];
-                    dLengthEnd   = this->dLength - tlCurr->adDist[1];
-                    dVectorStart[X] = tlCurr->adStart[X];
-                    dVectorStart[Y] = tlCurr->adStart[Y];
-                    dVectorEnd[X]   = tlCurr->adEnd[X];
-                    dVectorEnd[Y]   = tlCurr->adEnd[Y];
-                }
-                // (1 && 0)
-                else // (this->neg_joint && ! this->pos_joint)
-                {   // SWAP...
-                    dLengthStart = this->dLength - tlCurr->adDist[1];
-                    dLengthEnd   = tlCurr->adDist[0];
-                    dVectorStart[X] = tlCurr->adEnd[X];
-                    dVectorStart[Y] = tlCurr->adEnd[Y];
-                    dVectorEnd[X]   = tlCurr->adStart[X];
-                    dVectorEnd[Y]   = tlCurr->adStart[Y];
-                }
+            // (0 && 0), (0 && 1), (1 && 1)
+            if ( ! this->bJointNeg || this->bJointPos )
+            {
+                dLengthStart = tlCurr->adDist[0];
+                dLengthEnd   = this->dLength - tlCurr->adDist[1];
+                dVectorStart[X] = tlCurr->adStart[X];
+                dVectorStart[Y] = tlCurr->adStart[Y];
+                dVectorEnd[X]   = tlCurr->adEnd[X];
+                dVectorEnd[Y]   = tlCurr->adEnd[Y];
+            }
+            // (1 && 0)
+            else // (this->neg_joint && ! this->pos_joint)
+            {   // SWAP...
+                dLengthStart = this->dLength - tlCurr->adDist[1];
+                dLengthEnd   = tlCurr->adDist[0];
+                dVectorStart[X] = tlCurr->adEnd[X];
+                dVectorStart[Y] = tlCurr->adEnd[Y];
+                dVectorEnd[X]   = tlCurr->adStart[X];
+                dVectorEnd[Y]   = tlCurr->adStart[Y];
+            }
 
-                double dLengthTrap  = tlCurr->adDist[1] - tlCurr->adDist[0];
-                double dLengthTrap2 = dLengthTrap * dLengthTrap;
+            double dLengthTrap  = tlCurr->adDist[1] - tlCurr->adDist[0];
+            double dLengthTrap2 = dLengthTrap * dLengthTrap;
 
-                double dDeltaX = dVectorStart[X] - dVectorEnd[X];
-                double dDeltaY = dVectorStart[Y] - dVectorEnd[Y];
-                double dR1 = dVectorEnd[Y] * dLengthTrap +
-                                   dDeltaY * dLengthTrap / 2.0;
-                double dM1 = dVectorEnd[Y] * dLengthTrap       * (dLengthStart + dLengthTrap / 2.0) +
-                                   dDeltaY * dLengthTrap / 2.0 * (dLengthStart + dLengthTrap / 3.0);
+            double dDeltaX = dVectorStart[X] - dVectorEnd[X];
+            double dDeltaY = dVectorStart[Y] - dVectorEnd[Y];
+            double dR1 = dVectorEnd[Y] * dLengthTrap +
+                               dDeltaY * dLengthTrap / 2.0;
+            double dM1 = dVectorEnd[Y] * dLengthTrap       * (dLengthStart + dLengthTrap / 2.0) +
+                               dDeltaY * dLengthTrap / 2.0 * (dLengthStart + dLengthTrap / 3.0);
 
-                double dX1 = 0.0, dX2 = 0.0, dX4 = 0.0, dX5 = 0.0;
-                if (this->bJointNeg && this->bJointPos) // 1 && 1
+            double dX1 = 0.0, dX2 = 0.0, dX4 = 0.0, dX5 = 0.0;
+            if (this->bJointNeg && this->bJointPos) // 1 && 1
+            {
+                double dTemp = dM1 * dReciprocalLength;
+                dX1 = dTemp - dR1;
+                dX2 = 0.0;
+                dX4 = (-dTemp);
+                dX5 = 0.0;
+            }
+            else // (0 && 0), (0 && 1), (1 && 0)
+            {
+                double start_len2 = dLengthStart * dLengthStart;
+                double start_len3 = dLengthStart * start_len2;
+                double trap_len3 = dLengthTrap * dLengthTrap2;
+
+                double dD1 = ((-dR1) * start_len2 * this->dLength / 2.0 +
+                            dM1 * dLengthStart * this->dLength +
+                            dR1 * start_len3 / 3.0 -
+                            dM1 * start_len2 / 2.0 +
+                            dVectorEnd[Y] * dLengthEnd  * trap_len3 / 6.0 +
+                            dDeltaY * dLengthEnd  * trap_len3 / 24.0 +
+                            dVectorEnd[Y] * dLengthTrap * trap_len3 / 8.0 +
+                            dDeltaY * dLengthTrap * trap_len3 / 30.0) / dEI;
+
+                double dD11 = dLength3 / (3.0 * dEI);
+                if (dShearArea != 0.0)
                 {
-                    double dTemp = dM1 * dReciprocalLength;
-                    dX1 = dTemp - dR1;
-                    dX2 = 0.0;
-                    dX4 = (-dTemp);
-                    dX5 = 0.0;
+                    dD1 += (dVectorEnd[Y] * dLengthTrap2 / 2.0 +
+                            dDeltaY * dLengthTrap2 / 6.0 +
+                            dR1 * dLengthStart) / dShearArea;
+                    dD11 += this->dLength / dShearArea;
                 }
-                else // (0 && 0), (0 && 1), (1 && 0)
+
+                // For // (0 && 1), (1 && 0)
+                double dTemp4 = dD1 / dD11;
+                double dTemp5 = 0.0;
+                if ( ! this->bJointNeg && ! this->bJointPos ) // (0 && 0)
                 {
-                    double start_len2 = dLengthStart * dLengthStart;
-                    double start_len3 = dLengthStart * start_len2;
-                    double trap_len3 = dLengthTrap * dLengthTrap2;
-
-                    double dD1 = ((-dR1) * start_len2 * this->dLength / 2.0 +
-                                dM1 * dLengthStart * this->dLength +
-                                dR1 * start_len3 / 3.0 -
-                                dM1 * start_len2 / 2.0 +
-                                dVectorEnd[Y] * dLengthEnd  * trap_len3 / 6.0 +
-                                dDeltaY * dLengthEnd  * trap_len3 / 24.0 +
-                                dVectorEnd[Y] * dLengthTrap * trap_len3 / 8.0 +
-                                dDeltaY * dLengthTrap * trap_len3 / 30.0) / dEI;
-
-                    double dD11 = dLength3 / (3.0 * dEI);
-                    if (dShearArea != 0.0)
-                    {
-                        dD1 += (dVectorEnd[Y] * dLengthTrap2 / 2.0 +
-                                dDeltaY * dLengthTrap2 / 6.0 +
-                                dR1 * dLengthStart) / dShearArea;
-                        dD11 += this->dLength / dShearArea;
-                    }
-
-                    // For // (0 && 1), (1 && 0)
-                    double dTemp4 = dD1 / dD11;
-                    double dTemp5 = 0.0;
-                    if ( ! this->bJointNeg && ! this->bJointPos ) // (0 && 0)
-                    {
-                        double d2 = ((-dR1) * start_len2 / 2.0 +
-                                     dM1 * dLengthStart +
-                                     dVectorEnd[Y]  * trap_len3 / 6.0 +
-                                     dDeltaY * trap_len3 / 24.0) / dEI;
-                        double d12 = dLength2 / (2.0 * dEI);
-                        double d22 = this->dLength / dEI;
-                        dTemp5 = ((-d2) + d12 * dD1 / dD11) / (d22 - (d12 * d12) / dD11);
-                        dTemp4 = (dD1 + d12 * dTemp5) / dD11;
-                    }
-
-                    // For (0 && 1), (0 && 0)
-                    dX1 = dTemp4 - dR1;
-                    dX2 = (-(dM1 + dTemp5 - dTemp4 * this->dLength));
-                    dX4 = (-dTemp4);
-                    dX5 = dTemp5;
-
-                    if ( this->bJointNeg && ! this->bJointPos ) // (1 && 0)
-                    {   // SWAP BACK...
-                        dX4 = dX1;
-                        dX5 = (-dX2);
-                        dX1 = (-dTemp4);
-                        dX2 = 0.0;
-                    }
+                    double d2 = ((-dR1) * start_len2 / 2.0 +
+                                 dM1 * dLengthStart +
+                                 dVectorEnd[Y]  * trap_len3 / 6.0 +
+                                 dDeltaY * trap_len3 / 24.0) / dEI;
+                    double d12 = dLength2 / (2.0 * dEI);
+                    double d22 = this->dLength / dEI;
+                    dTemp5 = ((-d2) + d12 * dD1 / dD11) / (d22 - (d12 * d12) / dD11);
+                    dTemp4 = (dD1 + d12 * dTemp5) / dD11;
                 }
 
-                double dForceApplied =
-                    ((dVectorStart[X] / 2.0 - dDeltaX / 6.0) * dLengthTrap2 * dReciprocalLength +
-                      dVectorStart[X] * dLengthTrap * dLengthEnd * dReciprocalLength -
-                      dDeltaX  * dLengthTrap * dLengthEnd * dReciprocalLength / 2.0);
-
-                adDistForce[0] -= dForceApplied;
-                adDistForce[1] += dX1;
-                adDistForce[2] += dX2;
-                adDistForce[3] += (dForceApplied - (dVectorStart[X] + dVectorEnd[X]) * dLengthTrap / 2.0);
-                adDistForce[4] += dX4;
-                adDistForce[5] += dX5;
+                // For (0 && 1), (0 && 0)
+                dX1 = dTemp4 - dR1;
+                dX2 = (-(dM1 + dTemp5 - dTemp4 * this->dLength));
+                dX4 = (-dTemp4);
+                dX5 = dTemp5;
+
+                if ( this->bJointNeg && ! this->bJointPos ) // (1 && 0)
+                {   // SWAP BACK...
+                    dX4 = dX1;
+                    dX5 = (-dX2);
+                    dX1 = (-dTemp4);
+                    dX2 = 0.0;
+                }
             }
+
+            double dForceApplied =
+                ((dVectorStart[X] / 2.0 - dDeltaX / 6.0) * dLengthTrap2 * dReciprocalLength +
+                  dVectorStart[X] * dLengthTrap * dLengthEnd * dReciprocalLength -
+                  dDeltaX  * dLengthTrap * dLengthEnd * dReciprocalLength / 2.0);
+
+            adDistForce[0] -= dForceApplied;
+            adDistForce[1] += dX1;
+            adDistForce[2] += dX2;
+            adDistForce[3] += (dForceApplied - (dVectorStart[X] + dVectorEnd[X]) * dLengthTrap / 2.0);
+            adDistForce[4] += dX4;
+            adDistForce[5] += dX5;
         }
     }
 
@@ -707,8 +681,8 @@ void Member::calcForces(double * adDisplaceGlobal)
 //*
 //***************************************************************************
 
-bool Member::calcDeflection(bool bSpecialCrossSection, double * adGlobalDisplace, std::vector<LoadTrapezoidal *> & tl,
-                                        short int siDivisions)
+bool Member::calcDeflection(bool bSpecialCrossSection, double * adGlobalDisplace, std::span<LoadTrapezoidalExtra> tle,
+                            short int siDivisions)
 {
     // No calculation required for Fictitious & NOT Special Cross-Section...
     if ( this->mp->isFictitious() && ! bSpecialCrossSection)
@@ -724,163 +698,6 @@ bool Member::calcDeflection(bool bSpecialCrossSection, double * adGlobalDisplace
     double adLocalDisplace[6] = { 0.0 };
     this->translateGlobalToLocal(adLocalDisplace, adGlobalDisplace);
 
-    //
-    // Compile Trapezoidal Load Constants for Member...
-    //
-    // TODO: Verify trapezoidal load calcs and against comparable uniform load since
-    //       a uniform load is a simplified trapezoidal load.
-    //
-    std::vector<LoadTrapezoidalExtra *> tle;
-    for (LoadTrapezoidal * tlCurr : tl)
-    {
-        if (tlCurr->siMemberID == this->siID)
-        {
-            double dStart = tlCurr->adDist[0]; // ...distance from member's neg end to start of load
-            double dEnd   = tlCurr->adDist[1]; // ...distance from member's neg end to end of load
-            double dTLength = dEnd - dStart; // ...length of trapezoidal load
-            //if (dStart != 0.0 || dEnd != 0.0)
-            if (dTLength != 0.0)
-            {
-                LoadTrapezoidalExtra * tleCurr = new LoadTrapezoidalExtra;
-                if (tleCurr == nullptr)
-                {
-                    std::cerr << "\n ERROR: OUT OF MEMORY!!\n"
-                              << "          Trapezoidal Load Extras!!\n\n";
-                    return false;
-                }
-                tleCurr->tl = tlCurr;
-
-                double dStart2 = dStart  * dStart;
-                double dStart3 = dStart2 * dStart;
-                double dStart4 = dStart3 * dStart;
-                double dStartY = tlCurr->adStart[Y];
-
-                double dEnd2 = dEnd * dEnd;
-                double dEndY = tlCurr->adEnd[Y];
-
-                double dTLength2 = dTLength  * dTLength;
-                double dTLength3 = dTLength2 * dTLength;
-                double dTLength4 = dTLength3 * dTLength;
-                double dTLength5 = dTLength4 * dTLength;
-
-                //
-                // Start of trapezoidal load not at NegEnd...
-                //
-                // TODO: If dStart == 0.0, so what, shouldn't they calc to 0 since skipping will be 0...they don't!
-                //
-                if (dStart != 0.0)
-                {
-                    tleCurr->vam1 = dTLength * ((3.0 * this->dLength - 2.0 * dTLength - 3.0 * dStart) * dEndY +
-                                                (3.0 * this->dLength -       dTLength - 3.0 * dStart) * dStartY);
-
-                    tleCurr->mam3 = 10.0 * tleCurr->vam1;
-
-                    tleCurr->mam1 =
-                        dTLength * ((-40.0 * dTLength  -  60.0 * dStart) * dLength2 +
-                                    ( 45.0 * dTLength2 + 120.0 * dStart * dTLength  + 90.0 * dStart2) * this->dLength -
-                                    ( 12.0 * dTLength3 -  45.0 * dStart * dTLength2 - 60.0 * dStart2 * dTLength - 30.0 * dStart3)) * dEndY +
-                        dTLength * ((-20.0 * dTLength  -  60.0 * dStart) * dLength2 +
-                                    ( 15.0 * dTLength2 +  60.0 * dStart * dTLength  + 90.0 * dStart2) * this->dLength -
-                                    (  3.0 * dTLength3 -  15.0 * dStart * dTLength2 - 30.0 * dStart2 * dTLength - 30.0 * dStart3)) * dStartY;
-                }
-
-                //
-                // The trapezoidal load...
-                //
-                tleCurr->mbm5 =  3.0 * this->dLength * (dEndY          - dStartY);
-
-                tleCurr->mbm4 = 15.0 * this->dLength * (dEnd * dStartY - dStart * dEndY);
-
-                tleCurr->mbm3 = 10.0 * (( 3.0 * dStart2 * this->dLength - dTLength2 * ( 3.0 * dStart + 3.0 * this->dLength + 2.0 * dTLength)) * dEndY +
-                                        (-3.0 * dEnd2   * this->dLength + dTLength2 * ( 3.0 * dStart +                             dTLength)) * dStartY);
-
-                tleCurr->mbm2 = 30.0 * this->dLength * dStart2 * ((3.0 * dTLength + dStart) * dStartY -
-                                                                                    dStart  * dEndY);
-
-                tleCurr->mbm1 = (20.0 * dTLength2 * (3.0 * dStart + 2.0 * dTLength) * dLength2 +
-                                 15.0 * (dStart4                             - 6.0 * dStart2 * dTLength2 -
-                                                   8.0 * dStart  * dTLength3 - 3.0 * dTLength4) * this->dLength +
-                               // or (dTLength3 * (8.0 * dStart              - 3.0 * dTLength)) * this->dLength + ???
-                                 30.0 * dStart3 * dTLength2 +
-                                 60.0 * dStart2 * dTLength3 +
-                                 45.0 * dStart  * dTLength4 +
-                                 12.0           * dTLength5
-                                ) * dEndY +
-                                (20.0 * dTLength2 * (3.0 * dStart +       dTLength) * dLength2 -
-                                 15.0 * (dStart4 + 4.0 * dStart3 * dTLength  + 6.0 * dStart2 * dTLength2 +
-                                                   4.0 * dStart  * dTLength3 +       dTLength4) * this->dLength +
-                                 30.0 * dStart3 * dTLength2 +
-                                 30.0 * dStart2 * dTLength3 +
-                                 15.0 * dStart  * dTLength4 +
-                                  3.0           * dTLength5
-                                ) * dStartY;
-
-                tleCurr->mbm0 = dStart4 * this->dLength * ((3.0 * dStart + 15.0 * dTLength) * dStartY -
-                                                           (3.0 * dStart                  ) * dEndY);
-
-                tleCurr->vbm3 = this->dLength * (dEndY - dStartY);
-
-                tleCurr->vbm2 = this->dLength * (3.0 * dEnd   * dStartY -
-                                                 3.0 * dStart * dEndY);
-
-                tleCurr->vbm1 = ( 3.0 * (dStart2                           - dTLength2) * this->dLength +
-                                  3.0 * dStart * dTLength2 +
-                                  2.0 * dTLength3
-                                ) * dEndY +
-                                (-3.0 * (dStart2 + 2.0 * dStart * dTLength + dTLength2) * this->dLength +
-                                  3.0 * dStart * dTLength2 +
-                                        dTLength3
-                                ) * dStartY;
-
-                tleCurr->vbm0 = this->dLength * ((dStart3 + 3.0 * dStart2 * dTLength) * dStartY -
-                                                  dStart3                             * dEndY);
-
-                //
-                // End of trapezoidal load not at PosEnd...
-                //
-                // TODO: If dEnd == dLength, so what, shouldn't they calc to 0 since skipping will be 0...they don't!
-                //
-                if (dEnd != this->dLength)
-                {
-                    tleCurr->vcm1 =  dTLength * ((3.0 * dStart +       dTLength) * dStartY +
-                                                 (3.0 * dStart + 2.0 * dTLength) * dEndY);
-
-                    tleCurr->vcm0 = -this->dLength * tleCurr->vcm1;
-
-                    tleCurr->mcm3 =  10.0 * tleCurr->vcm1;
-
-                    tleCurr->mcm2 = -30.0 * this->dLength * dTLength * ((3.0 * dStart +       dTLength) * dStartY -
-                                                                        (3.0 * dStart + 2.0 * dTLength) * dEndY);
-
-                    tleCurr->mcm1 = dTLength * ( 30.0 * dStart3 +
-                                                 30.0 * dStart2 * dTLength +
-                                                 15.0 * dStart  * dTLength2 +
-                                                  3.0 * dTLength3 +
-                                                 20.0 * (3.0 * dStart + dTLength) * dLength2
-                                               ) * dStartY +
-                                    dTLength * ( 30.0 * dStart3 +
-                                                 60.0 * dStart2 * dTLength +
-                                                 45.0 * dStart  * dTLength2 +
-                                                 12.0 * dTLength3 +
-                                                 20.0 * (3.0 * dStart + 2.0 * dTLength) * dLength2
-                                               ) * dEndY;
-
-                    tleCurr->mcm0 = -dTLength * ( 30.0 * dStart3 +
-                                                  30.0 * dStart2 * dTLength +
-                                                  15.0 * dStart  * dTLength2 +
-                                                   3.0 * dTLength3
-                                                ) * this->dLength * dStartY -
-                                     dTLength * ( 30.0 * dStart3 +
-                                                  60.0 * dStart2 * dTLength +
-                                                  45.0 * dStart  * dTLength2 +
-                                                  12.0 * dTLength3
-                                                ) * this->dLength * dEndY;
-                }
-                tle.push_back(tleCurr);
-            }
-        }
-    }
-
     //*
     //* Calculate Max Displacement =
     //*     Sum of (Beam Deflection + Stress Deflection) at division points along Member...
@@ -1009,49 +826,52 @@ bool Member::calcDeflection(bool bSpecialCrossSection, double * adGlobalDisplace
 
         double adm = 0.0;
         double adv = 0.0;
-        for (LoadTrapezoidalExtra * tleCurr : tle)
+        for (LoadTrapezoidalExtra & tleCurr : tle)
         {
-            double dStart = tleCurr->tl->adDist[0];
-            double dEnd   = tleCurr->tl->adDist[1];
+            if (tleCurr.tl == nullptr) // ...no length, no load...
+                continue;
+
+            double dStart = tleCurr.tl->adDist[0];
+            double dEnd   = tleCurr.tl->adDist[1];
             double dTrapLength = dEnd - dStart;
 
             if (dDivLengthNeg < dStart) // Length to Division is before start of trapezoidal load...
             {
-                adm -= (tleCurr->mam3 * dDivLengthNeg3 +
-                        tleCurr->mam1 * dDivLengthNeg
+                adm -= (tleCurr.mam3 * dDivLengthNeg3 +
+                        tleCurr.mam1 * dDivLengthNeg
                        ) / (360.0 * this->dLength);
 
                 if (dShearArea != 0.0) // ...Fictitious check: divide by 0...
-                    adv += tleCurr->vam1 * dDivLengthNeg / (6.0 * this->dLength);
+                    adv += tleCurr.vam1 * dDivLengthNeg / (6.0 * this->dLength);
             }
             else if (dDivLengthNeg <= dEnd) // Length to Division is within trapezoidal load length...
             {
-                adm += (tleCurr->mbm5 * dDivLengthNeg5 +
-                        tleCurr->mbm4 * dDivLengthNeg4 +
-                        tleCurr->mbm3 * dDivLengthNeg3 +
-                        tleCurr->mbm2 * dDivLengthNeg2 +
-                        tleCurr->mbm1 * dDivLengthNeg +
-                        tleCurr->mbm0
+                adm += (tleCurr.mbm5 * dDivLengthNeg5 +
+                        tleCurr.mbm4 * dDivLengthNeg4 +
+                        tleCurr.mbm3 * dDivLengthNeg3 +
+                        tleCurr.mbm2 * dDivLengthNeg2 +
+                        tleCurr.mbm1 * dDivLengthNeg +
+                        tleCurr.mbm0
                        ) / (360.0 * dTrapLength * this->dLength);
 
                 if (dShearArea != 0.0) // ...Fictitious check: divide by 0...
-                    adv -= (tleCurr->vbm3 * dDivLengthNeg3 +
-                            tleCurr->vbm2 * dDivLengthNeg2 +
-                            tleCurr->vbm1 * dDivLengthNeg +
-                            tleCurr->vbm0
+                    adv -= (tleCurr.vbm3 * dDivLengthNeg3 +
+                            tleCurr.vbm2 * dDivLengthNeg2 +
+                            tleCurr.vbm1 * dDivLengthNeg +
+                            tleCurr.vbm0
                            ) / (6.0 * dTrapLength * this->dLength);
             }
             else // Length to Division is after end of trapezoidal load...
             {
-                adm += (tleCurr->mcm3 * dDivLengthNeg3 +
-                        tleCurr->mcm2 * dDivLengthNeg2 +
-                        tleCurr->mcm1 * dDivLengthNeg +
-                        tleCurr->mcm0
+                adm += (tleCurr.mcm3 * dDivLengthNeg3 +
+                        tleCurr.mcm2 * dDivLengthNeg2 +
+                        tleCurr.mcm1 * dDivLengthNeg +
+                        tleCurr.mcm0
                        ) / (360.0 * this->dLength);
 
                 if (dShearArea != 0.0) // ...Fictitious check: divide by 0...
-                    adv -= (tleCurr->vcm1 * dDivLengthNeg +
-                            tleCurr->vcm0
+                    adv -= (tleCurr.vcm1 * dDivLengthNeg +
+                            tleCurr.vcm0
                            ) / (6.0 * this->dLength);
             }
         }
@@ -1071,17 +891,6 @@ bool Member::calcDeflection(bool bSpecialCrossSection, double * adGlobalDisplace
         }
     }
 
-    //
-    // Clear Trapezoidal Load Extras...
-    //
-
-    if ( ! tle.empty() )
-    {
-        for (LoadTrapezoidalExtra * tleCurr : tle)
-            delete tleCurr;
-        tle.clear();
-    }
-
     return true;
 }
 
@@ -2056,7 +1865,7 @@ void Member::calcCompression1991(double dDiagonal[], bool bUsingTPI, double dEnd
 
 double Member::calcColumn(double adDiagonal[])
 {
-    short int siRow1, siRow2;
+    int iRow1, iRow2;
     double dEffectiveLength = 0.0;
     double dX1 = 0.0, dY1 = 0.0, dX2 = 0.0, dY2 = 0.0;
     double dEI, dLengthSqr;
@@ -2067,8 +1876,8 @@ double Member::calcColumn(double adDiagonal[])
     //
 
     dLengthSqr = this->dLength * this->dLength;
-    siRow1 = this->nodeNeg->siRotFlag;
-    siRow2 = this->nodePos->siRotFlag;
+    iRow1 = this->nodeNeg->iRotFlag;
+    iRow2 = this->nodePos->iRotFlag;
 
     dEI = this->mp->dMoE_IP * this->mp->dMoI;
 
@@ -2085,15 +1894,15 @@ double Member::calcColumn(double adDiagonal[])
         dEI2 = dEI / (1.0 + 3.0 * dEI / (this->mp->dShearModulus * this->mp->dArea * dLengthSqr));
     }
 
-    if (siRow1)
+    if (iRow1)
     {
-        dX1 = adDiagonal[siRow1 - 1] - 3.0 * dEI2 / this->dLength;
-        dY1 = adDiagonal[siRow1 - 1] - 4.0 * dEI1 / this->dLength;
+        dX1 = adDiagonal[iRow1 - 1] - 3.0 * dEI2 / this->dLength;
+        dY1 = adDiagonal[iRow1 - 1] - 4.0 * dEI1 / this->dLength;
     }
-    if (siRow2)
+    if (iRow2)
     {
-        dX2 = adDiagonal[siRow2 - 1] - 3.0 * dEI2 / this->dLength;
-        dY2 = adDiagonal[siRow2 - 1] - 4.0 * dEI1 / this->dLength;
+        dX2 = adDiagonal[iRow2 - 1] - 3.0 * dEI2 / this->dLength;
+        dY2 = adDiagonal[iRow2 - 1] - 4.0 * dEI1 / this->dLength;
     }
 
     //
@@ -2109,7 +1918,7 @@ double Member::calcColumn(double adDiagonal[])
 
     else if (this->bJointNeg)
     {
-        if (!siRow2) // Positive End fixed by reaction
+        if (!iRow2) // Positive End fixed by reaction
             dEffectiveLength = this->dLength * 0.7;
         else
         {
@@ -2124,7 +1933,7 @@ double Member::calcColumn(double adDiagonal[])
 
     else if (this->bJointPos)
     {
-        if (!siRow1) // Negative End fixed by reaction
+        if (!iRow1) // Negative End fixed by reaction
             dEffectiveLength = this->dLength * 0.7;
         else
         {
@@ -2139,15 +1948,15 @@ double Member::calcColumn(double adDiagonal[])
 
     else
     {
-        if (!siRow1 && !siRow2) // Both Ends fixed by reaction
+        if (!iRow1 && !iRow2) // Both Ends fixed by reaction
             dEffectiveLength = this->dLength * 0.5;
-        else if (!siRow1) // Negative End fixed by reaction
+        else if (!iRow1) // Negative End fixed by reaction
         {
             dLength1 = this->dLength / 60.0;
             if (dY2 != 0.0)
                 dLength2 = 3.0 * dEI1 / dY2;
         }
-        else if (!siRow2) // Positive End fixed by reaction
+        else if (!iRow2) // Positive End fixed by reaction
         {
             dLength2 = this->dLength / 60.0;
             if (dY1 != 0.0)
@@ -2205,42 +2014,42 @@ double Member::calcColumn(double adDiagonal[])
 
 void Member::translateLocalToGlobal(double * adLocal, double * adGlobal)
 {
-    if (this->nodeNeg->siHorzFlag)
+    if (this->nodeNeg->iHorzFlag)
     {
-        adGlobal[this->nodeNeg->siHorzFlag - 1] +=
+        adGlobal[this->nodeNeg->iHorzFlag - 1] +=
                 adLocal[0] * this->adNodeVectorNeg[X] -
                 adLocal[1] * this->adNodeVectorNeg[Y];
     }
 
-    if (this->nodeNeg->siVertFlag)
+    if (this->nodeNeg->iVertFlag)
     {
-        adGlobal[this->nodeNeg->siVertFlag - 1] +=
+        adGlobal[this->nodeNeg->iVertFlag - 1] +=
                 adLocal[1] * this->adNodeVectorNeg[X] +
                 adLocal[0] * this->adNodeVectorNeg[Y];
     }
 
-    if (this->nodeNeg->siRotFlag)
+    if (this->nodeNeg->iRotFlag)
     {
-        adGlobal[this->nodeNeg->siRotFlag - 1] += adLocal[2];
+        adGlobal[this->nodeNeg->iRotFlag - 1] += adLocal[2];
     }
 
-    if (this->nodePos->siHorzFlag)
+    if (this->nodePos->iHorzFlag)
     {
-        adGlobal[this->nodePos->siHorzFlag - 1] +=
+        adGlobal[this->nodePos->iHorzFlag - 1] +=
                 adLocal[3] * this->adNodeVectorPos[X] -
                 adLocal[4] * this->adNodeVectorPos[Y];
     }
 
-    if (this->nodePos->siVertFlag)
+    if (this->nodePos->iVertFlag)
     {
-        adGlobal[this->nodePos->siVertFlag - 1] +=
+        adGlobal[this->nodePos->iVertFlag - 1] +=
                 adLocal[4] * this->adNodeVectorPos[X] +
                 adLocal[3] * this->adNodeVectorPos[Y];
     }
 
-    if (this->nodePos->siRotFlag)
+    if (this->nodePos->iRotFlag)
     {
-        adGlobal[this->nodePos->siRotFlag - 1] += adLocal[5];
+        adGlobal[this->nodePos->iRotFlag - 1] += adLocal[5];
     }
 
     return;
@@ -2262,19 +2071,19 @@ void Member::translateGlobalToLocal(double * adLocal, double * adGlobal)
 {
     double adExchange[6] = { 0.0 };
 
-    if (this->nodeNeg->siHorzFlag)
-        adExchange[0] = adGlobal[this->nodeNeg->siHorzFlag - 1];
-    if (this->nodeNeg->siVertFlag)
-        adExchange[1] = adGlobal[this->nodeNeg->siVertFlag - 1];
-    if (this->nodeNeg->siRotFlag)
-        adExchange[2] = adGlobal[this->nodeNeg->siRotFlag - 1];
+    if (this->nodeNeg->iHorzFlag)
+        adExchange[0] = adGlobal[this->nodeNeg->iHorzFlag - 1];
+    if (this->nodeNeg->iVertFlag)
+        adExchange[1] = adGlobal[this->nodeNeg->iVertFlag - 1];
+    if (this->nodeNeg->iRotFlag)
+        adExchange[2] = adGlobal[this->nodeNeg->iRotFlag - 1];
 
-    if (this->nodePos->siHorzFlag)
-        adExchange[3] = adGlobal[this->nodePos->siHorzFlag - 1];
-    if (this->nodePos->siVertFlag)
-        adExchange[4] = adGlobal[this->nodePos->siVertFlag - 1];
-    if (this->nodePos->siRotFlag)
-        adExchange[5] = adGlobal[this->nodePos->siRotFlag - 1];
+    if (this->nodePos->iHorzFlag)
+        adExchange[3] = adGlobal[this->nodePos->iHorzFlag - 1];
+    if (this->nodePos->iVertFlag)
+        adExchange[4] = adGlobal[this->nodePos->iVertFlag - 1];
+    if (this->nodePos->iRotFlag)
+        adExchange[5] = adGlobal[this->nodePos->iRotFlag - 1];
 
     adLocal[0] = adExchange[0] * this->adNodeVectorNeg[X] + adExchange[1] * this->adNodeVectorNeg[Y];
     adLocal[1] = adExchange[1] * this->adNodeVectorNeg[X] - adExchange[0] * this->adNodeVectorNeg[Y];
@@ -2308,10 +2117,10 @@ std::string Member::reportAssembly()
         fmt::vformat(
             strFormat,
             fmt::make_format_args(
-                this->siID,
-                this->siNegNodeID, strNegJointType,
-                this->siPosNodeID, strPosJointType,
-                this->siMatPropID
+                this->iID,
+                this->iNegNodeID, strNegJointType,
+                this->iPosNodeID, strPosJointType,
+                this->iMatPropID
             )
         );
 }
@@ -2336,7 +2145,7 @@ std::string Member::reportAdditions(bool bIsComposite)
         fmt::vformat(
             strFormat,
             fmt::make_format_args(
-                this->siID, strLength, strECLIP, strECLPP, strEBL, strVF
+                this->iID, strLength, strECLIP, strECLPP, strEBL, strVF
             )
         );
 }
@@ -13,11 +13,16 @@
 #include "LoadPoint.hpp"
 #include "LoadUniform.hpp"
 #include "LoadTrapezoidal.hpp"
+#include "LoadTrapezoidalExtra.hpp"
 #include "ConcentratedSystem.hpp"
 #include "DistributedSystem.hpp"
 #include "MemberAnalysis.hpp"
+#include "MemberEnvelope.hpp"
+#include "MemberCaseEnvelope.hpp"
+#include "IDTable.hpp"
 
 #include <ostream>
+#include <span>
 #include <vector>
 
 // Member Definition...
@@ -28,10 +33,10 @@ public:
     static const double dInteriorModifier;  // Global Interior Modifier
     static bool bIsComposite;               // Global Composite Indicator
 
-    short int siID;                 // Member ID
-    short int siNegNodeID;          // Negative Node Number
-    short int siPosNodeID;          // Positive Node Number
-    short int siMatPropID;          // Material Property ID
+    int iID;                       // Member ID
+    int iNegNodeID;                // Negative Node Number
+    int iPosNodeID;                // Positive Node Number
+    int iMatPropID;                // Material Property ID
     bool bJointNeg;                 // Negative Joint Indicator
     bool bJointPos;                 // Positive Joint Indicator
 
@@ -48,6 +53,7 @@ public:
     double dVolumeFactor;           // Volume Factor (Option C: Composite)
 
     // Calculated Values:
+    int iIndex;                     // Member's Position in the structure's Members
     double dLength;                 // Member's Length
     double dCos;                    // Member's Angular Cosine
     double dSin;                    // Member's Angular Sine
@@ -62,6 +68,8 @@ public:
     double adLocalForce[6];         // Member's Local Force System
 
     MemberAnalysis ma;              // Member's Calculated Analysis Values
+    MemberEnvelope me;              // Member's Moving Load Envelope
+    MemberCaseEnvelope ce;          // Member's Load Case Envelope
 
     Member(void);
     ~Member(void);
@@ -74,10 +82,10 @@ public:
     bool isInteriorMember(void);
     bool isTrussChord(void);
     bool isMaterialMachineTested(void);
-    bool process(std::vector<MaterialProperty *> &, std::vector<Node *> &);
-    bool loadMember(std::vector<LoadPoint *> &,
-                    std::vector<LoadUniform *> &,
-                    std::vector<LoadTrapezoidal *> &,
+    bool process(IDTable<MaterialProperty> &, IDTable<Node> &);
+    bool loadMember(std::span<LoadPoint *>,
+                    std::span<LoadUniform *>,
+                    std::span<LoadTrapezoidal *>,
                     double *);
     void calcForces(double *);
     void calcStiffnessMatrix(double [][6]);
@@ -89,7 +97,7 @@ public:
     void calcCompression1991(double [], bool, double, double,
                              bool &, short int &, bool &,
                              bool &, bool &, bool &);
-    bool calcDeflection(bool, double *, std::vector<LoadTrapezoidal *> &, short int);
+    bool calcDeflection(bool, double *, std::span<LoadTrapezoidalExtra>, short int);
     std::string reportAssembly();
     std::string reportAdditions(bool);
 
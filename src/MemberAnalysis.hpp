@@ -35,6 +35,11 @@ public:
     double dBend;
     double dAxial;
 
+    double dExtremeBend;            // Bending Moment of greatest magnitude at the divisions
+    double dExtremeShear;           // Shear Force of greatest magnitude at the divisions
+    double dExtremeAxialMax;        // Greatest Axial Force at the divisions
+    double dExtremeAxialMin;        // Least Axial Force at the divisions
+
     bool bMixedForces;
     short int siSlenderRatioType;
 
@@ -67,6 +72,11 @@ public:
         this->dBend = 0.0;
         this->dAxial = 0.0;
 
+        this->dExtremeBend = 0.0;
+        this->dExtremeShear = 0.0;
+        this->dExtremeAxialMax = 0.0;
+        this->dExtremeAxialMin = 0.0;
+
         this->bMixedForces = false;
         this->siSlenderRatioType = 0;
 
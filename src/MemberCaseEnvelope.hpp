@@ -0,0 +1,91 @@
+/*
+ * MemberCaseEnvelope.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#ifndef MEMBERCASEENVELOPE_HPP_
+#define MEMBERCASEENVELOPE_HPP_
+
+#include "MemberAnalysis.hpp"
+
+#include <cmath>
+
+// Member Load Case Envelope...
+//
+//   The governing values of a Member's analyses over the load cases (and
+//   combinations) analyzed so far, each with the (1 based) load case that
+//   governs it.  The Bending Moment, Shear Force and Deflection are those
+//   of greatest magnitude, with their sign.  It is updated as each load
+//   case is analyzed, so no load case's results need be kept.  On a tie,
+//   the first load case governs.
+
+class MemberCaseEnvelope
+{
+public:
+    double dBend;                   // Bending Moment
+    short int siBendCase;
+    double dShear;                  // Shear Force
+    short int siShearCase;
+    double dAxialMax;               // Greatest Axial Force
+    short int siAxialMaxCase;
+    double dAxialMin;               // Least Axial Force
+    short int siAxialMinCase;
+    double dAction;                 // Greatest Stress Index
+    short int siActionCase;
+    double dDelta;                  // Deflection
+    short int siDeltaCase;
+
+    void clear(void)
+    {
+        this->dBend = 0.0;
+        this->siBendCase = 0;
+        this->dShear = 0.0;
+        this->siShearCase = 0;
+        this->dAxialMax = 0.0;
+        this->siAxialMaxCase = 0;
+        this->dAxialMin = 0.0;
+        this->siAxialMinCase = 0;
+        this->dAction = 0.0;
+        this->siActionCase = 0;
+        this->dDelta = 0.0;
+        this->siDeltaCase = 0;
+    }
+
+    void update(MemberAnalysis & ma, short int siLoadCase)
+    {
+        if (this->siBendCase == 0 || fabs(ma.dExtremeBend) > fabs(this->dBend))
+        {
+            this->dBend = ma.dExtremeBend;
+            this->siBendCase = siLoadCase;
+        }
+        if (this->siShearCase == 0 || fabs(ma.dExtremeShear) > fabs(this->dShear))
+        {
+            this->dShear = ma.dExtremeShear;
+            this->siShearCase = siLoadCase;
+        }
+        if (this->siAxialMaxCase == 0 || ma.dExtremeAxialMax > this->dAxialMax)
+        {
+            this->dAxialMax = ma.dExtremeAxialMax;
+            this->siAxialMaxCase = siLoadCase;
+        }
+        if (this->siAxialMinCase == 0 || ma.dExtremeAxialMin < this->dAxialMin)
+        {
+            this->dAxialMin = ma.dExtremeAxialMin;
+            this->siAxialMinCase = siLoadCase;
+        }
+        if (this->siActionCase == 0 || ma.dAction > this->dAction)
+        {
+            this->dAction = ma.dAction;
+            this->siActionCase = siLoadCase;
+        }
+        if (this->siDeltaCase == 0 || fabs(ma.dDelta) > fabs(this->dDelta))
+        {
+            this->dDelta = ma.dDelta;
+            this->siDeltaCase = siLoadCase;
+        }
+    }
+};
+
+#endif /* MEMBERCASEENVELOPE_HPP_ */
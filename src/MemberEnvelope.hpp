@@ -0,0 +1,66 @@
+/*
+ * MemberEnvelope.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#ifndef MEMBERENVELOPE_HPP_
+#define MEMBERENVELOPE_HPP_
+
+#include <limits>
+
+// Member Envelope...
+//
+//   The greatest and least Axial force, Shear force, Bending moment and
+//   Deflection of a Member over the positions of a Moving Load, with the
+//   location along the Member and the governing position of the lead load.
+//   On a tie, the first position (and location) found governs.
+
+class MemberEnvelope
+{
+public:
+    static const short int siAxial = 0;
+    static const short int siShear = 1;
+    static const short int siBend = 2;
+    static const short int siDeflect = 3;
+    static const short int siQuantities = 4;
+
+    double adMax[siQuantities];         // Greatest value
+    double adMaxLoc[siQuantities];      // Location from Negative End
+    double adMaxPos[siQuantities];      // Lead load position along the path
+    double adMin[siQuantities];         // Least value
+    double adMinLoc[siQuantities];      // Location from Negative End
+    double adMinPos[siQuantities];      // Lead load position along the path
+
+    void clear(void)
+    {
+        for (short int siQuantity = 0; siQuantity < siQuantities; siQuantity++)
+        {
+            this->adMax[siQuantity] = std::numeric_limits<double>::lowest();
+            this->adMaxLoc[siQuantity] = 0.0;
+            this->adMaxPos[siQuantity] = 0.0;
+            this->adMin[siQuantity] = std::numeric_limits<double>::max();
+            this->adMinLoc[siQuantity] = 0.0;
+            this->adMinPos[siQuantity] = 0.0;
+        }
+    }
+
+    void update(short int siQuantity, double dValue, double dLoc, double dPos)
+    {
+        if ( dValue > this->adMax[siQuantity] )
+        {
+            this->adMax[siQuantity] = dValue;
+            this->adMaxLoc[siQuantity] = dLoc;
+            this->adMaxPos[siQuantity] = dPos;
+        }
+        if ( dValue < this->adMin[siQuantity] )
+        {
+            this->adMin[siQuantity] = dValue;
+            this->adMinLoc[siQuantity] = dLoc;
+            this->adMinPos[siQuantity] = dPos;
+        }
+    }
+};
+
+#endif /* MEMBERENVELOPE_HPP_ */
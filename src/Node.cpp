@@ -12,7 +12,7 @@
 #include <iomanip>
 #include <fmt/format.h>
 
-short int Node::siUsedSize = 0;
+int Node::iUsedSize = 0;
 short int Node::siLargestDegrees = 0;
 
 Node::Node(void)
@@ -27,15 +27,17 @@ Node::~Node(void)
 
 void Node::clear(void)
 {
-    this->siID = 0;
+    this->iID = 0;
+    this->iIndex = 0;
     this->adPoint[0] = 0.0;
     this->adPoint[1] = 0.0;
-    this->siSequence = 0;
+    this->iSequence = 0;
     this->siDegrees = 0;
-    this->siHorzFlag = 0; // ...assume FREE
-    this->siVertFlag = 0; // ...assume FREE
-    this->siRotFlag = 0;  // ...assume FREE
+    this->iHorzFlag = 0; // ...assume FREE
+    this->iVertFlag = 0; // ...assume FREE
+    this->iRotFlag = 0;  // ...assume FREE
     this->bMemberFixture = true; // ...assume FREE
+    this->bCondensed = false;
     this->nodeload = nullptr;
 }
 
@@ -45,10 +47,10 @@ void Node::report(std::ostream & osOut)
     // Table 2 body...
     //
     osOut << "   " << std::right;
-    osOut << std::setw(3) << this->siID << "     ("
+    osOut << std::setw(3) << this->iID << "     ("
           << std::setw(12) << fmt::format(SF12_4f, this->adPoint[X]) << ", "
           << std::setw(12) << fmt::format(SF12_4f, this->adPoint[Y]) << ")";
-    if (this->siSequence == 0)
+    if (this->iSequence == 0)
         osOut << "   (UNUSED)";
     osOut << "\n";
 }
@@ -18,12 +18,13 @@
 class Node
 {
 public:
-    static short int siUsedSize;
+    static int iUsedSize;
     static short int siLargestDegrees;
 
-    short int siID;             // Node Identifier
+    int iID;                   // Node Identifier
+    int iIndex;                // Position in the structure's Nodes
     double adPoint[2];          // Location (X,Y)
-    short int siSequence;       // Bandwidth Sequencer (0 = Not Sequenced)
+    int iSequence;             // Bandwidth Sequencer (0 = Not Sequenced)
     short int siDegrees;        // Degrees of Use (Number of Members using node)
 
     // Node's Degrees of Freedom (DoF):
@@ -31,11 +32,12 @@ public:
     //         to determine if a DoF is FREE (0, false) or FIXED (true).  Later, they
     //         are used to set the System Stiffness Matrix: FIXED DoF are not used,
     //         FREE DoF are set to a matrix sequence location.
-    short int siHorzFlag;       // Horizontal Freedom Index (FREE or FIXED)
-    short int siVertFlag;       // Vertical   Freedom Index (FREE or FIXED)
-    short int siRotFlag;        // Rotational Freedom Index (FREE or FIXED)
+    int iHorzFlag;             // Horizontal Freedom Index (FREE or FIXED)
+    int iVertFlag;             // Vertical   Freedom Index (FREE or FIXED)
+    int iRotFlag;              // Rotational Freedom Index (FREE or FIXED)
 
     bool bMemberFixture;        // Member Fixture Flag: true=FREE, false=FIXED
+    bool bCondensed;            // Interior Node of a condensed Panel
     LoadNodal * nodeload;       // Pointer to a Nodal Load, if present
 
     Node(void);
@@ -17,7 +17,7 @@ class NodeDegree
 public:
 	Node * node;            // Node Degree's Node
 
-	short int siSequence;   // Node Sequence Indicator
+	int iSequence;         // Node Sequence Indicator
     short int siDegrees;    // Node Degree of Usage
 };
 
@@ -0,0 +1,709 @@
+/*
+ * NodeGraph.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#include "NodeGraph.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <queue>
+
+NodeGraph::NodeGraph(void)
+{
+    this->clear();
+}
+
+NodeGraph::~NodeGraph(void)
+{
+    this->clear();
+}
+
+void NodeGraph::clear(void)
+{
+    this->vectStart.assign(1, 0);
+    this->vectAdjacent.clear();
+    this->vectMark.clear();
+    this->iMark = 0;
+}
+
+//***************************************************************************
+//*
+//* NodeGraph::create
+//*     This function creates the graph of the given number of nodes from
+//*     the given edges (node pairs, 0 based).  An edge from a node to
+//*     itself is ignored and repeated edges are stored once.
+//*
+//***************************************************************************
+
+void NodeGraph::create(int iSize, std::vector<std::pair<int, int>> & vectEdges)
+{
+    this->clear();
+
+    // Count each node's edges...
+    this->vectStart.assign(iSize + 1, 0);
+    for (std::pair<int, int> & pairEdge : vectEdges)
+    {
+        if (pairEdge.first == pairEdge.second)
+            continue;
+        ++this->vectStart[pairEdge.first + 1];
+        ++this->vectStart[pairEdge.second + 1];
+    }
+    for (int iNode = 0; iNode < iSize; iNode++)
+        this->vectStart[iNode + 1] += this->vectStart[iNode];
+
+    // Store each edge in both nodes' rows...
+    this->vectAdjacent.resize( this->vectStart[iSize] );
+    std::vector<int> vectNext( this->vectStart.begin(), this->vectStart.end() - 1 );
+    for (std::pair<int, int> & pairEdge : vectEdges)
+    {
+        if (pairEdge.first == pairEdge.second)
+            continue;
+        this->vectAdjacent[ vectNext[pairEdge.first]++ ] = pairEdge.second;
+        this->vectAdjacent[ vectNext[pairEdge.second]++ ] = pairEdge.first;
+    }
+
+    // Sort each row and remove its repeats...
+    int iKeep = 0;
+    int iFirst = 0;
+    for (int iNode = 0; iNode < iSize; iNode++)
+    {
+        int iLast = this->vectStart[iNode + 1];
+        std::sort(this->vectAdjacent.begin() + iFirst, this->vectAdjacent.begin() + iLast);
+        this->vectStart[iNode] = iKeep;
+        int iPrevious = -1;
+        for (int iEntry = iFirst; iEntry < iLast; iEntry++)
+        {
+            if (this->vectAdjacent[iEntry] != iPrevious)
+            {
+                iPrevious = this->vectAdjacent[iEntry];
+                this->vectAdjacent[iKeep++] = iPrevious;
+            }
+        }
+        iFirst = iLast;
+    }
+    this->vectStart[iSize] = iKeep;
+    this->vectAdjacent.resize(iKeep);
+
+    this->vectMark.assign(iSize, 0);
+}
+
+//*
+//* End of NodeGraph::create
+//***************************************************************************
+
+int NodeGraph::getSize(void)
+{
+    return (int) this->vectStart.size() - 1;
+}
+
+int NodeGraph::getDegree(int iNode)
+{
+    return this->vectStart[iNode + 1] - this->vectStart[iNode];
+}
+
+//***************************************************************************
+//*
+//* NodeGraph::isLower
+//*     This function orders nodes by increasing degree, then by number, so
+//*     each ordering is repeatable.
+//*
+//***************************************************************************
+
+bool NodeGraph::isLower(int iNodeA, int iNodeB)
+{
+    int iDegreeA = this->getDegree(iNodeA);
+    int iDegreeB = this->getDegree(iNodeB);
+    return ( iDegreeA < iDegreeB || (iDegreeA == iDegreeB && iNodeA < iNodeB) );
+}
+
+//*
+//* End of NodeGraph::isLower
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* NodeGraph::findLevels
+//*     This function finds the rooted level structure of the given root
+//*     node: a breadth first search of the root's connected component.
+//*     The queue is the component's nodes level by level and the level of
+//*     each queued node is set.  The level count (depth) is returned.
+//*
+//***************************************************************************
+
+int NodeGraph::findLevels(int iRoot, std::vector<int> & vectQueue, std::vector<int> & vectLevel)
+{
+    ++this->iMark;
+    vectQueue.clear();
+    vectQueue.push_back(iRoot);
+    this->vectMark[iRoot] = this->iMark;
+    vectLevel[iRoot] = 0;
+
+    for (std::size_t uiHead = 0; uiHead < vectQueue.size(); uiHead++)
+    {
+        int iNode = vectQueue[uiHead];
+        for (int iEntry = this->vectStart[iNode]; iEntry < this->vectStart[iNode + 1]; iEntry++)
+        {
+            int iAdjacent = this->vectAdjacent[iEntry];
+            if (this->vectMark[iAdjacent] != this->iMark)
+            {
+                this->vectMark[iAdjacent] = this->iMark;
+                vectLevel[iAdjacent] = vectLevel[iNode] + 1;
+                vectQueue.push_back(iAdjacent);
+            }
+        }
+    }
+
+    return vectLevel[ vectQueue.back() ] + 1;
+}
+
+//*
+//* End of NodeGraph::findLevels
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* NodeGraph::findWidth
+//*     This function finds the width (largest level) of a level structure
+//*     of the given depth.
+//*
+//***************************************************************************
+
+int NodeGraph::findWidth(std::vector<int> & vectQueue, std::vector<int> & vectLevel, int iDepth)
+{
+    std::vector<int> vectCount(iDepth, 0);
+    for (int iNode : vectQueue)
+        ++vectCount[ vectLevel[iNode] ];
+
+    return *std::max_element(vectCount.begin(), vectCount.end());
+}
+
+//*
+//* End of NodeGraph::findWidth
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* NodeGraph::findPseudoPeripheral
+//*     This function finds a pseudo-peripheral node of the given node's
+//*     connected component (George and Liu, 1979).  From the lowest degree
+//*     node of the component, the lowest degree node of the last level is
+//*     tried as the root until the level structure is no deeper.  A deep,
+//*     narrow level structure gives a narrow ordering.
+//*
+//***************************************************************************
+
+int NodeGraph::findPseudoPeripheral(int iNode, std::vector<int> & vectQueue, std::vector<int> & vectLevel)
+{
+    auto isLower = [this](int iNodeA, int iNodeB) { return this->isLower(iNodeA, iNodeB); };
+
+    // Start from the lowest degree node of the component...
+    this->findLevels(iNode, vectQueue, vectLevel);
+    int iRoot = *std::min_element(vectQueue.begin(), vectQueue.end(), isLower);
+    int iDepth = this->findLevels(iRoot, vectQueue, vectLevel);
+
+    while (true)
+    {
+        // Find the lowest degree node of the last level...
+        int iCandidate = iRoot;
+        for (std::size_t uiIndex = vectQueue.size(); uiIndex > 0; uiIndex--)
+        {
+            int iLast = vectQueue[uiIndex - 1];
+            if (vectLevel[iLast] != iDepth - 1)
+                break;
+            if ( iCandidate == iRoot || this->isLower(iLast, iCandidate) )
+                iCandidate = iLast;
+        }
+        if (iCandidate == iRoot) // ...single node component
+            break;
+
+        int iCandidateDepth = this->findLevels(iCandidate, vectQueue, vectLevel);
+        if (iCandidateDepth <= iDepth)
+            break;
+        iRoot = iCandidate;
+        iDepth = iCandidateDepth;
+    }
+
+    return iRoot;
+}
+
+//*
+//* End of NodeGraph::findPseudoPeripheral
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* NodeGraph::findEnds
+//*     This function finds the ends of a pseudo-diameter of the given
+//*     node's connected component for the Sloan and Gibbs-Poole-Stockmeyer
+//*     orderings.  The start is a pseudo-peripheral node.  The end is the
+//*     node of the start's last level with the narrowest level structure,
+//*     trying the lowest degree node of each degree.  A deeper end is
+//*     taken as the start and the search is made again.
+//*
+//*     The start is returned and the end is set.
+//*
+//***************************************************************************
+
+int NodeGraph::findEnds(int iNode, int & iEnd, std::vector<int> & vectQueue, std::vector<int> & vectLevel)
+{
+    int iStart = this->findPseudoPeripheral(iNode, vectQueue, vectLevel);
+
+    bool bDeeper = true;
+    while (bDeeper)
+    {
+        bDeeper = false;
+        int iDepth = this->findLevels(iStart, vectQueue, vectLevel);
+
+        // List the last level by increasing degree...
+        std::vector<int> vectLast;
+        for (std::size_t uiIndex = vectQueue.size(); uiIndex > 0; uiIndex--)
+        {
+            int iLast = vectQueue[uiIndex - 1];
+            if (vectLevel[iLast] != iDepth - 1)
+                break;
+            vectLast.push_back(iLast);
+        }
+        std::sort( vectLast.begin(), vectLast.end(),
+                   [this](int iNodeA, int iNodeB) { return this->isLower(iNodeA, iNodeB); } );
+
+        iEnd = iStart;
+        int iEndWidth = std::numeric_limits<int>::max();
+        int iDegree = -1;
+        for (int iCandidate : vectLast)
+        {
+            if (this->getDegree(iCandidate) == iDegree) // ...one node of each degree
+                continue;
+            iDegree = this->getDegree(iCandidate);
+
+            int iCandidateDepth = this->findLevels(iCandidate, vectQueue, vectLevel);
+            if (iCandidateDepth > iDepth)
+            {
+                iStart = iCandidate;
+                bDeeper = true;
+                break;
+            }
+            int iWidth = this->findWidth(vectQueue, vectLevel, iCandidateDepth);
+            if (iWidth < iEndWidth)
+            {
+                iEnd = iCandidate;
+                iEndWidth = iWidth;
+            }
+        }
+    }
+
+    return iStart;
+}
+
+//*
+//* End of NodeGraph::findEnds
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* NodeGraph::orderRCM
+//*     This function orders the nodes by Reverse Cuthill-McKee.  Each
+//*     connected component is searched breadth first from a pseudo-
+//*     peripheral node, adding each node's unordered adjacent nodes by
+//*     increasing degree.  The reversed order has the same bandwidth and
+//*     a smaller (never larger) profile.
+//*
+//***************************************************************************
+
+void NodeGraph::orderRCM(std::vector<int> & vectOrder)
+{
+    int iSize = this->getSize();
+    vectOrder.clear();
+    vectOrder.reserve(iSize);
+
+    auto isLower = [this](int iNodeA, int iNodeB) { return this->isLower(iNodeA, iNodeB); };
+
+    std::vector<bool> vectOrdered(iSize, false);
+    std::vector<int> vectQueue;
+    std::vector<int> vectLevel(iSize, 0);
+    for (int iNode = 0; iNode < iSize; iNode++)
+    {
+        if (vectOrdered[iNode]) // ...component already ordered
+            continue;
+
+        int iRoot = this->findPseudoPeripheral(iNode, vectQueue, vectLevel);
+        std::size_t uiHead = vectOrder.size();
+        vectOrder.push_back(iRoot);
+        vectOrdered[iRoot] = true;
+        for ( ; uiHead < vectOrder.size(); uiHead++)
+        {
+            int iCurrent = vectOrder[uiHead];
+            std::size_t uiFirst = vectOrder.size();
+            for (int iEntry = this->vectStart[iCurrent]; iEntry < this->vectStart[iCurrent + 1]; iEntry++)
+            {
+                int iAdjacent = this->vectAdjacent[iEntry];
+                if ( ! vectOrdered[iAdjacent] )
+                {
+                    vectOrdered[iAdjacent] = true;
+                    vectOrder.push_back(iAdjacent);
+                }
+            }
+            std::sort(vectOrder.begin() + uiFirst, vectOrder.end(), isLower);
+        }
+    }
+
+    std::reverse(vectOrder.begin(), vectOrder.end());
+}
+
+//*
+//* End of NodeGraph::orderRCM
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* NodeGraph::orderSloan
+//*     This function orders the nodes by Sloan's profile reduction (Sloan,
+//*     1986).  Each connected component is numbered from the start of a
+//*     pseudo-diameter toward its end.  The next node is the queued node
+//*     of highest priority:
+//*
+//*         Priority = W1 * Distance to End - W2 * (Current Degree + 1)
+//*
+//*     where the current degree is the count of adjacent nodes that would
+//*     join the front (the active nodes) if the node was numbered.  A node
+//*     far from the end which grows the front the least is numbered first.
+//*
+//***************************************************************************
+
+void NodeGraph::orderSloan(std::vector<int> & vectOrder)
+{
+    const char cInactive = 0;   // Not yet reached
+    const char cPreactive = 1;  // Adjacent to an active node
+    const char cActive = 2;     // Adjacent to a numbered node
+    const char cPostactive = 3; // Numbered
+
+    int iSize = this->getSize();
+    vectOrder.clear();
+    vectOrder.reserve(iSize);
+
+    std::vector<char> vectStatus(iSize, cInactive);
+    std::vector<int> vectPriority(iSize, 0);
+    std::vector<int> vectQueue;
+    std::vector<int> vectLevel(iSize, 0);
+
+    // Queue by highest priority, then lowest node (priority changes are
+    //   queued again, so a popped node of another priority is stale)...
+    std::priority_queue<std::pair<int, int>> queueNodes;
+    auto queueNode = [&](int iNode) { queueNodes.emplace( vectPriority[iNode], -iNode ); };
+
+    for (int iNode = 0; iNode < iSize; iNode++)
+    {
+        if (vectStatus[iNode] != cInactive) // ...component already ordered
+            continue;
+
+        int iEnd = 0;
+        int iStart = this->findEnds(iNode, iEnd, vectQueue, vectLevel);
+
+        // Set the initial priorities from the distance to the end...
+        this->findLevels(iEnd, vectQueue, vectLevel);
+        for (int iCurrent : vectQueue)
+            vectPriority[iCurrent] = NodeGraph::iSloanWeightDistance * vectLevel[iCurrent] -
+                                     NodeGraph::iSloanWeightDegree * ( this->getDegree(iCurrent) + 1 );
+
+        vectStatus[iStart] = cPreactive;
+        queueNode(iStart);
+        while ( ! queueNodes.empty() )
+        {
+            int iPriority = queueNodes.top().first;
+            int iCurrent = -queueNodes.top().second;
+            queueNodes.pop();
+            if (vectStatus[iCurrent] == cPostactive || iPriority != vectPriority[iCurrent])
+                continue;
+
+            // A preactive node joins the front as it is numbered...
+            if (vectStatus[iCurrent] == cPreactive)
+            {
+                for (int iEntry = this->vectStart[iCurrent]; iEntry < this->vectStart[iCurrent + 1]; iEntry++)
+                {
+                    int iAdjacent = this->vectAdjacent[iEntry];
+                    if (vectStatus[iAdjacent] == cPostactive)
+                        continue;
+                    vectPriority[iAdjacent] += NodeGraph::iSloanWeightDegree;
+                    if (vectStatus[iAdjacent] == cInactive)
+                        vectStatus[iAdjacent] = cPreactive;
+                    queueNode(iAdjacent);
+                }
+            }
+
+            // Number the node...
+            vectStatus[iCurrent] = cPostactive;
+            vectOrder.push_back(iCurrent);
+
+            // Its preactive adjacent nodes become active...
+            for (int iEntry = this->vectStart[iCurrent]; iEntry < this->vectStart[iCurrent + 1]; iEntry++)
+            {
+                int iAdjacent = this->vectAdjacent[iEntry];
+                if (vectStatus[iAdjacent] != cPreactive)
+                    continue;
+                vectStatus[iAdjacent] = cActive;
+                vectPriority[iAdjacent] += NodeGraph::iSloanWeightDegree;
+                queueNode(iAdjacent);
+
+                for (int iNext = this->vectStart[iAdjacent]; iNext < this->vectStart[iAdjacent + 1]; iNext++)
+                {
+                    int iFront = this->vectAdjacent[iNext];
+                    if (vectStatus[iFront] == cPostactive)
+                        continue;
+                    vectPriority[iFront] += NodeGraph::iSloanWeightDegree;
+                    if (vectStatus[iFront] == cInactive)
+                        vectStatus[iFront] = cPreactive;
+                    queueNode(iFront);
+                }
+            }
+        }
+    }
+}
+
+//*
+//* End of NodeGraph::orderSloan
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* NodeGraph::orderGPS
+//*     This function orders the nodes by Gibbs-Poole-Stockmeyer (1976).
+//*     Each connected component's level structures from both ends of a
+//*     pseudo-diameter are combined into one narrower level structure:
+//*     a node on the same level from both ends keeps it, and each
+//*     connected part of the other nodes takes the levels from the end
+//*     that widens the combined structure the least, largest part first.
+//*
+//*     The levels are numbered in turn from the lower degree end.  A level's
+//*     nodes are numbered by their numbered adjacent nodes, by increasing
+//*     degree, as in Cuthill-McKee.  The order is reversed, as in RCM.
+//*
+//***************************************************************************
+
+void NodeGraph::orderGPS(std::vector<int> & vectOrder)
+{
+    int iSize = this->getSize();
+    vectOrder.clear();
+    vectOrder.reserve(iSize);
+
+    auto isLower = [this](int iNodeA, int iNodeB) { return this->isLower(iNodeA, iNodeB); };
+
+    std::vector<bool> vectOrdered(iSize, false);
+    std::vector<int> vectComponent;
+    std::vector<int> vectQueue;
+    std::vector<int> vectLevelStart(iSize, 0);
+    std::vector<int> vectLevelEnd(iSize, 0);
+    std::vector<int> vectLevel(iSize, -1);
+    for (int iNode = 0; iNode < iSize; iNode++)
+    {
+        if (vectOrdered[iNode]) // ...component already ordered
+            continue;
+
+        int iEnd = 0;
+        int iStart = this->findEnds(iNode, iEnd, vectQueue, vectLevelStart);
+        int iDepth = this->findLevels(iStart, vectComponent, vectLevelStart);
+        int iWidthStart = this->findWidth(vectComponent, vectLevelStart, iDepth);
+        this->findLevels(iEnd, vectQueue, vectLevelEnd);
+        for (int iCurrent : vectQueue)
+            vectLevelEnd[iCurrent] = iDepth - 1 - vectLevelEnd[iCurrent];
+        int iWidthEnd = this->findWidth(vectQueue, vectLevelEnd, iDepth);
+
+        // Keep the levels that agree...
+        std::vector<int> vectWidth(iDepth, 0);
+        for (int iCurrent : vectComponent)
+        {
+            if (vectLevelStart[iCurrent] == vectLevelEnd[iCurrent])
+            {
+                vectLevel[iCurrent] = vectLevelStart[iCurrent];
+                ++vectWidth[ vectLevel[iCurrent] ];
+            }
+            else
+                vectLevel[iCurrent] = -1;
+        }
+
+        // Find the connected parts of the other nodes...
+        std::vector<std::vector<int>> vectParts;
+        ++this->iMark;
+        for (int iCurrent : vectComponent)
+        {
+            if (vectLevel[iCurrent] != -1 || this->vectMark[iCurrent] == this->iMark)
+                continue;
+            vectParts.emplace_back();
+            std::vector<int> & vectPart = vectParts.back();
+            vectPart.push_back(iCurrent);
+            this->vectMark[iCurrent] = this->iMark;
+            for (std::size_t uiHead = 0; uiHead < vectPart.size(); uiHead++)
+            {
+                int iPart = vectPart[uiHead];
+                for (int iEntry = this->vectStart[iPart]; iEntry < this->vectStart[iPart + 1]; iEntry++)
+                {
+                    int iAdjacent = this->vectAdjacent[iEntry];
+                    if (vectLevel[iAdjacent] == -1 && this->vectMark[iAdjacent] != this->iMark)
+                    {
+                        this->vectMark[iAdjacent] = this->iMark;
+                        vectPart.push_back(iAdjacent);
+                    }
+                }
+            }
+        }
+        std::stable_sort( vectParts.begin(), vectParts.end(),
+                          [](const std::vector<int> & vectA, const std::vector<int> & vectB)
+                          { return vectA.size() > vectB.size(); } );
+
+        // Level each part from the end that widens the least...
+        for (std::vector<int> & vectPart : vectParts)
+        {
+            std::vector<int> vectAddStart(iDepth, 0);
+            std::vector<int> vectAddEnd(iDepth, 0);
+            for (int iPart : vectPart)
+            {
+                ++vectAddStart[ vectLevelStart[iPart] ];
+                ++vectAddEnd[ vectLevelEnd[iPart] ];
+            }
+            int iMaxStart = 0;
+            int iMaxEnd = 0;
+            for (int iLevel = 0; iLevel < iDepth; iLevel++)
+            {
+                if (vectAddStart[iLevel] > 0)
+                    iMaxStart = std::max(iMaxStart, vectWidth[iLevel] + vectAddStart[iLevel]);
+                if (vectAddEnd[iLevel] > 0)
+                    iMaxEnd = std::max(iMaxEnd, vectWidth[iLevel] + vectAddEnd[iLevel]);
+            }
+            bool bStart = ( iMaxStart < iMaxEnd || (iMaxStart == iMaxEnd && iWidthStart <= iWidthEnd) );
+            for (int iPart : vectPart)
+            {
+                vectLevel[iPart] = bStart ? vectLevelStart[iPart] : vectLevelEnd[iPart];
+                ++vectWidth[ vectLevel[iPart] ];
+            }
+        }
+
+        // Number from the lower degree end...
+        int iRoot = iStart;
+        if ( this->getDegree(iEnd) < this->getDegree(iStart) )
+        {
+            iRoot = iEnd;
+            for (int iCurrent : vectComponent)
+                vectLevel[iCurrent] = iDepth - 1 - vectLevel[iCurrent];
+        }
+        std::vector<std::vector<int>> vectLevels(iDepth);
+        for (int iCurrent : vectComponent)
+            vectLevels[ vectLevel[iCurrent] ].push_back(iCurrent);
+        for (std::vector<int> & vectLevelNodes : vectLevels)
+            std::sort(vectLevelNodes.begin(), vectLevelNodes.end(), isLower);
+
+        std::size_t uiLevelFirst = vectOrder.size();
+        vectOrder.push_back(iRoot);
+        vectOrdered[iRoot] = true;
+        for (int iLevel = 0; iLevel < iDepth; iLevel++)
+        {
+            std::vector<int> & vectLevelNodes = vectLevels[iLevel];
+            std::size_t uiHead = uiLevelFirst;
+            std::size_t uiLowest = 0;
+            while (true)
+            {
+                // Number the level's nodes adjacent to its numbered nodes...
+                for ( ; uiHead < vectOrder.size(); uiHead++)
+                {
+                    int iCurrent = vectOrder[uiHead];
+                    std::size_t uiFirst = vectOrder.size();
+                    for (int iEntry = this->vectStart[iCurrent]; iEntry < this->vectStart[iCurrent + 1]; iEntry++)
+                    {
+                        int iAdjacent = this->vectAdjacent[iEntry];
+                        if ( ! vectOrdered[iAdjacent] && vectLevel[iAdjacent] == iLevel )
+                        {
+                            vectOrdered[iAdjacent] = true;
+                            vectOrder.push_back(iAdjacent);
+                        }
+                    }
+                    std::sort(vectOrder.begin() + uiFirst, vectOrder.end(), isLower);
+                }
+                if (vectOrder.size() - uiLevelFirst == vectLevelNodes.size())
+                    break;
+
+                // ...then the lowest degree node not reached...
+                while ( vectOrdered[ vectLevelNodes[uiLowest] ] )
+                    uiLowest++;
+                vectOrdered[ vectLevelNodes[uiLowest] ] = true;
+                vectOrder.push_back( vectLevelNodes[uiLowest] );
+            }
+
+            // Number the next level's nodes adjacent to this level...
+            std::size_t uiLevelLast = vectOrder.size();
+            for (std::size_t uiIndex = uiLevelFirst; uiIndex < uiLevelLast; uiIndex++)
+            {
+                int iCurrent = vectOrder[uiIndex];
+                std::size_t uiFirst = vectOrder.size();
+                for (int iEntry = this->vectStart[iCurrent]; iEntry < this->vectStart[iCurrent + 1]; iEntry++)
+                {
+                    int iAdjacent = this->vectAdjacent[iEntry];
+                    if ( ! vectOrdered[iAdjacent] && vectLevel[iAdjacent] == iLevel + 1 )
+                    {
+                        vectOrdered[iAdjacent] = true;
+                        vectOrder.push_back(iAdjacent);
+                    }
+                }
+                std::sort(vectOrder.begin() + uiFirst, vectOrder.end(), isLower);
+            }
+            uiLevelFirst = uiLevelLast;
+        }
+    }
+
+    std::reverse(vectOrder.begin(), vectOrder.end());
+}
+
+//*
+//* End of NodeGraph::orderGPS
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* NodeGraph::measure
+//*     This function measures the SSM of the given ordering: the bandwidth
+//*     and the profile (the Skyline storage, with the diagonal).  Each node
+//*     has the given count of FREE equations, numbered in the order.  An
+//*     equation's column reaches up to the first equation of its node and
+//*     of its adjacent nodes ordered before it.
+//*
+//***************************************************************************
+
+void NodeGraph::measure(std::vector<int> & vectOrder, std::vector<int> & vectFreedom,
+                        int & iBandwidth, std::size_t & uiProfile)
+{
+    int iSize = this->getSize();
+    std::vector<int> vectPosition(iSize, 0);
+    std::vector<int> vectFirst(iSize, 0);
+    int iEquation = 0;
+    for (int iPosition = 0; iPosition < iSize; iPosition++)
+    {
+        int iNode = vectOrder[iPosition];
+        vectPosition[iNode] = iPosition;
+        vectFirst[iNode] = iEquation;
+        iEquation += vectFreedom[iNode];
+    }
+
+    iBandwidth = 0;
+    uiProfile = 0;
+    for (int iPosition = 0; iPosition < iSize; iPosition++)
+    {
+        int iNode = vectOrder[iPosition];
+        int iTop = vectFirst[iNode];
+        for (int iEntry = this->vectStart[iNode]; iEntry < this->vectStart[iNode + 1]; iEntry++)
+        {
+            int iAdjacent = this->vectAdjacent[iEntry];
+            if (vectPosition[iAdjacent] < iPosition && vectFreedom[iAdjacent] > 0)
+                iTop = std::min(iTop, vectFirst[iAdjacent]);
+        }
+        for (int iFree = 0; iFree < vectFreedom[iNode]; iFree++)
+        {
+            int iHeight = vectFirst[iNode] + iFree - iTop + 1;
+            uiProfile += (std::size_t) iHeight;
+            iBandwidth = std::max(iBandwidth, iHeight);
+        }
+    }
+}
+
+//*
+//* End of NodeGraph::measure
+//***************************************************************************
@@ -0,0 +1,58 @@
+/*
+ * NodeGraph.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#ifndef NODEGRAPH_HPP_
+#define NODEGRAPH_HPP_
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Node Adjacency Graph for ordering the SSM equations...
+//
+//   The graph is stored in compressed rows (CSR): the adjacent nodes of
+//   node i are vectAdjacent[ vectStart[i] ... vectStart[i + 1] - 1 ],
+//   sorted and without repeats.  Nodes are numbered 0 to Size - 1.
+//
+//   An ordering is the node at each position, 0 based.  Each ordering
+//   handles every connected component of the graph.
+
+class NodeGraph
+{
+public:
+    static const char cOrderRCM = 'R';          // Reverse Cuthill-McKee
+    static const char cOrderSloan = 'S';        // Sloan
+    static const char cOrderGPS = 'G';          // Gibbs-Poole-Stockmeyer
+    static const int iSloanWeightDistance = 1;  // Sloan: priority weight of the distance to the end node
+    static const int iSloanWeightDegree = 2;    // Sloan: priority weight of the current degree
+
+    NodeGraph(void);
+    ~NodeGraph(void);
+    void clear(void);
+
+    void create(int, std::vector<std::pair<int, int>> &);
+    int getSize(void);
+    int getDegree(int);
+    void orderRCM(std::vector<int> &);
+    void orderSloan(std::vector<int> &);
+    void orderGPS(std::vector<int> &);
+    void measure(std::vector<int> &, std::vector<int> &, int &, std::size_t &);
+
+private:
+    std::vector<int> vectStart;     // First adjacent entry of each node (Size + 1)
+    std::vector<int> vectAdjacent;  // Adjacent nodes of each node
+    std::vector<int> vectMark;      // Level search marks (a node is reached when equal to iMark)
+    int iMark;                      // Current level search mark
+
+    bool isLower(int, int);
+    int findLevels(int, std::vector<int> &, std::vector<int> &);
+    int findWidth(std::vector<int> &, std::vector<int> &, int);
+    int findPseudoPeripheral(int, std::vector<int> &, std::vector<int> &);
+    int findEnds(int, int &, std::vector<int> &, std::vector<int> &);
+};
+
+#endif /* NODEGRAPH_HPP_ */
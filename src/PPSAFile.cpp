@@ -12,6 +12,7 @@
 #include <iostream>
 #include <fmt/format.h>
 #include <iomanip>
+#include <algorithm>
 
 const std::string PPSAFile::strEOF = "\n End of file (no marker found)!\n";
 const std::string PPSAFile::strSpace = std::string().append(128, ' ');
@@ -402,7 +403,7 @@ bool PPSAFile::getStructureMaterialProperties(std::vector<MaterialProperty *> &
             // FREE format...
             //
 
-            strRead >> mpCurr->siID >> mpCurr->dArea >> mpCurr->dMoI >> mpCurr->dSectionModulus
+            strRead >> mpCurr->iID >> mpCurr->dArea >> mpCurr->dMoI >> mpCurr->dSectionModulus
                     >> mpCurr->dMoE_IP >> mpCurr->dMoE_Axial >> mpCurr->dShearModulus >> siEOS;
         }
 
@@ -464,7 +465,7 @@ bool PPSAFile::getStructureMaterialProperties(std::vector<MaterialProperty *> &
             //
 
             char cProperty = 0; // Member Type property indicator
-            strRead >> mpCurr->siID >> mpCurr->dThick >> mpCurr->dHeight
+            strRead >> mpCurr->iID >> mpCurr->dThick >> mpCurr->dHeight
                     >> mpCurr->dMoE_IP >> mpCurr->dMoE_PP >> mpCurr->dMoE_Axial
                     >> mpCurr->dShearModulus >> mpCurr->dForceBend >> mpCurr->dForceComp
                     >> mpCurr->dForceTens >> cProperty >> siEOS;
@@ -519,7 +520,7 @@ bool PPSAFile::getStructureMaterialProperties(std::vector<MaterialProperty *> &
             //
 
             char cProperty = 0; // Member Type property indicator
-            strRead >> mpCurr->siID >> mpCurr->dThick >> mpCurr->dHeight
+            strRead >> mpCurr->iID >> mpCurr->dThick >> mpCurr->dHeight
                     >> mpCurr->dMoE_Axial >> mpCurr->dForceBend >> mpCurr->dForceComp >> mpCurr->dForceTens
                     >> cProperty >> siEOS;
             mpCurr->cProperty = toupper( cProperty );
@@ -653,7 +654,7 @@ bool PPSAFile::getStructureNodes(std::vector<Node *> & nodes)
         // FREE format...
         //
 
-        strRead >> nodeCurr->siID >> nodeCurr->adPoint[X] >> nodeCurr->adPoint[Y] >> siEOS;
+        strRead >> nodeCurr->iID >> nodeCurr->adPoint[X] >> nodeCurr->adPoint[Y] >> siEOS;
 
         //
         // Store Node...
@@ -751,8 +752,8 @@ bool PPSAFile::getStructureMembers(std::vector<Member *> & members, bool bCompos
         // FREE format [check for volume_factor variable]...
         //
 
-        strRead >> memberCurr->siID >> memberCurr->siNegNodeID
-                >> memberCurr->siPosNodeID >> memberCurr->siMatPropID
+        strRead >> memberCurr->iID >> memberCurr->iNegNodeID
+                >> memberCurr->iPosNodeID >> memberCurr->iMatPropID
                 >> memberCurr->bJointNeg >> memberCurr->bJointPos >> siEOS
                 >> memberCurr->dEffColumnLength_IP >> memberCurr->dEffColumnLength_PP
                 >> memberCurr->dEffBendingLength >> memberCurr->dVolumeFactor;
@@ -766,7 +767,7 @@ bool PPSAFile::getStructureMembers(std::vector<Member *> & members, bool bCompos
             if (memberCurr->dVolumeFactor <= 0.0 || memberCurr->dVolumeFactor > 1.0)
             {
                 std::cerr << "\n ERROR: Volume Factor must be GREATER THAN 0.0 and LESS THAN OR EQUAL TO 1.0!\n"
-                          <<   "        Error detected on Member Number " << memberCurr->siID << std::endl
+                          <<   "        Error detected on Member Number " << memberCurr->iID << std::endl
                           <<   "        CAPS program aborted...\n";
                 return false;
             }
@@ -852,7 +853,7 @@ bool PPSAFile::getStructureReactions(std::vector<Reaction *> & react)
         // FREE format...
         //
 
-        strRead >> reactCurr->siNodeID >> strProcess
+        strRead >> reactCurr->iNodeID >> strProcess
                 >> reactCurr->dVector[X] >> reactCurr->dVector[Y] >> siEOS;
 
         strProcess[4] = 0; // hard limit
@@ -1113,7 +1114,7 @@ bool PPSAFile::getLoadCaseConcentratedLoads(std::vector<LoadPoint *> & pl, bool
         }
         else
         {
-            strRead >> plCurr->siMemberID >> plCurr->siID
+            strRead >> plCurr->iMemberID >> plCurr->iID
                     >> plCurr->adLoadVect[X] >> plCurr->adLoadVect[Y] >> plCurr->dDistance >> siEOS;
 
             // Store Concentrated Loads to Plane Frame Structure...
@@ -1191,7 +1192,7 @@ bool PPSAFile::getLoadCaseUniformLoads(std::vector<LoadUniform *> & ul)
         // FREE format...
         //
 
-        strRead >> ulCurr->siMemberID >> ulCurr->adLoadVect[X] >> ulCurr->adLoadVect[Y] >> siEOS;
+        strRead >> ulCurr->iMemberID >> ulCurr->adLoadVect[X] >> ulCurr->adLoadVect[Y] >> siEOS;
 
         // Store Uniform Loads to Plane Frame Structure...
         ul.push_back(ulCurr);
@@ -1267,7 +1268,7 @@ bool PPSAFile::getLoadCaseNodalLoads(std::vector<LoadNodal *> & nl)
         // FREE format...
         //
 
-        strRead >> nlCurr->siNodeID >> nlCurr->siLoadDirection >> nlCurr->dLoad >> siEOS;
+        strRead >> nlCurr->iNodeID >> nlCurr->siLoadDirection >> nlCurr->dLoad >> siEOS;
 
         if (nlCurr->siLoadDirection < 1 || nlCurr->siLoadDirection > 3)
             nlCurr->siLoadDirection = 2; // ...default bad load direction to Y (gravity)
@@ -1369,7 +1370,7 @@ bool PPSAFile::getLoadCaseTrapezoidalLoads(std::vector<LoadTrapezoidal *> & tl,
         }
         else
         {
-            strRead >> tlCurr->siMemberID >> tlCurr->siID >> tlCurr->adLoad[X] >> tlCurr->adLoad[Y]
+            strRead >> tlCurr->iMemberID >> tlCurr->iID >> tlCurr->adLoad[X] >> tlCurr->adLoad[Y]
                     >> tlCurr->adDist[X] >> tlCurr->adDist[Y] >> tlCurr->dTheta >> siEOS;
 
             // Store Trapezoidal Load...
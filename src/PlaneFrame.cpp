@@ -11,18 +11,25 @@
 
 #include "SystemDef.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <exception>
 #include <iomanip>
 #include <cstddef>
 #include <cstdlib>
 #include <cmath>
+#include <limits>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <thread>
+#include <utility>
 
 PlaneFrame::PlaneFrame(void)
 {
     this->mprops.clear();
     this->nodes.clear();
-    Node::siUsedSize = 0;
+    Node::iUsedSize = 0;
     Node::siLargestDegrees = 0;
     this->members.clear();
     Member::bIsComposite = false;
@@ -33,6 +40,15 @@ PlaneFrame::PlaneFrame(void)
     this->tl.clear();
     this->adForceMatrix = nullptr;
     this->adDisplaceMatrix = nullptr;
+    this->adForceBatch = nullptr;
+    this->adDisplaceBatch = nullptr;
+    this->siCasesSolved = 0;
+    this->iMovingPositions = 0;
+    this->dMovingPathLength = 0.0;
+    this->cSolverOption = PlaneFrame::cSolverAuto;
+    this->dPanelLength = 0.0;
+    this->cOrderOption = PlaneFrame::cOrderLegacy;
+    this->cExtremeOption = PlaneFrame::cExtremeSample;
     this->clear();
 }
 
@@ -88,6 +104,21 @@ void PlaneFrame::clear(void)
 
     this->clearLoads();
 
+    this->clearLoadCases();
+
+    this->tableNodes.clear();
+    this->tableMembers.clear();
+    this->tableMatProps.clear();
+    this->vectPanels.clear();
+    this->vectIncidenceStart.clear();
+    this->vectIncidence.clear();
+    this->vectSequenceNodes.clear();
+    this->vectMovingPath.clear();
+    this->iMovingPositions = 0;
+    this->dMovingPathLength = 0.0;
+    this->cOrderUsed = PlaneFrame::cOrderAuto;
+    this->aiOrderBandwidth[0] = this->aiOrderBandwidth[1] = 0;
+    this->auiOrderProfile[0] = this->auiOrderProfile[1] = 0;
     this->ssm.clear();
 
     return;
@@ -145,6 +176,10 @@ void PlaneFrame::clearLoads(void)
         this->nl.clear();
     }
 
+    // Release the Nodes' Nodal Loads...
+    for (Node * nodeCurr : this->nodes)
+        nodeCurr->nodeload = nullptr;
+
     if ( ! this->tl.empty() )
     {
         for (LoadTrapezoidal * tlCurr : this->tl)
@@ -152,6 +187,8 @@ void PlaneFrame::clearLoads(void)
         this->tl.clear();
     }
 
+    this->clearMemberLoads();
+
     this->clearLoadAnalysis();
 
     return;
@@ -183,6 +220,11 @@ void PlaneFrame::clearLoadAnalysis(void)
         memberCurr->clearLoadAnalysis();
     }
 
+    for (Reaction * reactCurr : this->react)
+    {
+        reactCurr->clearLoadAnalysis();
+    }
+
     this->clearMemberNoteFlags();
 
     return;
@@ -191,6 +233,38 @@ void PlaneFrame::clearLoadAnalysis(void)
 //* End of PlaneFrame::clearLoadAnalysis
 //***************************************************************************
 
+//***************************************************************************
+//*
+//* PlaneFrame::clearLoadCases
+//*     This function clears the read ahead Load Cases and their batch
+//*     force and displacement matrices.
+//*
+//***************************************************************************
+
+void PlaneFrame::clearLoadCases(void)
+{
+    if ( ! this->lc.empty() )
+    {
+        for (LoadCase * lcCurr : this->lc)
+            delete lcCurr;
+        this->lc.clear();
+    }
+
+    if (this->adForceBatch != nullptr)
+        delete [] this->adForceBatch;
+    this->adForceBatch = nullptr;
+
+    if (this->adDisplaceBatch != nullptr)
+        delete [] this->adDisplaceBatch;
+    this->adDisplaceBatch = nullptr;
+    this->siCasesSolved = 0;
+
+    return;
+}
+//*
+//* End of PlaneFrame::clearLoadCases
+//***************************************************************************
+
 void PlaneFrame::clearMemberNoteFlags(void)
 {
     this->bNoteCompression50 = false;
@@ -249,6 +323,46 @@ double PlaneFrame::getShearFactor(void)
     return this->dShearFactor;
 }
 
+void PlaneFrame::setSolverOption(char cNewSolverOption)
+{
+    this->cSolverOption = cNewSolverOption;
+}
+
+char PlaneFrame::getSolverOption(void)
+{
+    return this->cSolverOption;
+}
+
+void PlaneFrame::setPanelLength(double dNewPanelLength)
+{
+    this->dPanelLength = dNewPanelLength;
+}
+
+double PlaneFrame::getPanelLength(void)
+{
+    return this->dPanelLength;
+}
+
+void PlaneFrame::setOrderOption(char cNewOrderOption)
+{
+    this->cOrderOption = cNewOrderOption;
+}
+
+char PlaneFrame::getOrderOption(void)
+{
+    return this->cOrderOption;
+}
+
+void PlaneFrame::setExtremeOption(char cNewExtremeOption)
+{
+    this->cExtremeOption = cNewExtremeOption;
+}
+
+char PlaneFrame::getExtremeOption(void)
+{
+    return this->cExtremeOption;
+}
+
 //*************************************************************************
 //*
 //* PlaneFrame::setup
@@ -259,8 +373,16 @@ double PlaneFrame::getShearFactor(void)
 
 bool PlaneFrame::setup(void)
 {
+    // Check the Node Freedom parts fit the System Stiffness Matrix indices...
+    if ( this->ps.uiNodes > (long unsigned int) ( std::numeric_limits<int>::max() / 3 ) )
+    {
+        std::cerr << "\n ERROR: Input file - Number of NODES is too large!\n"
+                  <<   "        CAPS program aborted...\n";
+        return false;
+    }
+
     // Total number of possible Node Freedom parts (Horz, Vert, Rot)...
-    this->ps.siNodeFreedom = this->ps.uiNodes * 3;
+    this->ps.iNodeFreedom = (int) this->ps.uiNodes * 3;
 
     // Number of Node Coordinate parts that have freedom of movement...
     //  Subtract the reaction node's parts that are rigid:
@@ -268,7 +390,7 @@ bool PlaneFrame::setup(void)
     //      FIX PIN: 2 parts are held rigid ( Horz and Vert )
     //      ROL RGD: 2 parts are held rigid ( Horz or Vert, and Rot )
     //      FIX RGD: 3 parts are held rigid ( Horz, Vert, and Rot )
-    this->ps.siNodePinned = this->ps.siNodeFreedom -
+    this->ps.iNodePinned = this->ps.iNodeFreedom -
             (this->ps.siRolPin + (this->ps.siFixPin + this->ps.siRolRgd) * 2 + this->ps.siFixRgd * 3);
 
     // Total number of reaction node definitions...
@@ -310,11 +432,19 @@ bool PlaneFrame::setup(void)
     //*
     //*************************************
 
+    // Index the Nodes, Members, and Member Properties by ID...
+    this->tableNodes.create(this->nodes);
+    this->tableMembers.create(this->members);
+    this->tableMatProps.create(this->mprops);
+
     // Process the Members for Node relationships...
     //   NOTE: Must be done before processReactions()
     if ( ! this->processMembers() )
         return false;
 
+    // Index the Members incident to each Node...
+    this->findIncidence();
+
     // Process the Reactions for Node and Member relations...
     if ( ! this->processReactions() )
         return false;
@@ -323,25 +453,87 @@ bool PlaneFrame::setup(void)
     if ( ! this->findNodeFreedom() )
         return false;
 
-    //  Minimize the structure's Node Bandwidth...
-    if ( ! this->minimizeBandwidth() )
+    // Find the Panels to condense...
+    int iCondensed = 0;
+    if (this->dPanelLength > 0.0)
+        iCondensed = this->findPanels();
+
+    // Select the structure's System Stiffness Matrix solver...
+    //   Auto: large structures use the Sparse solver as any band ordering
+    //   of a grid like frame leaves a wide band...
+    char cSolver = this->cSolverOption;
+    if (cSolver == PlaneFrame::cSolverAuto)
+        cSolver = (this->ps.iNodePinned - iCondensed < PlaneFrame::iSparseThreshold) ?
+                    StiffnessMatrix::cSolverSkyline : StiffnessMatrix::cSolverSparse;
+    this->ssm.setSolver(cSolver);
+
+    // Only the Skyline solvers condense Panels...
+    if ( iCondensed > 0 &&
+         cSolver != StiffnessMatrix::cSolverSkyline && cSolver != StiffnessMatrix::cSolverMixed )
+    {
+        std::cerr << "\n WARNING: Panels are only condensed by the skyline and mixed solvers!\n"
+                  <<   "          Solving without Panels...\n";
+        for (Node * nodeCurr : this->nodes)
+            nodeCurr->bCondensed = false;
+        this->vectPanels.clear();
+        iCondensed = 0;
+    }
+
+    // Large Skyline structures are factored once and cached: a cached
+    //   factor of the same structure also holds its Node sequence...
+    bool bCache = ( cSolver == StiffnessMatrix::cSolverSkyline &&
+                    this->ps.iNodePinned >= PlaneFrame::iCacheThreshold &&
+                    iCondensed == 0 &&
+                    this->ssm.isCacheEnabled() );
+    std::uint64_t uiKey = 0;
+    bool bSequenced = false;
+    if (bCache)
+    {
+        uiKey = this->hashStructure();
+        std::vector<int> vectSequence;
+        if ( this->ssm.openCache(uiKey, (int) this->nodes.size(), vectSequence) )
+        {
+            bSequenced = this->applySequence(vectSequence);
+            if ( ! bSequenced )
+                this->ssm.clear(); // ...close the unusable cached factor
+        }
+    }
+
+    //  Minimize the structure's Node Bandwidth (a cached sequence is kept)...
+    if ( ! this->minimizeBandwidth(bSequenced) )
         return false;
 
+    // Keep the new Node sequence to cache with the factor...
+    if ( bCache && ! bSequenced )
+    {
+        std::vector<int> vectSequence;
+        for (Node * nodeCurr : this->nodes)
+            vectSequence.push_back(nodeCurr->iSequence);
+        this->ssm.setCacheSequence(uiKey, vectSequence);
+    }
+
     // Find the structure's System Stiffness Matrix Size...
-    short int siMatrixSize = this->findSystemStiffnessMatrixSize();
-    if (siMatrixSize != this->ps.siNodePinned)
+    int iMatrixSize = this->findSystemStiffnessMatrixSize();
+    if (iMatrixSize != this->ps.iNodePinned)
     {
         std::cerr << "\n ERROR: Calculated System Stiffness Matrix size does\n"
                   <<   "        NOT match Pinned Node Coordinate Count!\n"
-                  <<   "        SSM (" << siMatrixSize << ") != PNCC (" << this->ps.siNodePinned << ")\n";
+                  <<   "        SSM (" << iMatrixSize << ") != PNCC (" << this->ps.iNodePinned << ")\n";
         return false;
     }
 
+    // Condense the Panels...
+    for (std::vector<Member *> & vectPanelMembers : this->vectPanels)
+    {
+        if ( ! this->ssm.addPanel(vectPanelMembers) )
+            return false;
+    }
+
     // Find the structure's System Stiffness Matrix Bandwidth...
-    short int siBandwidth = this->findSystemStiffnessMatrixBandwidth();
+    int iBandwidth = this->findSystemStiffnessMatrixBandwidth();
 
     // Create the structure's System Stiffness Matrix...
-    if ( ! this->ssm.create(siMatrixSize, siBandwidth, this->members) )
+    if ( ! this->ssm.create(iMatrixSize, iBandwidth, this->members) )
         return false;
 
     // Decompose the stiffness matrix into the A Matrix...
@@ -354,6 +546,72 @@ bool PlaneFrame::setup(void)
 //* End of PlaneFrame::setup
 //***************************************************************************
 
+//***************************************************************************
+//*
+//* PlaneFrame::updateMember
+//*     This function changes the given member to the given Member Property
+//*     after setup, as when a design is resized.  The decomposed SSM is
+//*     updated for the member's stiffness change instead of being created
+//*     and decomposed again.  When the solver's factor cannot be updated,
+//*     the SSM is created and decomposed again.
+//*
+//*     The loads must be analyzed again for the changed structure.
+//*
+//***************************************************************************
+
+bool PlaneFrame::updateMember(int iMemberID, int iMatPropID)
+{
+    Member * member = this->tableMembers.find(iMemberID);
+    if (member == nullptr)
+    {
+        std::cerr << "\n ERROR: Member (" << iMemberID << ") not found in Members!\n";
+        return false;
+    }
+
+    MaterialProperty * mp = this->tableMatProps.find(iMatPropID);
+    if (mp == nullptr)
+    {
+        std::cerr << "\n ERROR: Material property (" << iMatPropID << ") in Member (" << iMemberID << ")\n"
+                  <<   "        not found in Material Properties!\n";
+        return false;
+    }
+    if (member->mp == mp)
+        return true;
+
+    // Find the member's global stiffness change...
+    double adSSM_Delta[6][6];
+    double adSSM_New[6][6];
+    this->ssm.calcGlobalStiffness(member, adSSM_Delta);
+    member->mp = mp;
+    member->iMatPropID = iMatPropID;
+    this->ssm.calcGlobalStiffness(member, adSSM_New);
+    for (short int siIndex1 = 0; siIndex1 < 6; siIndex1++)
+    {
+        for (short int siIndex2 = 0; siIndex2 < 6; siIndex2++)
+            adSSM_Delta[siIndex1][siIndex2] = adSSM_New[siIndex1][siIndex2] - adSSM_Delta[siIndex1][siIndex2];
+    }
+
+    if ( this->ssm.update(member, adSSM_Delta) )
+        return true;
+
+    // ...otherwise, create and decompose the structure's System Stiffness Matrix again...
+    int iMatrixSize = this->ssm.getSystemSize();
+    this->ssm.clear();
+    for (std::vector<Member *> & vectPanelMembers : this->vectPanels)
+    {
+        if ( ! this->ssm.addPanel(vectPanelMembers) )
+            return false;
+    }
+    if ( ! this->ssm.create(iMatrixSize, this->findSystemStiffnessMatrixBandwidth(), this->members) )
+        return false;
+
+    return this->ssm.decompose();
+}
+
+//*
+//* End of PlaneFrame::updateMember
+//***************************************************************************
+
 //***************************************************************************
 //*
 //* PlaneFrame::processMembers
@@ -367,9 +625,12 @@ bool PlaneFrame::setup(void)
 
 bool PlaneFrame::processMembers(void)
 {
-    for (Member * memberCurr : this->members)
+    std::size_t uiMembers = this->members.size();
+    for (std::size_t uiIndex = 0; uiIndex < uiMembers; uiIndex++)
     {
-        if ( ! memberCurr->process(this->mprops, this->nodes) )
+        Member * memberCurr = this->members[uiIndex];
+        memberCurr->iIndex = (int) uiIndex;
+        if ( ! memberCurr->process(this->tableMatProps, this->tableNodes) )
             return false;
     }
 
@@ -379,6 +640,67 @@ bool PlaneFrame::processMembers(void)
 //* End of PlaneFrame::processMembers
 //***************************************************************************
 
+//***************************************************************************
+//*
+//* PlaneFrame::findIncidence
+//*     This function indexes the Members incident to each Node once, so the
+//*     structure's topology is not found again by scanning the Members.  The
+//*     index is compressed: the Members of the Node at position i are
+//*     vectIncidence[ vectIncidenceStart[i] ... vectIncidenceStart[i + 1] - 1 ],
+//*     in Member order.
+//*
+//***************************************************************************
+
+void PlaneFrame::findIncidence(void)
+{
+    std::size_t uiNodes = this->nodes.size();
+    for (std::size_t uiIndex = 0; uiIndex < uiNodes; uiIndex++)
+        this->nodes[uiIndex]->iIndex = (int) uiIndex;
+
+    // Count each Node's Members...
+    this->vectIncidenceStart.assign(uiNodes + 1, 0);
+    for (Member * memberCurr : this->members)
+    {
+        ++this->vectIncidenceStart[memberCurr->nodeNeg->iIndex + 1];
+        ++this->vectIncidenceStart[memberCurr->nodePos->iIndex + 1];
+    }
+    for (std::size_t uiIndex = 0; uiIndex < uiNodes; uiIndex++)
+        this->vectIncidenceStart[uiIndex + 1] += this->vectIncidenceStart[uiIndex];
+
+    // Store each Member with both its Nodes...
+    this->vectIncidence.resize( this->vectIncidenceStart[uiNodes] );
+    std::vector<std::size_t> vectNext( this->vectIncidenceStart.begin(), this->vectIncidenceStart.end() - 1 );
+    for (Member * memberCurr : this->members)
+    {
+        this->vectIncidence[ vectNext[memberCurr->nodeNeg->iIndex]++ ] = memberCurr;
+        this->vectIncidence[ vectNext[memberCurr->nodePos->iIndex]++ ] = memberCurr;
+    }
+}
+
+//*
+//* End of PlaneFrame::findIncidence
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::getIncidentMembers
+//*     This function gives the Members incident to the given Node, in
+//*     Member order, from the incidence index.
+//*
+//***************************************************************************
+
+std::span<Member *> PlaneFrame::getIncidentMembers(Node * nodeCurr)
+{
+    std::size_t uiFirst = this->vectIncidenceStart[nodeCurr->iIndex];
+    std::size_t uiLast = this->vectIncidenceStart[nodeCurr->iIndex + 1];
+
+    return std::span<Member *>( this->vectIncidence.data() + uiFirst, uiLast - uiFirst );
+}
+
+//*
+//* End of PlaneFrame::getIncidentMembers
+//***************************************************************************
+
 //***************************************************************************
 //*
 //* PlaneFrame::processReactions
@@ -391,12 +713,12 @@ bool PlaneFrame::processReactions(void)
 {
     for (Reaction * reactCurr : this->react)
     {
-        // Link Members to Reactions...
-        if ( ! reactCurr->linkMembers(this->members) )
+        // Link Nodes to Reactions...
+        if ( ! reactCurr->linkNodes(this->tableNodes) )
             return false;
 
-        // Link Nodes to Reactions...
-        if ( ! reactCurr->linkNodes(this->nodes) )
+        // Link Members to Reactions...
+        if ( ! reactCurr->linkMembers( this->getIncidentMembers(reactCurr->nodeReact) ) )
             return false;
     }
 
@@ -492,12 +814,12 @@ bool PlaneFrame::findNodeFreedom()
 {
     for (Node * nodeCurr : this->nodes)
     {
-        if ( nodeCurr->siSequence == 0 ) // Not Used...
-            this->ps.siNodePinned -= 3;  // ...remove Horz, Vert, Rot
+        if ( nodeCurr->iSequence == 0 ) // Not Used...
+            this->ps.iNodePinned -= 3;  // ...remove Horz, Vert, Rot
         else // Used...
         {
             // Count all the used nodes...
-            Node::siUsedSize++;
+            Node::iUsedSize++;
 
             // Set largest Node Degrees...
             if (nodeCurr->siDegrees > Node::siLargestDegrees)
@@ -528,10 +850,10 @@ bool PlaneFrame::findNodeFreedom()
             // Therefore, when a node is FREE via Member analysis...
             if ( nodeCurr->bMemberFixture )
             {
-                nodeCurr->siRotFlag = true; // ...set node rotation FIXED as we DO NOT want
+                nodeCurr->iRotFlag = true; // ...set node rotation FIXED as we DO NOT want
                                             //    Member ends attached to the node to transfer
                                             //    energy.
-                this->ps.siNodePinned--;    // ...and reduce unknowns for calculation: moment
+                this->ps.iNodePinned--;    // ...and reduce unknowns for calculation: moment
                                             //    is zero (0).
             }
         }
@@ -543,37 +865,233 @@ bool PlaneFrame::findNodeFreedom()
 //* End of PlaneFrame::findNodeFreedom
 //***************************************************************************
 
+//***************************************************************************
+//*
+//* PlaneFrame::findNodeGraph
+//*     This function finds the Node adjacency graph of the (condensed)
+//*     System Stiffness Matrix: the Used Nodes, except the Interior Nodes
+//*     of condensed Panels, connected by their Members.  A Panel's Members
+//*     are replaced by the coupling of all its Boundary Nodes.  The graph
+//*     Nodes (in input order) and their FREE equation counts are listed.
+//*
+//***************************************************************************
+
+void PlaneFrame::findNodeGraph(NodeGraph & graph, std::vector<Node *> & vectGraphNodes,
+                               std::vector<int> & vectFreedom)
+{
+    // Number the Used Nodes of the (condensed) SSM...
+    vectGraphNodes.clear();
+    vectFreedom.clear();
+    std::unordered_map<Node *, int> mapGraphIndex;
+    for (Node * nodeCurr : this->nodes)
+    {
+        if (nodeCurr->iSequence == 0 || nodeCurr->bCondensed) // ...not Used Node or Interior Node
+            continue;
+        mapGraphIndex[nodeCurr] = (int) vectGraphNodes.size();
+        vectGraphNodes.push_back(nodeCurr);
+        vectFreedom.push_back( (nodeCurr->iHorzFlag == 0) + (nodeCurr->iVertFlag == 0) + (nodeCurr->iRotFlag == 0) );
+    }
+
+    // Connect each Panel's Boundary Nodes...
+    std::vector<std::pair<int, int>> vectEdges;
+    std::unordered_set<Member *> setPanelMembers;
+    for (std::vector<Member *> & vectPanelMembers : this->vectPanels)
+    {
+        std::vector<int> vectBoundary;
+        for (Member * memberCurr : vectPanelMembers)
+        {
+            setPanelMembers.insert(memberCurr);
+            for (Node * nodeCurr : { memberCurr->nodeNeg, memberCurr->nodePos })
+            {
+                if ( ! nodeCurr->bCondensed )
+                    vectBoundary.push_back( mapGraphIndex[nodeCurr] );
+            }
+        }
+        for (int iNodeA : vectBoundary)
+        {
+            for (int iNodeB : vectBoundary)
+            {
+                if (iNodeA < iNodeB)
+                    vectEdges.emplace_back(iNodeA, iNodeB);
+            }
+        }
+    }
+
+    // Connect each other Member's Nodes...
+    for (Member * memberCurr : this->members)
+    {
+        if ( setPanelMembers.count(memberCurr) )
+            continue;
+        vectEdges.emplace_back( mapGraphIndex[memberCurr->nodeNeg], mapGraphIndex[memberCurr->nodePos] );
+    }
+
+    graph.create( (int) vectGraphNodes.size(), vectEdges );
+}
+
+//*
+//* End of PlaneFrame::findNodeGraph
+//***************************************************************************
+
 //***************************************************************************
 //*
 //* PlaneFrame::minimizeBandwidth
 //*     This function reduces the System Stiffness Matrix (SSM) "distance"
 //*     between a Member's two end Nodes by assigning sequence numbers to
-//*     each Node, analyzing the numeric difference between all connected
-//*     Nodes, and re-sequencing the Nodes so the numeric difference between
-//*     connected nodes is as minimal as possible.
+//*     each Node.  The Used Nodes are ordered on the Node adjacency graph
+//*     by the ordering option:
+//*       Auto   - the least profile (then bandwidth) of RCM, Sloan and GPS
+//*       RCM    - Reverse Cuthill-McKee
+//*       Sloan  - Sloan's profile reduction
+//*       GPS    - Gibbs-Poole-Stockmeyer
+//*       Legacy - the PPSA ordering by Node degree, for prior results
+//*     A cached Node sequence (the given flag) is kept instead.
+//*
+//*     The bandwidth and profile of the input and the ordered sequence are
+//*     kept for the report.  The Used Nodes are listed in sequence order
+//*     for the later steps.
+//*
+//*     When Panels are condensed, the graph is the condensed SSM's graph.
+//*     The Interior Nodes are sequenced last, Panel by Panel.
+//
+//***************************************************************************
+
+bool PlaneFrame::minimizeBandwidth(bool bSequenced)
+{
+    NodeGraph graph;
+    std::vector<Node *> vectGraphNodes;
+    std::vector<int> vectFreedom;
+    this->findNodeGraph(graph, vectGraphNodes, vectFreedom);
+    int iGraphSize = (int) vectGraphNodes.size();
+
+    // Measure the input Node sequence...
+    std::vector<int> vectOrder(iGraphSize);
+    for (int iNode = 0; iNode < iGraphSize; iNode++)
+        vectOrder[iNode] = iNode;
+    graph.measure(vectOrder, vectFreedom, this->aiOrderBandwidth[0], this->auiOrderProfile[0]);
+
+    // List the orderings to try...
+    std::vector<char> vectOrderings;
+    if (bSequenced)
+        vectOrderings = { PlaneFrame::cOrderCached };
+    else if (this->cOrderOption == PlaneFrame::cOrderAuto)
+        vectOrderings = { NodeGraph::cOrderRCM, NodeGraph::cOrderSloan, NodeGraph::cOrderGPS };
+    else
+        vectOrderings = { this->cOrderOption };
+
+    // Keep the ordering of the least profile, then bandwidth...
+    std::vector<int> vectBest;
+    for (char cOrdering : vectOrderings)
+    {
+        switch (cOrdering)
+        {
+            case NodeGraph::cOrderRCM:
+                graph.orderRCM(vectOrder);
+                break;
+
+            case NodeGraph::cOrderSloan:
+                graph.orderSloan(vectOrder);
+                break;
+
+            case NodeGraph::cOrderGPS:
+                graph.orderGPS(vectOrder);
+                break;
+
+            default: // ...Legacy or Cached: order by the Node sequence
+                if ( cOrdering == PlaneFrame::cOrderLegacy && ! this->orderLegacy() )
+                    return false;
+                vectOrder.resize(iGraphSize);
+                for (int iNode = 0; iNode < iGraphSize; iNode++)
+                    vectOrder[iNode] = iNode;
+                std::sort( vectOrder.begin(), vectOrder.end(),
+                           [&vectGraphNodes](int iNodeA, int iNodeB)
+                           { return vectGraphNodes[iNodeA]->iSequence < vectGraphNodes[iNodeB]->iSequence; } );
+                break;
+        }
+
+        int iBandwidth = 0;
+        std::size_t uiProfile = 0;
+        graph.measure(vectOrder, vectFreedom, iBandwidth, uiProfile);
+        if ( vectBest.empty() || uiProfile < this->auiOrderProfile[1] ||
+             ( uiProfile == this->auiOrderProfile[1] && iBandwidth < this->aiOrderBandwidth[1] ) )
+        {
+            vectBest = vectOrder;
+            this->cOrderUsed = cOrdering;
+            this->aiOrderBandwidth[1] = iBandwidth;
+            this->auiOrderProfile[1] = uiProfile;
+        }
+    }
+
+    // Set the Node Sequence numbers to the ordering and list the Nodes
+    //   by sequence...
+    this->vectSequenceNodes.clear();
+    this->vectSequenceNodes.reserve(Node::iUsedSize);
+    int iSequence = 0;
+    for (int iNode : vectBest)
+    {
+        vectGraphNodes[iNode]->iSequence = ++iSequence;
+        this->vectSequenceNodes.push_back(vectGraphNodes[iNode]);
+    }
+
+    // Sequence the Interior Nodes last...
+    std::unordered_set<Node *> setInterior;
+    for (std::vector<Member *> & vectPanelMembers : this->vectPanels)
+    {
+        for (Member * memberCurr : vectPanelMembers)
+        {
+            for (Node * nodeCurr : { memberCurr->nodeNeg, memberCurr->nodePos })
+            {
+                if ( nodeCurr->bCondensed && setInterior.insert(nodeCurr).second )
+                {
+                    nodeCurr->iSequence = ++iSequence;
+                    this->vectSequenceNodes.push_back(nodeCurr);
+                }
+            }
+        }
+    }
+
+    if (iSequence != Node::iUsedSize)
+    {
+        std::cerr << "\n ERROR (minimizeBandwidth): Sequenced " << iSequence
+                  << " of " << Node::iUsedSize << " Used Nodes!\n";
+        return false;
+    }
+
+    return true;
+}
+//*
+//* End of PlaneFrame::minimizeBandwidth
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::orderLegacy
+//*     This function is the PPSA ordering.  It reduces the System
+//*     Stiffness Matrix (SSM) "distance" between a Member's two end Nodes
+//*     by assigning sequence numbers to each Node, analyzing the numeric
+//*     difference between all connected Nodes, and re-sequencing the Nodes
+//*     so the numeric difference between connected nodes is as minimal as
+//*     possible.
 //*
 //*     Then, the minimized difference is the minimal width from the diagonal
 //*     of the sparse, square SSM.
 //*
-//*     NOTE: Resequencing the Node numbering scheme takes place here. The
-//*         program currently tries to minimize the bandwidth of the matrix,
-//*         but the banding method is not 'fool proof' as a Node's Member
+//*     NOTE: The banding method is not 'fool proof' as a Node's Member
 //*         count may be the same size as other counts (then, the selected
-//*         Node may not be optimal).  UPDATE if a better 'fool proof'
-//*         resequencing function is found.
+//*         Node may not be optimal).  It is kept to reproduce prior
+//*         results.
 //
 //***************************************************************************
 
-bool PlaneFrame::minimizeBandwidth(void)
+bool PlaneFrame::orderLegacy(void)
 {
     //*************************************************
     //* Allocate memory for Degree of Node Usage...
     //*************************************************
 
-    NodeDegree * aNodeDegree = new NodeDegree[Node::siUsedSize];
+    NodeDegree * aNodeDegree = new NodeDegree[Node::iUsedSize];
     if ( aNodeDegree == nullptr )
     {
-        std::cerr << "\n ERROR (minimizeBandwidth): Out of memory allocating Node Degree!\n";
+        std::cerr << "\n ERROR (orderLegacy): Out of memory allocating Node Degree!\n";
         return false;
     }
 
@@ -584,7 +1102,7 @@ bool PlaneFrame::minimizeBandwidth(void)
     NodeDegree * aAdjacentNodeDegree = new NodeDegree[Node::siLargestDegrees];
     if ( aAdjacentNodeDegree == nullptr )
     {
-    	std::cerr << "\n ERROR (minimizeBandwidth): Out of memory allocating Adjacent Node Degree!\n";
+    	std::cerr << "\n ERROR (orderLegacy): Out of memory allocating Adjacent Node Degree!\n";
         return false;
     }
 
@@ -592,23 +1110,26 @@ bool PlaneFrame::minimizeBandwidth(void)
     //* Load NodeDegree info from Nodes...
     //***********************************************************
 
-    short int siIndex = 0;
-    short int siCurrentIndex = 0;
+    int iIndex = 0;
+    int iCurrentIndex = 0;
+    std::vector<int> vectDegreeIndex(this->nodes.size(), -1);    // NodeDegree of each Node
+    std::vector<int> vectSequenceIndex(Node::iUsedSize + 2, -1); // NodeDegree of each sequence number
     for (Node * nodeCurr : this->nodes)
     {
-        if (nodeCurr->siSequence == 0) // ...not Used Node
+        if (nodeCurr->iSequence == 0) // ...not Used Node
             continue; // ...get next node
 
         // Set each Node Degree's values...
-        aNodeDegree[siIndex].node = nodeCurr;
-        aNodeDegree[siIndex].siSequence = 0;
-        aNodeDegree[siIndex].siDegrees = nodeCurr->siDegrees;
+        vectDegreeIndex[nodeCurr->iIndex] = iIndex;
+        aNodeDegree[iIndex].node = nodeCurr;
+        aNodeDegree[iIndex].iSequence = 0;
+        aNodeDegree[iIndex].siDegrees = nodeCurr->siDegrees;
 
         // Find Lowest Degree of Node Usage...
-        if (aNodeDegree[siCurrentIndex].siDegrees > aNodeDegree[siIndex].siDegrees)
-            siCurrentIndex = siIndex;
+        if (aNodeDegree[iCurrentIndex].siDegrees > aNodeDegree[iIndex].siDegrees)
+            iCurrentIndex = iIndex;
 
-        ++siIndex;
+        ++iIndex;
     }
 
     //******************************************
@@ -618,188 +1139,388 @@ bool PlaneFrame::minimizeBandwidth(void)
     //
     // Set First Node Degree's sequence number...
     //
-    short int siLocation = 1;
-    aNodeDegree[siCurrentIndex].siSequence = siLocation;
+    int iLocation = 1;
+    aNodeDegree[iCurrentIndex].iSequence = iLocation;
+    vectSequenceIndex[iLocation] = iCurrentIndex;
 
     //
     // Set Other Node Degrees' sequence numbers...
     //
-    for (short int siNodeSequence = 1; siNodeSequence < Node::siUsedSize; siNodeSequence++)
+    for (int iNodeSequence = 1; iNodeSequence < Node::iUsedSize; iNodeSequence++)
     {
         //
         // Get the Adjacent Degree List...
         //
-        short int siAdjacentNodeSize = 0;
-        for (Member * memberCurr : this->members)
+        int iAdjacentNodeSize = 0;
+        for ( Member * memberCurr : this->getIncidentMembers(aNodeDegree[iCurrentIndex].node) )
         {
-            // For the Current Node, find a Member using it and it's opposing Node...
+            // For the Current Node's Member, find its opposing Node...
             Node * nodeOpposite = nullptr;
-            if (aNodeDegree[siCurrentIndex].node == memberCurr->nodeNeg)
+            if (aNodeDegree[iCurrentIndex].node == memberCurr->nodeNeg)
                 nodeOpposite = memberCurr->nodePos;
-            else if (aNodeDegree[siCurrentIndex].node == memberCurr->nodePos)
+            else
                 nodeOpposite = memberCurr->nodeNeg;
-            if (nodeOpposite == nullptr)
-                continue;
 
             //
             // Add Adjacent Node NodeDegree to AdjacentNodeDegree List...
             //
-            for ( siIndex = 0; siIndex < Node::siUsedSize; siIndex++, (siIndex == siCurrentIndex) ? siIndex++ : false )
-            {
-                // Find the same Member's opposite Node...
-                if (aNodeDegree[siIndex].node == nodeOpposite)
-                {
-                    aAdjacentNodeDegree[siAdjacentNodeSize] = aNodeDegree[siIndex];
-                    ++siAdjacentNodeSize;
-                    break;
-                }
-            }
+            aAdjacentNodeDegree[iAdjacentNodeSize] = aNodeDegree[ vectDegreeIndex[nodeOpposite->iIndex] ];
+            ++iAdjacentNodeSize;
         }
 
         //
         // Sort Adjacent Degree List from Lowest to Highest...
         //
-        short int siLowerIndex = 0;
+        int iLowerIndex = 0;
         NodeDegree nodedegreeLow = aAdjacentNodeDegree[0];
-        for (short int siLowIndex = 0; siLowIndex < siAdjacentNodeSize - 1; siLowIndex++)
+        for (int iLowIndex = 0; iLowIndex < iAdjacentNodeSize - 1; iLowIndex++)
         {
-            siLowerIndex = siLowIndex;
-            for (short int siANDIndex = siLowIndex + 1; siANDIndex < siAdjacentNodeSize; siANDIndex++)
+            iLowerIndex = iLowIndex;
+            for (int iANDIndex = iLowIndex + 1; iANDIndex < iAdjacentNodeSize; iANDIndex++)
             {
-                if (aAdjacentNodeDegree[siLowerIndex].siDegrees > aAdjacentNodeDegree[siANDIndex].siDegrees)
-                    siLowerIndex = siANDIndex;
+                if (aAdjacentNodeDegree[iLowerIndex].siDegrees > aAdjacentNodeDegree[iANDIndex].siDegrees)
+                    iLowerIndex = iANDIndex;
             }
-            if (siLowerIndex > siLowIndex) // SWAP...
+            if (iLowerIndex > iLowIndex) // SWAP...
             {
-                nodedegreeLow = aAdjacentNodeDegree[siLowIndex];
-                aAdjacentNodeDegree[siLowIndex] = aAdjacentNodeDegree[siLowerIndex];
-                aAdjacentNodeDegree[siLowerIndex] = nodedegreeLow;
+                nodedegreeLow = aAdjacentNodeDegree[iLowIndex];
+                aAdjacentNodeDegree[iLowIndex] = aAdjacentNodeDegree[iLowerIndex];
+                aAdjacentNodeDegree[iLowerIndex] = nodedegreeLow;
             }
         }
 
         //
         // Set AdjacentNodeDegrees to new sequence number...
         //
-        for (short int siANDIndex = 0; siANDIndex < siAdjacentNodeSize; siANDIndex++)
+        for (int iANDIndex = 0; iANDIndex < iAdjacentNodeSize; iANDIndex++)
         {
             // Find the NodeDegree of the current AdjacentNodeDegree...
-            siIndex = 0;
-            while (aNodeDegree[siIndex].node != aAdjacentNodeDegree[siANDIndex].node && siIndex < Node::siUsedSize)
-                siIndex++;
+            iIndex = vectDegreeIndex[ aAdjacentNodeDegree[iANDIndex].node->iIndex ];
 
             //  If the found NodeDegree has NOT already been set to a sequence...
-            if (siIndex < Node::siUsedSize && ( ! aNodeDegree[siIndex].siSequence ) )
+            if ( ! aNodeDegree[iIndex].iSequence )
             {
-                ++siLocation;
-                aNodeDegree[siIndex].siSequence = siLocation; // ...set the sequence
+                ++iLocation;
+                aNodeDegree[iIndex].iSequence = iLocation; // ...set the sequence
+                vectSequenceIndex[iLocation] = iIndex;
             }
         }
 
         //
         // Set Next Current NodeDegree as the next lowest NodeDegree that has been set...
         //
-        for (siIndex = 0; siIndex < Node::siUsedSize; siIndex++)
-        {
-            if (aNodeDegree[siIndex].siSequence == siNodeSequence + 1)
-            {
-                siCurrentIndex = siIndex;
-                break;
-            }
-        }
+        if (vectSequenceIndex[iNodeSequence + 1] >= 0)
+            iCurrentIndex = vectSequenceIndex[iNodeSequence + 1];
     }
 
     //
     // Set the Node Sequence numbers to the "optimized" NodeDegree Sequence numbers...
     //
-    for (siIndex = 0; siIndex < Node::siUsedSize; siIndex++)
-        aNodeDegree[siIndex].node->siSequence = aNodeDegree[siIndex].siSequence;
+    for (iIndex = 0; iIndex < Node::iUsedSize; iIndex++)
+        aNodeDegree[iIndex].node->iSequence = aNodeDegree[iIndex].iSequence;
 
     // Clear Degree Lists...
     delete aNodeDegree;
     delete aAdjacentNodeDegree;
 
+    // A Node not reached from the first (a separate structure) is not sequenced...
+    if (iLocation != Node::iUsedSize)
+    {
+        std::cerr << "\n ERROR (orderLegacy): Sequenced " << iLocation
+                  << " of " << Node::iUsedSize << " Used Nodes!\n"
+                  <<   "        Use another Node ordering...\n";
+        return false;
+    }
+
     return true;
 }
 //*
-//* End of PlaneFrame::minimizeBandwidth
+//*
+//* End of PlaneFrame::orderLegacy
 //***************************************************************************
 
 //***************************************************************************
 //*
-//* PlaneFrame::findSystemStiffnessMatrixSize
-//*     This function finds the Matrix Size (the length of a side of a
-//*     Square Matrix) of the System Stiffness Matrix.
-//*
-//*     It uses the Degrees of Freedom (DoF) Indices for each node.  The
-//*     indices are initially used as flags and transformed here to indices:
-//*       All DoF Indices set ON (FIXED) are set to UNUSED (0).
-//*       All DoF Indices set OFF (FREE) are set to a sequence of index
-//*         locations into the System Stiffness Matrix.
-//*     Therefore, the matrix array is index 1 based, not 0 based, as 0
-//*     indicated unused.
-//*
-//*     The Matrix Size is calculated as the set of stiffness equations
-//*     used to calculate for unknowns (FREE flags).  The last index sequence
-//*     set is the size of the System Stiffness Matrix.
+//* PlaneFrame::hashStructure
+//*     This function finds the key of the structure's factored System
+//*     Stiffness Matrix.  It hashes every input the factor depends on:
+//*     the processing, solver, kernel and ordering options, the Nodes and their
+//*     freedom, the Members, the Material Properties and the Reactions.
+//*     Any change to them changes the key, so a cached factor is never
+//*     used for another structure.
 //*
 //***************************************************************************
 
-short int PlaneFrame::findSystemStiffnessMatrixSize(void)
+std::uint64_t PlaneFrame::hashStructure(void)
 {
+    std::uint64_t uiKey = FactorCache::hashStart();
+
+    uiKey = FactorCache::hash( uiKey, (std::uint64_t) this->cProcessingOption );
+    uiKey = FactorCache::hash( uiKey, this->dShearFactor );
+    uiKey = FactorCache::hash( uiKey, (std::uint64_t) this->ssm.getSolver() );
+    uiKey = FactorCache::hash( uiKey, (std::uint64_t) this->ssm.getKernel() );
+    uiKey = FactorCache::hash( uiKey, (std::uint64_t) this->cOrderOption );
 
-    short int siMatrixIndex = 0;
-    for (short int siSequence = 1; ; siSequence++)
+    uiKey = FactorCache::hash( uiKey, (std::uint64_t) this->nodes.size() );
+    for (Node * nodeCurr : this->nodes)
     {
-        // Select each node in SEQUENCE order....
-        Node * nodeCurr = nullptr;
-        for (Node * nodeFind : this->nodes)
-        {
-            if ( nodeFind->siSequence == siSequence)
-            {
-                nodeCurr = nodeFind;
-                break;
-            }
-        }
-        if (nodeCurr == nullptr)
-            break;
+        uiKey = FactorCache::hash( uiKey, (std::uint64_t) nodeCurr->iID );
+        uiKey = FactorCache::hash( uiKey, nodeCurr->adPoint[X] );
+        uiKey = FactorCache::hash( uiKey, nodeCurr->adPoint[Y] );
+        uiKey = FactorCache::hash( uiKey, (std::uint64_t) (nodeCurr->iSequence != 0) );
+        uiKey = FactorCache::hash( uiKey, (std::uint64_t) nodeCurr->iHorzFlag );
+        uiKey = FactorCache::hash( uiKey, (std::uint64_t) nodeCurr->iVertFlag );
+        uiKey = FactorCache::hash( uiKey, (std::uint64_t) nodeCurr->iRotFlag );
+    }
 
-        if (nodeCurr->siHorzFlag)     // ...node's horizontal is FIXED...
-            nodeCurr->siHorzFlag = 0; // ...don't need it
-        else // ...horizontal is FREE...
-        {
-            ++siMatrixIndex;
-            // ...store its horizontal matrix index...
-            nodeCurr->siHorzFlag = siMatrixIndex;
-        }
+    uiKey = FactorCache::hash( uiKey, (std::uint64_t) this->members.size() );
+    for (Member * memberCurr : this->members)
+    {
+        uiKey = FactorCache::hash( uiKey, (std::uint64_t) memberCurr->iID );
+        uiKey = FactorCache::hash( uiKey, (std::uint64_t) memberCurr->iNegNodeID );
+        uiKey = FactorCache::hash( uiKey, (std::uint64_t) memberCurr->iPosNodeID );
+        uiKey = FactorCache::hash( uiKey, (std::uint64_t) memberCurr->iMatPropID );
+        uiKey = FactorCache::hash( uiKey, (std::uint64_t) memberCurr->bJointNeg );
+        uiKey = FactorCache::hash( uiKey, (std::uint64_t) memberCurr->bJointPos );
+        uiKey = FactorCache::hash( uiKey, memberCurr->dEffColumnLength_IP );
+        uiKey = FactorCache::hash( uiKey, memberCurr->dEffColumnLength_PP );
+        uiKey = FactorCache::hash( uiKey, memberCurr->dEffBendingLength );
+        uiKey = FactorCache::hash( uiKey, memberCurr->dVolumeFactor );
+    }
 
-        // TODO: Check for ROLL Vector, 'cause FIXED also means Vector Free
-        //       when Y value != 0.0
-        if (nodeCurr->siVertFlag)     // ...node's vertical is FIXED...
-            nodeCurr->siVertFlag = 0; // ...don't need it
-        else // ...vertical is FREE...
-        {
-            ++siMatrixIndex;
-            // ...store its vertical matrix index...
-            nodeCurr->siVertFlag = siMatrixIndex;
-        }
+    uiKey = FactorCache::hash( uiKey, (std::uint64_t) this->mprops.size() );
+    for (MaterialProperty * mpCurr : this->mprops)
+    {
+        uiKey = FactorCache::hash( uiKey, (std::uint64_t) mpCurr->iID );
+        uiKey = FactorCache::hash( uiKey, mpCurr->dMoE_IP );
+        uiKey = FactorCache::hash( uiKey, mpCurr->dMoE_PP );
+        uiKey = FactorCache::hash( uiKey, mpCurr->dMoE_Axial );
+        uiKey = FactorCache::hash( uiKey, mpCurr->dShearModulus );
+        uiKey = FactorCache::hash( uiKey, mpCurr->dThick );
+        uiKey = FactorCache::hash( uiKey, mpCurr->dHeight );
+        uiKey = FactorCache::hash( uiKey, mpCurr->dArea );
+        uiKey = FactorCache::hash( uiKey, mpCurr->dMoI );
+        uiKey = FactorCache::hash( uiKey, mpCurr->dSectionModulus );
+        uiKey = FactorCache::hash( uiKey, mpCurr->dForceBend );
+        uiKey = FactorCache::hash( uiKey, mpCurr->dForceComp );
+        uiKey = FactorCache::hash( uiKey, mpCurr->dForceTens );
+        uiKey = FactorCache::hash( uiKey, (std::uint64_t) mpCurr->cProperty );
+        uiKey = FactorCache::hash( uiKey, (std::uint64_t) mpCurr->isFictitious() );
+    }
+
+    uiKey = FactorCache::hash( uiKey, (std::uint64_t) this->react.size() );
+    for (Reaction * reactCurr : this->react)
+    {
+        uiKey = FactorCache::hash( uiKey, (std::uint64_t) reactCurr->iNodeID );
+        uiKey = FactorCache::hash( uiKey, (std::uint64_t) reactCurr->siType );
+        uiKey = FactorCache::hash( uiKey, reactCurr->dVector[X] );
+        uiKey = FactorCache::hash( uiKey, reactCurr->dVector[Y] );
+    }
+
+    return uiKey;
+}
+
+//*
+//* End of PlaneFrame::hashStructure
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::applySequence
+//*     This function sets the Node sequence numbers from a cached sequence
+//*     (one per Node).  The sequence is only applied when it is a proper
+//*     sequence of the Used Nodes: unused Nodes are not sequenced and the
+//*     sequence numbers run from 1 without a gap or repeat.
+//*
+//***************************************************************************
+
+bool PlaneFrame::applySequence(std::vector<int> & vectSequence)
+{
+    if ( vectSequence.size() != this->nodes.size() )
+        return false;
+
+    std::vector<bool> vectUsed(Node::iUsedSize + 1, false);
+    int iCount = 0;
+    int iLast = 0;
+    for (std::size_t uiIndex = 0; uiIndex < this->nodes.size(); uiIndex++)
+    {
+        int iSequence = vectSequence[uiIndex];
+        if (iSequence == 0)
+            continue;
+        if ( this->nodes[uiIndex]->iSequence == 0 || // ...not Used Node
+             iSequence < 0 || iSequence > Node::iUsedSize ||
+             vectUsed[iSequence] )
+            return false;
+        vectUsed[iSequence] = true;
+        ++iCount;
+        if (iLast < iSequence)
+            iLast = iSequence;
+    }
+    if (iLast != iCount) // ...gap
+        return false;
+
+    for (std::size_t uiIndex = 0; uiIndex < this->nodes.size(); uiIndex++)
+        this->nodes[uiIndex]->iSequence = vectSequence[uiIndex];
+
+    return true;
+}
+
+//*
+//* End of PlaneFrame::applySequence
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::findSystemStiffnessMatrixSize
+//*     This function finds the Matrix Size (the length of a side of a
+//*     Square Matrix) of the System Stiffness Matrix.
+//*
+//*     It uses the Degrees of Freedom (DoF) Indices for each node.  The
+//*     indices are initially used as flags and transformed here to indices:
+//*       All DoF Indices set ON (FIXED) are set to UNUSED (0).
+//*       All DoF Indices set OFF (FREE) are set to a sequence of index
+//*         locations into the System Stiffness Matrix.
+//*     Therefore, the matrix array is index 1 based, not 0 based, as 0
+//*     indicated unused.
+//*
+//*     The Matrix Size is calculated as the set of stiffness equations
+//*     used to calculate for unknowns (FREE flags).  The last index sequence
+//*     set is the size of the System Stiffness Matrix.
+//*
+//*     The Interior Nodes of condensed Panels are indexed after all the
+//*     other Nodes, so the condensed SSM is the leading equations.
+//*
+//*     The Nodes are taken from the sequence list of minimizeBandwidth,
+//*     so each Node is visited once.
+//*
+//***************************************************************************
+
+int PlaneFrame::findSystemStiffnessMatrixSize(void)
+{
 
-        if (nodeCurr->siRotFlag)     // ...node's rotation is FIXED...
-            nodeCurr->siRotFlag = 0; // ...don't need it
-        else // ...rotation is FREE...
+    int iMatrixIndex = 0;
+    for (short int siPass = 0; siPass < 2; siPass++)
+    {
+        // Select each node in SEQUENCE order....
+        for (Node * nodeCurr : this->vectSequenceNodes)
         {
-            ++siMatrixIndex;
-            // ...store its moment matrix index...
-            nodeCurr->siRotFlag = siMatrixIndex;
+            if ( nodeCurr->bCondensed != (siPass == 1) ) // ...not indexed on this pass...
+                continue;
+
+            if (nodeCurr->iHorzFlag)     // ...node's horizontal is FIXED...
+                nodeCurr->iHorzFlag = 0; // ...don't need it
+            else // ...horizontal is FREE...
+            {
+                ++iMatrixIndex;
+                // ...store its horizontal matrix index...
+                nodeCurr->iHorzFlag = iMatrixIndex;
+            }
+
+            // TODO: Check for ROLL Vector, 'cause FIXED also means Vector Free
+            //       when Y value != 0.0
+            if (nodeCurr->iVertFlag)     // ...node's vertical is FIXED...
+                nodeCurr->iVertFlag = 0; // ...don't need it
+            else // ...vertical is FREE...
+            {
+                ++iMatrixIndex;
+                // ...store its vertical matrix index...
+                nodeCurr->iVertFlag = iMatrixIndex;
+            }
+
+            if (nodeCurr->iRotFlag)     // ...node's rotation is FIXED...
+                nodeCurr->iRotFlag = 0; // ...don't need it
+            else // ...rotation is FREE...
+            {
+                ++iMatrixIndex;
+                // ...store its moment matrix index...
+                nodeCurr->iRotFlag = iMatrixIndex;
+            }
         }
     }
 
     // The resulting last matrix index is the matrix size...
-    return siMatrixIndex;
+    return iMatrixIndex;
 }
 //*
 //* End of PlaneFrame::findSystemStiffnessMatrixSize
 //***************************************************************************
 
+//***************************************************************************
+//*
+//* PlaneFrame::findPanels
+//*     This function groups the Members into Panels of the Panel Length
+//*     along X, from the lowest X of the used Nodes, by their midpoints.
+//*     A Node only used by the Members of one Panel and not a Reaction is
+//*     an Interior Node of the Panel.  Each Panel with an Interior Node is
+//*     kept to condense and its Interior Nodes are marked.
+//*
+//*     The count of FREE Interior equations to condense is returned.
+//*
+//***************************************************************************
+
+int PlaneFrame::findPanels(void)
+{
+    this->vectPanels.clear();
+
+    double dOrigin = std::numeric_limits<double>::max();
+    for (Node * nodeCurr : this->nodes)
+    {
+        if (nodeCurr->iSequence != 0) // ...Used Node
+            dOrigin = std::min(dOrigin, nodeCurr->adPoint[X]);
+    }
+
+    // Group the Members by Panel and find each Node's Panel...
+    const long int liShared = std::numeric_limits<long int>::min();
+    std::map<long int, std::vector<Member *>> mapPanels;
+    std::unordered_map<Node *, long int> mapNodePanel;
+    for (Member * memberCurr : this->members)
+    {
+        double dMiddle = 0.5 * ( memberCurr->nodeNeg->adPoint[X] + memberCurr->nodePos->adPoint[X] );
+        long int liPanel = (long int) std::floor( (dMiddle - dOrigin) / this->dPanelLength );
+        mapPanels[liPanel].push_back(memberCurr);
+
+        for (Node * nodeCurr : { memberCurr->nodeNeg, memberCurr->nodePos })
+        {
+            auto iterNode = mapNodePanel.find(nodeCurr);
+            if ( iterNode == mapNodePanel.end() )
+                mapNodePanel[nodeCurr] = liPanel;
+            else if (iterNode->second != liPanel)
+                iterNode->second = liShared;
+        }
+    }
+    for (Reaction * reactCurr : this->react)
+        mapNodePanel[reactCurr->nodeReact] = liShared;
+
+    // Mark the Interior Nodes and count their FREE equations...
+    int iCondensed = 0;
+    for (auto & pairNode : mapNodePanel)
+    {
+        Node * nodeCurr = pairNode.first;
+        nodeCurr->bCondensed = (pairNode.second != liShared);
+        if (nodeCurr->bCondensed)
+            iCondensed += (nodeCurr->iHorzFlag == 0) + (nodeCurr->iVertFlag == 0) + (nodeCurr->iRotFlag == 0);
+    }
+
+    // Keep the Panels holding an Interior Node...
+    for (auto & pairPanel : mapPanels)
+    {
+        for (Member * memberCurr : pairPanel.second)
+        {
+            if (memberCurr->nodeNeg->bCondensed || memberCurr->nodePos->bCondensed)
+            {
+                this->vectPanels.push_back(pairPanel.second);
+                break;
+            }
+        }
+    }
+
+    return iCondensed;
+}
+
+//*
+//* End of PlaneFrame::findPanels
+//***************************************************************************
+
 //***************************************************************************
 //*
 //* PlaneFrame::findSystemStiffnessMatrixBandwidth
@@ -809,39 +1530,39 @@ short int PlaneFrame::findSystemStiffnessMatrixSize(void)
 //*
 //***************************************************************************
 
-short int PlaneFrame::findSystemStiffnessMatrixBandwidth(void)
+int PlaneFrame::findSystemStiffnessMatrixBandwidth(void)
 {
-    short int siBandwidth = 0;
+    int iBandwidth = 0;
 
     for (Member * memberCurr : this->members)
     {
-        short int siLow = this->ps.siNodePinned + 1;
-        short int siHigh = 0;
-        short int asiOrder[6];
-        asiOrder[0] = memberCurr->nodeNeg->siHorzFlag;
-        asiOrder[1] = memberCurr->nodeNeg->siVertFlag;
-        asiOrder[2] = memberCurr->nodeNeg->siRotFlag;
-        asiOrder[3] = memberCurr->nodePos->siHorzFlag;
-        asiOrder[4] = memberCurr->nodePos->siVertFlag;
-        asiOrder[5] = memberCurr->nodePos->siRotFlag;
-
-        for (short int count = 0; count < 6; count++)
+        int iLow = this->ps.iNodePinned + 1;
+        int iHigh = 0;
+        int aiOrder[6];
+        aiOrder[0] = memberCurr->nodeNeg->iHorzFlag;
+        aiOrder[1] = memberCurr->nodeNeg->iVertFlag;
+        aiOrder[2] = memberCurr->nodeNeg->iRotFlag;
+        aiOrder[3] = memberCurr->nodePos->iHorzFlag;
+        aiOrder[4] = memberCurr->nodePos->iVertFlag;
+        aiOrder[5] = memberCurr->nodePos->iRotFlag;
+
+        for (int count = 0; count < 6; count++)
         {
-            if (asiOrder[count]) // ...DoF index set...
+            if (aiOrder[count]) // ...DoF index set...
             {
-                if (siLow > asiOrder[count])
-                    siLow = asiOrder[count];
-                if (siHigh < asiOrder[count])
-                    siHigh = asiOrder[count];
+                if (iLow > aiOrder[count])
+                    iLow = aiOrder[count];
+                if (iHigh < aiOrder[count])
+                    iHigh = aiOrder[count];
             }
         }
 
-        short int siWidth = abs(siHigh - siLow) + 1;
-        if (siWidth > siBandwidth)
-            siBandwidth = siWidth;
+        int iWidth = abs(iHigh - iLow) + 1;
+        if (iWidth > iBandwidth)
+            iBandwidth = iWidth;
     }
 
-    return siBandwidth;
+    return iBandwidth;
 }
 //*
 //* End of PlaneFrame::findSystemStiffnessMatrixBandwidth
@@ -862,11 +1583,13 @@ short int PlaneFrame::findSystemStiffnessMatrixBandwidth(void)
 
 bool PlaneFrame::processLoads(void)
 {
+    this->clearMemberLoads();
+
     //
     // Set up the Force Matrix...
     //
 
-    double * adForceWork = new double[ this->ssm.getMatrixSize() ]();
+    double * adForceWork = new double[ this->ssm.getSystemSize() ]();
     if (adForceWork == nullptr)
     {
         std::cerr << "\n ERROR: OUT OF MEMORY!!\n"
@@ -879,28 +1602,7 @@ bool PlaneFrame::processLoads(void)
     //* Normal and GluLam/LVL/PSL Options.....
     //***********************************************
 
-    if ( ! this->isSpecialCrossSection() )
-    {
-        //
-        // Set up Stress Factor Indicator...
-        //
-
-        short int siSFIndicator = this->li.siStressFactorIndex;
-        double dFactor = 1.0; // ...default for bad stress factor index
-        if (siSFIndicator > 0)
-            dFactor = this->sf.factor[siSFIndicator - 1];
-
-        //
-        // Set up factored Stress Maximums...
-        //
-
-        for (Member * memberCurr : this->members)
-        {
-            memberCurr->ma.dForceBendWork = memberCurr->mp->dForceBend * dFactor;
-            memberCurr->ma.dForceCompWork = memberCurr->mp->dForceComp * dFactor;
-            memberCurr->ma.dForceTensWork = memberCurr->mp->dForceTens * dFactor;
-        }
-    }
+    this->setWorkingStress();
 
     //*
     //* Set up the Combined External Forces...
@@ -920,18 +1622,10 @@ bool PlaneFrame::processLoads(void)
         dCombinedExtVertWork += plCurr->adLoadVect[Y];
 
         // Get Member information...
-        Member * memberFound = nullptr;
-        for (Member * memberCurr : this->members)
-        {
-            if (memberCurr->siID == plCurr->siMemberID)
-            {
-                memberFound = memberCurr;
-                break;
-            }
-        }
+        Member * memberFound = this->tableMembers.find(plCurr->iMemberID);
         if (memberFound == nullptr)
         {
-            std::cerr << "\n ERROR: Member Number " << plCurr->siMemberID << std::endl
+            std::cerr << "\n ERROR: Member Number " << plCurr->iMemberID << std::endl
                       <<   "        not found in Concentrated Load List!\n";
             return false;
         }
@@ -947,18 +1641,10 @@ bool PlaneFrame::processLoads(void)
     for (LoadUniform * ulCurr : this->ul)
     {
         // Get Member information...
-        Member * memberFound = nullptr;
-        for (Member * memberCurr : this->members)
-        {
-            if (memberCurr->siID == ulCurr->siMemberID)
-            {
-                memberFound = memberCurr;
-                break;
-            }
-        }
+        Member * memberFound = this->tableMembers.find(ulCurr->iMemberID);
         if (memberFound == nullptr)
         {
-            std::cerr << "\n ERROR: Member Number " << ulCurr->siMemberID << std::endl
+            std::cerr << "\n ERROR: Member Number " << ulCurr->iMemberID << std::endl
                       <<   "        not found in Uniform Load List!\n";
             return false;
         }
@@ -978,18 +1664,12 @@ bool PlaneFrame::processLoads(void)
     for (LoadNodal * nlCurr : this->nl)
     {
         // Get Node information...
-        Node * nodeFound = nullptr;
-        for (Node * nodeCurr : this->nodes)
-        {
-            if ( nodeCurr->siSequence && nodeCurr->siID == nlCurr->siNodeID )
-            {
-                nodeFound = nodeCurr;
-                break;
-            }
-        }
+        Node * nodeFound = this->tableNodes.find(nlCurr->iNodeID);
+        if (nodeFound != nullptr && nodeFound->iSequence == 0) // ...unused Node
+            nodeFound = nullptr;
         if (nodeFound == nullptr)
         {
-            std::cerr << "\n ERROR: Node Number " << nlCurr->siNodeID << std::endl
+            std::cerr << "\n ERROR: Node Number " << nlCurr->iNodeID << std::endl
                       <<   "        not found in Node Load List!\n";
             return false;
         }
@@ -1002,28 +1682,28 @@ bool PlaneFrame::processLoads(void)
         {
             dCombinedExtHorzWork += nlCurr->dLoad;
             dCombinedExtRotWork  -= nlCurr->dLoad * nodeFound->adPoint[Y];
-            if (nodeFound->siHorzFlag)
-                adForceWork[nodeFound->siHorzFlag - 1] += nlCurr->dLoad;
+            if (nodeFound->iHorzFlag)
+                adForceWork[nodeFound->iHorzFlag - 1] += nlCurr->dLoad;
         }
         // Y Direction Node Load...
         else if (nlCurr->siLoadDirection == 2)
         {
             dCombinedExtVertWork += nlCurr->dLoad;
             dCombinedExtRotWork  += nlCurr->dLoad * nodeFound->adPoint[X];
-            if (nodeFound->siVertFlag)
-                adForceWork[nodeFound->siVertFlag - 1] += nlCurr->dLoad;
+            if (nodeFound->iVertFlag)
+                adForceWork[nodeFound->iVertFlag - 1] += nlCurr->dLoad;
         }
         // Moment Node Load...
         else if (nlCurr->siLoadDirection == 3)
         {
             dCombinedExtRotWork += nlCurr->dLoad;
-            if (nodeFound->siRotFlag)
-                adForceWork[nodeFound->siRotFlag - 1] += nlCurr->dLoad;
+            if (nodeFound->iRotFlag)
+                adForceWork[nodeFound->iRotFlag - 1] += nlCurr->dLoad;
         }
         // Unknown direction for Node Load...
         else
         {
-            std::cerr << "\n ERROR: Node Load Direction for Node Number " << nlCurr->siNodeID << std::endl
+            std::cerr << "\n ERROR: Node Load Direction for Node Number " << nlCurr->iNodeID << std::endl
                       <<   "        not a valid Direction!\n"
                       <<   "     Valid Types are: 1] X Direction\n"
                       <<   "                      2] Y Direction\n"
@@ -1039,18 +1719,10 @@ bool PlaneFrame::processLoads(void)
     for (LoadTrapezoidal * tlCurr : this->tl)
     {
         // Get Member information...
-        Member * memberFound = nullptr;
-        for (Member * memberCurr : this->members)
-        {
-            if (memberCurr->siID == tlCurr->siMemberID)
-            {
-                memberFound = memberCurr;
-                break;
-            }
-        }
+        Member * memberFound = this->tableMembers.find(tlCurr->iMemberID);
         if (memberFound == nullptr)
         {
-            std::cerr << "\n ERROR: Member Number " << tlCurr->siMemberID << std::endl
+            std::cerr << "\n ERROR: Member Number " << tlCurr->iMemberID << std::endl
                       <<   "        not found in Trapezoidal Load List!\n";
             return false;
         }
@@ -1094,6 +1766,9 @@ bool PlaneFrame::processLoads(void)
     this->dCombinedExtVert = dCombinedExtVertWork;
     this->dCombinedExtRot  = dCombinedExtRotWork;
 
+    // Bin the loads by Member for the Member analysis...
+    this->binMemberLoads();
+
     return true;
 }
 //*
@@ -1102,470 +1777,1316 @@ bool PlaneFrame::processLoads(void)
 
 //***************************************************************************
 //*
-//* PlaneFrame::loadMembers
-//*     This function sets the load forces for all member and collects the
-//*     global force matrix.
-//*
-//*     The LOAD TYPES are divided into two categories:
-//*
-//*         "CONCENTRATED" Systems          "DISTRIBUTED" Systems
-//*             Concentrated                    Uniform
-//*             Nodal                           Trapezoidal
+//* PlaneFrame::setWorkingStress
+//*     This function sets the Members' working Stress Maximums, factored
+//*     by the Load Case's Stress Factor, for the Normal and GluLam/LVL/PSL
+//*     Options.
 //*
 //***************************************************************************
 
-bool PlaneFrame::loadMembers(void)
+void PlaneFrame::setWorkingStress(void)
 {
-    //*****************************************
-    //* Analyze Member Information for
-    //* Stiffness and Force Vectors.....
-    //*****************************************
+    if ( this->isSpecialCrossSection() )
+        return;
+
+    //
+    // Set up Stress Factor Indicator...
+    //
+
+    short int siSFIndicator = this->li.siStressFactorIndex;
+    double dFactor = 1.0; // ...default for bad stress factor index
+    if (siSFIndicator > 0)
+        dFactor = this->sf.factor[siSFIndicator - 1];
+
+    //
+    // Set up factored Stress Maximums...
+    //
 
     for (Member * memberCurr : this->members)
     {
-        if ( ! memberCurr->loadMember(this->pl, this->ul, this->tl, this->adForceMatrix) )
-            return false;
+        memberCurr->ma.dForceBendWork = memberCurr->mp->dForceBend * dFactor;
+        memberCurr->ma.dForceCompWork = memberCurr->mp->dForceComp * dFactor;
+        memberCurr->ma.dForceTensWork = memberCurr->mp->dForceTens * dFactor;
     }
-
-    return true;
 }
 //*
-//* End of PlaneFrame::loadMembers
+//* End of PlaneFrame::setWorkingStress
 //***************************************************************************
 
 //***************************************************************************
 //*
-//* PlaneFrame::createDisplacementMatrix
-//*     This function creates and populates the System Displacement Matrix
-//*     for the structure.
+//* PlaneFrame::clearMemberLoads
+//*     This function clears the loads binned by Member.
 //*
 //***************************************************************************
 
-bool PlaneFrame::createDisplacementMatrix(void)
+void PlaneFrame::clearMemberLoads(void)
 {
-    // Set up a new Displacement Matrix...
-
-    this->adDisplaceMatrix = new double[ this->ssm.getMatrixSize() ]();
-    if (this->adDisplaceMatrix == nullptr)
-    {
-        std::cerr << "\n Error: OUT OF MEMORY!!\n"
-                  <<   "        Displacement Matrix too large!!\n";
-        return false;
-    }
-
-    // Populate the new Displacement Matrix calculating the system Displacements
-    //      via the system's Force Matrix...
-    this->ssm.calcDisplacement(this->adDisplaceMatrix, this->adForceMatrix);
-
-    return true;
+    this->vectPointStart.clear();
+    this->vectPointLoads.clear();
+    this->vectUniformStart.clear();
+    this->vectUniformLoads.clear();
+    this->vectTrapezoidalStart.clear();
+    this->vectTrapezoidalLoads.clear();
+    this->vectTrapezoidalExtras.clear();
 }
 //*
-//* End of PlaneFrame::createDisplacementMatrix
+//* End of PlaneFrame::clearMemberLoads
 //***************************************************************************
 
-void PlaneFrame::calcMemberForces(void)
+//***************************************************************************
+//*
+//* PlaneFrame::binLoads
+//*     This function bins the given loads by their Member in one pass, so
+//*     a Member's loads are found without scanning all the loads.  The bins
+//*     are compressed: the loads of the Member at position i are
+//*     vectBin[ vectStart[i] ... vectStart[i + 1] - 1 ], in load order.
+//*
+//*     NOTE: The loads' Members must have been found by processLoads().
+//*
+//***************************************************************************
+
+template <typename Load>
+void PlaneFrame::binLoads(std::vector<Load *> & vectLoads,
+                          std::vector<std::size_t> & vectStart, std::vector<Load *> & vectBin)
 {
-    for (Member * memberCurr : this->members)
+    std::size_t uiMembers = this->members.size();
+
+    // Count each Member's loads...
+    std::vector<int> vectMember( vectLoads.size() );
+    vectStart.assign(uiMembers + 1, 0);
+    for (std::size_t uiLoad = 0; uiLoad < vectLoads.size(); uiLoad++)
     {
-        // Calculate Local Member End Forces...
-        memberCurr->calcForces(this->adDisplaceMatrix);
+        vectMember[uiLoad] = this->tableMembers.find(vectLoads[uiLoad]->iMemberID)->iIndex;
+        ++vectStart[ vectMember[uiLoad] + 1 ];
     }
+    for (std::size_t uiIndex = 0; uiIndex < uiMembers; uiIndex++)
+        vectStart[uiIndex + 1] += vectStart[uiIndex];
+
+    // Store each load with its Member...
+    vectBin.resize( vectLoads.size() );
+    std::vector<std::size_t> vectNext( vectStart.begin(), vectStart.end() - 1 );
+    for (std::size_t uiLoad = 0; uiLoad < vectLoads.size(); uiLoad++)
+        vectBin[ vectNext[ vectMember[uiLoad] ]++ ] = vectLoads[uiLoad];
 }
+//*
+//* End of PlaneFrame::binLoads
+//***************************************************************************
 
 //***************************************************************************
 //*
-//* PlaneFrame::calcActions
-//*     This function calculates the end actions for the structure.
+//* PlaneFrame::binMemberLoads
+//*     This function bins the Concentrated, Uniform, and Trapezoidal loads
+//*     by Member, and compiles each Trapezoidal load's deflection constants
+//*     once for the load case.
 //*
 //***************************************************************************
 
-bool PlaneFrame::calcActions(void)
+void PlaneFrame::binMemberLoads(void)
 {
-    //
-    // Calculate Node and Member End Actions and Reactions...
-    //
-
-    for (Reaction * reactCurr : this->react)
-    {
-        reactCurr->processNodeForces();
-        reactCurr->processMemberForces();
-    }
-
-    //
-    // Calculate combined internal forces at reactions...
-    //
+    this->binLoads(this->pl, this->vectPointStart, this->vectPointLoads);
+    this->binLoads(this->ul, this->vectUniformStart, this->vectUniformLoads);
+    this->binLoads(this->tl, this->vectTrapezoidalStart, this->vectTrapezoidalLoads);
 
-    for (Reaction * reactCurr : this->react)
+    this->vectTrapezoidalExtras.resize( this->vectTrapezoidalLoads.size() );
+    for (Member * memberCurr : this->members)
     {
-        this->dCombinedIntHorz += reactCurr->dHorzReaction;
-        this->dCombinedIntVert += reactCurr->dVertReaction;
-        this->dCombinedIntRot  += reactCurr->dVertReaction * reactCurr->nodeReact->adPoint[X] -
-                                  reactCurr->dHorzReaction * reactCurr->nodeReact->adPoint[Y] +
-                                  reactCurr->dRotReaction;
+        for (std::size_t uiLoad = this->vectTrapezoidalStart[memberCurr->iIndex];
+             uiLoad < this->vectTrapezoidalStart[memberCurr->iIndex + 1]; uiLoad++)
+            this->vectTrapezoidalExtras[uiLoad].set(this->vectTrapezoidalLoads[uiLoad], memberCurr->dLength);
     }
-
-    //
-    // Calculate Total Reaction from Load forces...
-    //
-
-    this->dTotalHorz = fabs(this->dCombinedExtHorz + this->dCombinedIntHorz);
-    this->dTotalVert = fabs(this->dCombinedExtVert + this->dCombinedIntVert);
-    this->dTotalRot  = fabs(this->dCombinedExtRot  + this->dCombinedIntRot);
-
-    return true;
 }
 //*
-//* End of PlaneFrame::calcActions *
+//* End of PlaneFrame::binMemberLoads
 //***************************************************************************
 
 //***************************************************************************
 //*
-//* PlaneFrame::analyzeStructureForces
-//*     This function analyzes the structure's forces including adherence to
-//*     NDS specifications.
+//* PlaneFrame::getMemberPointLoads
+//*     These functions give the Concentrated, Uniform, and Trapezoidal
+//*     loads of the given Member, in load order, from the Member bins.
 //*
 //***************************************************************************
 
-void PlaneFrame::analyzeStructureForces(void)
+std::span<LoadPoint *> PlaneFrame::getMemberPointLoads(Member * memberCurr)
 {
-    //*
-    //* Start member Interaction and Shear Stress Analysis...
-    //***********************************************************
+    if ( this->vectPointStart.empty() )
+        return std::span<LoadPoint *>();
 
-    //
-    // Member Loop...
-    //
+    std::size_t uiFirst = this->vectPointStart[memberCurr->iIndex];
+    std::size_t uiLast = this->vectPointStart[memberCurr->iIndex + 1];
 
-    for (Member * memberCurr : this->members)
-    {
-        if ( memberCurr->ma.dForceCompWork == 0.0 && ! this->isSpecialCrossSection() )
-            continue;
+    return std::span<LoadPoint *>( this->vectPointLoads.data() + uiFirst, uiLast - uiFirst );
+}
 
-        //
-        // Set up and clear Member calculation variables...
-        //
+std::span<LoadUniform *> PlaneFrame::getMemberUniformLoads(Member * memberCurr)
+{
+    if ( this->vectUniformStart.empty() )
+        return std::span<LoadUniform *>();
 
-        bool bAxialTens = false;
-        bool bAxialComp = false;
+    std::size_t uiFirst = this->vectUniformStart[memberCurr->iIndex];
+    std::size_t uiLast = this->vectUniformStart[memberCurr->iIndex + 1];
 
-        double dMaxShear = 0.0;
-        double dCurrAxial, dCurrShear, dCurrBend;
+    return std::span<LoadUniform *>( this->vectUniformLoads.data() + uiFirst, uiLast - uiFirst );
+}
 
-        //
-        // Start Member division...
-        //
+std::span<LoadTrapezoidal *> PlaneFrame::getMemberTrapezoidalLoads(Member * memberCurr)
+{
+    if ( this->vectTrapezoidalStart.empty() )
+        return std::span<LoadTrapezoidal *>();
 
-        double dReciprocalDivision = 1.0 / (double)(this->ps.siDivisions + 1);
-        for (short int siCount = 0; siCount <= this->ps.siDivisions + 1; siCount++)
-        {
-            double dIntraLengthMember = memberCurr->dLength * ((double)siCount * dReciprocalDivision);
-            double dIntraLengthMember2 = dIntraLengthMember * dIntraLengthMember;
+    std::size_t uiFirst = this->vectTrapezoidalStart[memberCurr->iIndex];
+    std::size_t uiLast = this->vectTrapezoidalStart[memberCurr->iIndex + 1];
 
-            //
-            // Find Maximums for Axial, Shear, and Bending stresses
-            //      and Location of Maximum occurrence...
-            //
-            //      dCurrAxial      =   Axial Force    at current location (length)
-            //      dCurrShear      =   Shear Force    at current location (length)
-            //      dCurrBend       =   Bending Moment at current location (length)
-            //      dMaxAxial       =   Maximum Axial Force
-            //      dMaxShear       =   Maximum Shear Force
-            //      dMaxBend        =   Maximum Bending Moment
-            //      dMaxAxialLoc    =   Location of Maximum Axial Force
-            //      dMaxShearLoc    =   Location of Maximum Shear Force
-            //      dMaxBendLoc     =   Location of Maximum Bending Moment
-            //
+    return std::span<LoadTrapezoidal *>( this->vectTrapezoidalLoads.data() + uiFirst, uiLast - uiFirst );
+}
+
+std::span<LoadTrapezoidalExtra> PlaneFrame::getMemberTrapezoidalExtras(Member * memberCurr)
+{
+    if ( this->vectTrapezoidalStart.empty() )
+        return std::span<LoadTrapezoidalExtra>();
+
+    std::size_t uiFirst = this->vectTrapezoidalStart[memberCurr->iIndex];
+    std::size_t uiLast = this->vectTrapezoidalStart[memberCurr->iIndex + 1];
+
+    return std::span<LoadTrapezoidalExtra>( this->vectTrapezoidalExtras.data() + uiFirst, uiLast - uiFirst );
+}
+//*
+//* End of PlaneFrame::getMemberPointLoads
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::loadMembers
+//*     This function sets the load forces for all member and collects the
+//*     global force matrix.
+//*
+//*     The LOAD TYPES are divided into two categories:
+//*
+//*         "CONCENTRATED" Systems          "DISTRIBUTED" Systems
+//*             Concentrated                    Uniform
+//*             Nodal                           Trapezoidal
+//*
+//***************************************************************************
+
+bool PlaneFrame::loadMembers(void)
+{
+    //*****************************************
+    //* Analyze Member Information for
+    //* Stiffness and Force Vectors.....
+    //*****************************************
+
+    for (Member * memberCurr : this->members)
+    {
+        if ( ! memberCurr->loadMember( this->getMemberPointLoads(memberCurr),
+                                       this->getMemberUniformLoads(memberCurr),
+                                       this->getMemberTrapezoidalLoads(memberCurr),
+                                       this->adForceMatrix ) )
+            return false;
+    }
+
+    return true;
+}
+//*
+//* End of PlaneFrame::loadMembers
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::storeLoadCase
+//*     This function moves the current loads into a new read ahead Load
+//*     Case.  When the loads have been processed (the Force Matrix is
+//*     assembled), the Force Matrix is kept in the case's row of the
+//*     batch for solveLoadCases(), and the Combined External Forces and the
+//*     Members' load systems are moved into the case for restoreLoadCase().
+//*
+//***************************************************************************
+
+bool PlaneFrame::storeLoadCase(bool bWarnTPIConcLoad, bool bWarnTPITrapLoad)
+{
+    int iSystemSize = this->ssm.getSystemSize();
+
+    // Set up the batch Force Matrices for all Load Cases...
+    if (this->adForceBatch == nullptr)
+    {
+        this->adForceBatch = new double[ (long int) this->ps.siLoads * iSystemSize ]();
+        if (this->adForceBatch == nullptr)
+        {
+            std::cerr << "\n ERROR: OUT OF MEMORY!!\n"
+                      <<   "        Load Case Force Matrices too large!!\n";
+            return false;
+        }
+    }
+
+    LoadCase * lcNew = new LoadCase;
+    lcNew->li = this->li;
+    lcNew->pl.swap(this->pl);
+    lcNew->ul.swap(this->ul);
+    lcNew->nl.swap(this->nl);
+    lcNew->tl.swap(this->tl);
+    this->clearMemberLoads();
+    lcNew->bWarnTPIConcLoad = bWarnTPIConcLoad;
+    lcNew->bWarnTPITrapLoad = bWarnTPITrapLoad;
+    lcNew->bLoaded = (this->adForceMatrix != nullptr);
+
+    if (lcNew->bLoaded)
+    {
+        std::copy( this->adForceMatrix, this->adForceMatrix + iSystemSize,
+                   this->adForceBatch + (long int) this->lc.size() * iSystemSize );
+
+        // Keep the processed loading...
+        lcNew->bProcessed = true;
+        lcNew->adCombinedExt[0] = this->dCombinedExtHorz;
+        lcNew->adCombinedExt[1] = this->dCombinedExtVert;
+        lcNew->adCombinedExt[2] = this->dCombinedExtRot;
+        lcNew->conc.resize( this->members.size() );
+        lcNew->dist.resize( this->members.size() );
+        lcNew->adGlobalForce.resize( this->members.size() * 6 );
+        for (Member * memberCurr : this->members)
+        {
+            lcNew->conc[memberCurr->iIndex].swap(memberCurr->conc);
+            lcNew->dist[memberCurr->iIndex].swap(memberCurr->dist);
+            std::copy( memberCurr->adGlobalForce, memberCurr->adGlobalForce + 6,
+                       lcNew->adGlobalForce.begin() + memberCurr->iIndex * 6 );
+        }
+    }
+
+    this->lc.push_back(lcNew);
+
+    return true;
+}
+//*
+//* End of PlaneFrame::storeLoadCase
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::restoreLoadCase
+//*     This function clears the current loads and moves the given (1
+//*     based) read ahead Load Case's loads back for analysis.  A processed
+//*     case's loading is restored as processLoads() and loadMembers() left
+//*     it, so the case is not processed again.
+//*
+//***************************************************************************
+
+void PlaneFrame::restoreLoadCase(short int siLoadCase)
+{
+    this->clearLoads();
+
+    LoadCase * lcCurr = this->lc[siLoadCase - 1];
+    this->li = lcCurr->li;
+    this->pl.swap(lcCurr->pl);
+    this->ul.swap(lcCurr->ul);
+    this->nl.swap(lcCurr->nl);
+    this->tl.swap(lcCurr->tl);
+
+    if ( ! lcCurr->bProcessed )
+        return;
+
+    //
+    // Restore the processed loading...
+    //
+
+    int iSystemSize = this->ssm.getSystemSize();
+    const double * adForce = this->adForceBatch + (long int) (siLoadCase - 1) * iSystemSize;
+    this->adForceMatrix = new double[iSystemSize];
+    std::copy(adForce, adForce + iSystemSize, this->adForceMatrix);
+
+    this->dCombinedExtHorz = lcCurr->adCombinedExt[0];
+    this->dCombinedExtVert = lcCurr->adCombinedExt[1];
+    this->dCombinedExtRot  = lcCurr->adCombinedExt[2];
+
+    this->setWorkingStress();
+
+    // The Nodes were found by processLoads()...
+    for (LoadNodal * nlCurr : this->nl)
+        this->tableNodes.find(nlCurr->iNodeID)->nodeload = nlCurr;
+
+    this->binMemberLoads();
+
+    for (Member * memberCurr : this->members)
+    {
+        memberCurr->conc.swap( lcCurr->conc[memberCurr->iIndex] );
+        memberCurr->dist.swap( lcCurr->dist[memberCurr->iIndex] );
+        std::copy( lcCurr->adGlobalForce.begin() + memberCurr->iIndex * 6,
+                   lcCurr->adGlobalForce.begin() + memberCurr->iIndex * 6 + 6,
+                   memberCurr->adGlobalForce );
+    }
+}
+//*
+//* End of PlaneFrame::restoreLoadCase
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::storeLoadCombinations
+//*     This function adds a read ahead Load Case for each Load Combination
+//*     after the basic Load Cases.  Its loads are the factored loads of its
+//*     basic Load Cases, with the Nodal Loads on the same Node and direction
+//*     summed.  Its Load and Interaction are its first Load Case's.  Every
+//*     basic Load Case must be solved (see solveLoadCases).
+//*
+//***************************************************************************
+
+bool PlaneFrame::storeLoadCombinations(std::vector<LoadCombination *> & vectCombos)
+{
+    short int siCases = (short int) this->lc.size();
+
+    for (LoadCombination * comboCurr : vectCombos)
+    {
+        for (short int siCase : comboCurr->vectCase)
+        {
+            if (siCase < 1 || siCase > siCases || siCase > this->siCasesSolved)
+            {
+                std::cerr << "\n ERROR: Load Combination " << comboCurr->siNumber << std::endl
+                          <<   "        Load Case " << siCase << " not solved!\n";
+                return false;
+            }
+        }
+    }
+
+    for (LoadCombination * comboCurr : vectCombos)
+    {
+        LoadCase * lcNew = new LoadCase;
+        lcNew->combo = comboCurr;
+        lcNew->li = this->lc[ comboCurr->vectCase[0] - 1 ]->li;
+
+        for (std::size_t uiTerm = 0; uiTerm < comboCurr->vectCase.size(); uiTerm++)
+        {
+            LoadCase * lcBasic = this->lc[ comboCurr->vectCase[uiTerm] - 1 ];
+            double dFactor = comboCurr->vectFactor[uiTerm];
+
+            for (LoadPoint * plCurr : lcBasic->pl)
+            {
+                LoadPoint * plNew = new LoadPoint(*plCurr);
+                plNew->adLoadVect[X] *= dFactor;
+                plNew->adLoadVect[Y] *= dFactor;
+                lcNew->pl.push_back(plNew);
+            }
+
+            for (LoadUniform * ulCurr : lcBasic->ul)
+            {
+                LoadUniform * ulNew = new LoadUniform(*ulCurr);
+                ulNew->adLoadVect[X] *= dFactor;
+                ulNew->adLoadVect[Y] *= dFactor;
+                lcNew->ul.push_back(ulNew);
+            }
+
+            for (LoadNodal * nlCurr : lcBasic->nl)
+            {
+                // Sum with a Nodal Load on the same Node and direction...
+                LoadNodal * nlFound = nullptr;
+                for (LoadNodal * nlComb : lcNew->nl)
+                {
+                    if (nlComb->iNodeID == nlCurr->iNodeID && nlComb->siLoadDirection == nlCurr->siLoadDirection)
+                    {
+                        nlFound = nlComb;
+                        break;
+                    }
+                }
+                if (nlFound != nullptr)
+                    nlFound->dLoad += nlCurr->dLoad * dFactor;
+                else
+                {
+                    LoadNodal * nlNew = new LoadNodal(*nlCurr);
+                    nlNew->dLoad *= dFactor;
+                    lcNew->nl.push_back(nlNew);
+                }
+            }
+
+            for (LoadTrapezoidal * tlCurr : lcBasic->tl)
+            {
+                LoadTrapezoidal * tlNew = new LoadTrapezoidal(*tlCurr);
+                tlNew->adLoad[0] *= dFactor;
+                tlNew->adLoad[1] *= dFactor;
+                lcNew->tl.push_back(tlNew);
+            }
+        }
+
+        lcNew->bLoaded = true;
+        this->lc.push_back(lcNew);
+    }
+
+    return true;
+}
+//*
+//* End of PlaneFrame::storeLoadCombinations
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::solveLoadCases
+//*     This function calculates the system Displacements of every loaded
+//*     read ahead Load Case together.  The solution passes over the
+//*     System Stiffness Matrix once for the whole batch of Force Matrices.
+//*     A batch that is not solved (an iterative solution that does not
+//*     converge) fails, and no Load Case is solved.
+//*
+//***************************************************************************
+
+bool PlaneFrame::solveLoadCases(void)
+{
+    int iSystemSize = this->ssm.getSystemSize();
+
+    short int siLoaded = 0;
+    while ( siLoaded < (short int) this->lc.size() && this->lc[siLoaded]->bLoaded )
+        siLoaded++;
+    if (siLoaded == 0)
+        return true;
+
+    this->adDisplaceBatch = new double[ (long int) siLoaded * iSystemSize ]();
+    if (this->adDisplaceBatch == nullptr)
+    {
+        std::cerr << "\n Error: OUT OF MEMORY!!\n"
+                  <<   "        Load Case Displacement Matrices too large!!\n";
+        return false;
+    }
+
+    if ( ! this->ssm.calcDisplacement(this->adDisplaceBatch, this->adForceBatch, siLoaded) )
+    {
+        std::cerr << "\n ERROR: Load Case Displacements not solved!\n"
+                  <<   "        Load Cases not analyzed...\n";
+        return false;
+    }
+    this->siCasesSolved = siLoaded;
+
+    return true;
+}
+//*
+//* End of PlaneFrame::solveLoadCases
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::createDisplacementMatrix
+//*     This function sets up the Displacement Matrix of the given (1 based)
+//*     Load Case from its batch solution.  A Load Combination's is the
+//*     factored sum of its basic Load Cases' solutions.
+//*
+//***************************************************************************
+
+bool PlaneFrame::createDisplacementMatrix(short int siLoadCase)
+{
+    // Set up a new Displacement Matrix...
+
+    int iSystemSize = this->ssm.getSystemSize();
+    this->adDisplaceMatrix = new double[iSystemSize]();
+    if (this->adDisplaceMatrix == nullptr)
+    {
+        std::cerr << "\n Error: OUT OF MEMORY!!\n"
+                  <<   "        Displacement Matrix too large!!\n";
+        return false;
+    }
+
+    // Populate the new Displacement Matrix from the system Displacements
+    //      calculated via the system's Force Matrix...
+    LoadCombination * comboCurr = this->lc[siLoadCase - 1]->combo;
+    if (comboCurr == nullptr)
+    {
+        const double * adDisplace = this->adDisplaceBatch + (long int) (siLoadCase - 1) * iSystemSize;
+        std::copy(adDisplace, adDisplace + iSystemSize, this->adDisplaceMatrix);
+        return true;
+    }
+
+    // ...or superpose a Load Combination's from its basic Load Cases...
+    for (std::size_t uiTerm = 0; uiTerm < comboCurr->vectCase.size(); uiTerm++)
+    {
+        const double * adDisplace = this->adDisplaceBatch + (long int) (comboCurr->vectCase[uiTerm] - 1) * iSystemSize;
+        double dFactor = comboCurr->vectFactor[uiTerm];
+        for (int iIndex = 0; iIndex < iSystemSize; iIndex++)
+            this->adDisplaceMatrix[iIndex] += dFactor * adDisplace[iIndex];
+    }
+
+    return true;
+}
+//*
+//* End of PlaneFrame::createDisplacementMatrix
+//***************************************************************************
+
+void PlaneFrame::calcMemberForces(void)
+{
+    for (Member * memberCurr : this->members)
+    {
+        // Calculate Local Member End Forces...
+        memberCurr->calcForces(this->adDisplaceMatrix);
+    }
+}
+
+//***************************************************************************
+//*
+//* PlaneFrame::calcActions
+//*     This function calculates the end actions for the structure.
+//*
+//***************************************************************************
+
+bool PlaneFrame::calcActions(void)
+{
+    //
+    // Calculate Node and Member End Actions and Reactions...
+    //
+
+    for (Reaction * reactCurr : this->react)
+    {
+        reactCurr->processNodeForces();
+        reactCurr->processMemberForces();
+    }
+
+    //
+    // Calculate combined internal forces at reactions...
+    //
+
+    for (Reaction * reactCurr : this->react)
+    {
+        this->dCombinedIntHorz += reactCurr->dHorzReaction;
+        this->dCombinedIntVert += reactCurr->dVertReaction;
+        this->dCombinedIntRot  += reactCurr->dVertReaction * reactCurr->nodeReact->adPoint[X] -
+                                  reactCurr->dHorzReaction * reactCurr->nodeReact->adPoint[Y] +
+                                  reactCurr->dRotReaction;
+    }
+
+    //
+    // Calculate Total Reaction from Load forces...
+    //
+
+    this->dTotalHorz = fabs(this->dCombinedExtHorz + this->dCombinedIntHorz);
+    this->dTotalVert = fabs(this->dCombinedExtVert + this->dCombinedIntVert);
+    this->dTotalRot  = fabs(this->dCombinedExtRot  + this->dCombinedIntRot);
+
+    return true;
+}
+//*
+//* End of PlaneFrame::calcActions *
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::findMemberThreads
+//*     This function finds the threads for a Member analysis: the thread
+//*     count, limited to at least iThreadMembers Members per thread.
+//*
+//***************************************************************************
+
+short int PlaneFrame::findMemberThreads(void)
+{
+    std::size_t uiMembers = this->members.size();
+    short int siThreadCount = this->ssm.getThreads();
+    if ( (std::size_t) siThreadCount > uiMembers / PlaneFrame::iThreadMembers )
+        siThreadCount = (short int) ( uiMembers / PlaneFrame::iThreadMembers );
+    if (siThreadCount < 1)
+        siThreadCount = 1;
+
+    return siThreadCount;
+}
+//*
+//* End of PlaneFrame::findMemberThreads
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::runMemberThreads
+//*     This function deals the Members in blocks to the given number of
+//*     threads.  The work is called with the thread and its block of
+//*     Members (first, last + 1) and this thread takes the first block.
+//*
+//***************************************************************************
+
+template <typename Work>
+void PlaneFrame::runMemberThreads(short int siThreadCount, Work & work)
+{
+    std::size_t uiMembers = this->members.size();
+    auto runBlock =
+        [&work, uiMembers, siThreadCount](short int siThread)
+        {
+            work( siThread,
+                  uiMembers * siThread / siThreadCount,
+                  uiMembers * (siThread + 1) / siThreadCount );
+        };
+
+    std::vector<std::thread> vectThreads;
+    for (short int siThread = 1; siThread < siThreadCount; siThread++)
+        vectThreads.emplace_back(runBlock, siThread);
+    runBlock(0);
+    for (std::thread & threadCurr : vectThreads)
+        threadCurr.join();
+}
+//*
+//* End of PlaneFrame::runMemberThreads
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::analyzeStructureForces
+//*     This function analyzes the structure's forces including adherence to
+//*     NDS specifications.
+//*
+//*     Each Member's analysis is independent, so the Members are dealt in
+//*     blocks to the threads.  Each thread notes into its own Member Note
+//*     Flags, which are merged in thread order afterwards, so the results
+//*     are identical for any thread count.
+//*
+//***************************************************************************
+
+void PlaneFrame::analyzeStructureForces(void)
+{
+    //*
+    //* Start member Interaction and Shear Stress Analysis...
+    //***********************************************************
+
+    //
+    // Member Loop...
+    //
+
+    short int siThreadCount = this->findMemberThreads();
+    std::vector<MemberNotes> vectNotes(siThreadCount);
+    auto analyzeMembers =
+        [this, &vectNotes](short int siThread, std::size_t uiFirst, std::size_t uiLast)
+        {
+            DivisionStations ds;
+            DivisionSegments dsegs;
+            for (std::size_t uiMember = uiFirst; uiMember < uiLast; uiMember++)
+                this->analyzeMemberForces(this->members[uiMember], ds, dsegs, vectNotes[siThread]);
+        };
+    this->runMemberThreads(siThreadCount, analyzeMembers);
+
+    //
+    // Merge the Member Note Flags...
+    //
+
+    for (MemberNotes & notesCurr : vectNotes)
+    {
+        this->bNoteCompression50    = this->bNoteCompression50    || notesCurr.bCompression50;
+        this->bNoteCompression75    = this->bNoteCompression75    || notesCurr.bCompression75;
+        this->bNoteTension          = this->bNoteTension          || notesCurr.bTension;
+        this->bNoteStressDifference = this->bNoteStressDifference || notesCurr.bStressDifference;
+        this->bNoteBuckle           = this->bNoteBuckle           || notesCurr.bBuckle;
+        this->bNoteEuler            = this->bNoteEuler            || notesCurr.bEuler;
+        this->bNoteTPI              = this->bNoteTPI              || notesCurr.bTPI;
+        this->siPerpendicular      += notesCurr.siPerpendicular;
+    }
+}
+//*
+//* End of PlaneFrame::analyzeStructureForces
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::findMemberStations
+//*     This function finds a Member's Axial, Shear and Bending forces at its
+//*     divisions in the given Division Stations.  For the Exact option, the
+//*     divisions are the critical points of the Member's segments between
+//*     its load points.
+//*
+//***************************************************************************
+
+void PlaneFrame::findMemberStations(Member * memberCurr, DivisionStations & ds, DivisionSegments & dsegs)
+{
+    if (this->cExtremeOption == PlaneFrame::cExtremeExact)
+    {
+        dsegs.set(memberCurr->dLength);
+
+        for (LoadTrapezoidal * tlCurr : this->getMemberTrapezoidalLoads(memberCurr))
+        {
+            if (tlCurr->adDist[0] != 0.0 || tlCurr->adDist[1] != 0.0)
+                dsegs.trapezoidal(tlCurr->adDist[0], tlCurr->adDist[1], tlCurr->adStart, tlCurr->adEnd);
+        }
+        for (DistributedSystem * distCurr : memberCurr->dist)
+            dsegs.distributed(distCurr->adLoadvect);
+        for (ConcentratedSystem * concCurr : memberCurr->conc)
+        {
+            if (concCurr->adLoadVect[X] != 0.0 || concCurr->adLoadVect[Y] != 0.0)
+                dsegs.concentrated(concCurr->dLoadDist, concCurr->adLoadVect);
+        }
+
+        dsegs.end(ds, memberCurr->adLocalForce);
+    }
+    else
+    {
+        ds.set(memberCurr->dLength, this->ps.siDivisions);
+
+        // Add Trapezoidal Load contributions...
+        for (LoadTrapezoidal * tlCurr : this->getMemberTrapezoidalLoads(memberCurr))
+        {
+            if (tlCurr->adDist[0] != 0.0 || tlCurr->adDist[1] != 0.0)
+                DivisionKernel::trapezoidal(ds, tlCurr->adDist[0], tlCurr->adDist[1], tlCurr->adStart, tlCurr->adEnd);
+        }
 
-            dCurrAxial = -memberCurr->adLocalForce[0];
-            dCurrShear =  memberCurr->adLocalForce[1];
-            dCurrBend  =  memberCurr->adLocalForce[1] * dIntraLengthMember - memberCurr->adLocalForce[2];
+        // Start with the End Forces...
+        DivisionKernel::end(ds, memberCurr->adLocalForce);
 
-            //
-            // Add Trapezoidal Load contributions...
-            //
+        // Add Distributed Load contributions...
+        for (DistributedSystem * distCurr : memberCurr->dist)
+            DivisionKernel::distributed(ds, distCurr->adLoadvect);
 
-            double dForceAxialTemp = 0.0;
-            double dForceShearTemp = 0.0;
-            double dForceBendTemp  = 0.0;
-            for (LoadTrapezoidal * tlCurr : this->tl)
-            {
-                if (tlCurr->siMemberID == memberCurr->siID)
-                {
-                    if (dIntraLengthMember > tlCurr->adDist[0] && (tlCurr->adDist[0] != 0.0 || tlCurr->adDist[1] != 0.0))
-                    {
-                        double dLengthTrap = tlCurr->adDist[1] - tlCurr->adDist[0];
-                        //double dLengthTrap2 = dLengthTrap * dLengthTrap;
-                        double dDeltaX = tlCurr->adEnd[X] - tlCurr->adStart[X];
-                        double dDeltaY = tlCurr->adEnd[Y] - tlCurr->adStart[Y];
-
-                        double dIntraLengthTrap  = dIntraLengthMember - tlCurr->adDist[0];
-                        double dIntraLengthTrap2 = dIntraLengthTrap * dIntraLengthTrap;
-                        double dIntraLengthTrap3 = dIntraLengthTrap * dIntraLengthTrap2;
-                        if (dIntraLengthMember < tlCurr->adDist[1])
-                        {
-                            dForceAxialTemp -= (tlCurr->adStart[X] * dDeltaX * dIntraLengthTrap3 / (dLengthTrap * 2.0));
-                            dForceShearTemp += (tlCurr->adStart[Y] * dDeltaY * dIntraLengthTrap3 / (dLengthTrap * 2.0));
-                            dForceBendTemp  += (dIntraLengthTrap2 * (tlCurr->adStart[Y] +
-                                                        dDeltaY * dIntraLengthTrap / (dLengthTrap * 3.0)) / 2.0);
-                        }
-                        else
-                        {
-                            dForceAxialTemp -= (dLengthTrap * (tlCurr->adStart[X] + dDeltaX / 2.0));
-                            dForceShearTemp += (dLengthTrap * (tlCurr->adStart[Y] + dDeltaY / 2.0));
-                            dForceBendTemp  += (dLengthTrap * (tlCurr->adStart[Y]  * (dIntraLengthTrap - dLengthTrap / 2.0) +
-                                                  dDeltaY / 2.0 * (dIntraLengthTrap - dLengthTrap * 2.0 / 3.0)));
-                        }
-                    }
-                }
-            }
+        // Add Concentrated Load contributions...
+        for (ConcentratedSystem * concCurr : memberCurr->conc)
+        {
+            if (concCurr->adLoadVect[X] != 0.0 || concCurr->adLoadVect[Y] != 0.0)
+                DivisionKernel::concentrated(ds, concCurr->dLoadDist, concCurr->adLoadVect);
+        }
+    }
+}
+//*
+//* End of PlaneFrame::findMemberStations
+//***************************************************************************
 
-            dCurrAxial += dForceAxialTemp;
-            dCurrShear += dForceShearTemp;
-            dCurrBend  += dForceBendTemp;
+//***************************************************************************
+//*
+//* PlaneFrame::analyzeMemberForces
+//*     This function analyzes a Member's forces including adherence to
+//*     NDS specifications.  The given Division Stations and Segments are
+//*     the caller's work space, and the Member's notes are set in the given
+//*     Member Note Flags.
+//*
+//***************************************************************************
 
-            //
-            // Add Distributed Load contributions...
-            //
+void PlaneFrame::analyzeMemberForces(Member * memberCurr, DivisionStations & ds, DivisionSegments & dsegs,
+                                     MemberNotes & notes)
+{
+    if ( memberCurr->ma.dForceCompWork == 0.0 && ! this->isSpecialCrossSection() )
+        return;
 
-            for (DistributedSystem * distCurr : memberCurr->dist)
-            {
-                dCurrAxial -= distCurr->adLoadvect[X] * dIntraLengthMember;
-                dCurrShear += distCurr->adLoadvect[Y] * dIntraLengthMember;
-                dCurrBend  += distCurr->adLoadvect[Y] / 2.0 * dIntraLengthMember2;
-            }
+    //
+    // Set up and clear Member calculation variables...
+    //
 
-            //
-            // Add Concentrated Load contributions...
-            //
+    bool bAxialTens = false;
+    bool bAxialComp = false;
 
-            for (ConcentratedSystem * concCurr : memberCurr->conc)
-            {
-                if (concCurr->adLoadVect[X] != 0.0 || concCurr->adLoadVect[Y] != 0.0)
-                {
-                    if (dIntraLengthMember > concCurr->dLoadDist)
-                    {
-                        dCurrAxial -= concCurr->adLoadVect[X];
-                        dCurrShear += concCurr->adLoadVect[Y];
-                        dCurrBend  += concCurr->adLoadVect[Y] * (dIntraLengthMember - concCurr->dLoadDist);
-                    }
-                }
-            }
+    double dMaxShear = 0.0;
+    double dCurrAxial, dCurrShear, dCurrBend;
+
+    //
+    // Find Axial, Shear, and Bending forces at all Member divisions...
+    //
+    //      adAxial         =   Axial Force    at each division (length)
+    //      adShear         =   Shear Force    at each division (length)
+    //      adBend          =   Bending Moment at each division (length)
+    //
 
-            if (dCurrAxial > 1.0)
-                bAxialTens = true;
-            else if (dCurrAxial < (-1.0))
-                bAxialComp = true;
+    this->findMemberStations(memberCurr, ds, dsegs);
 
-            //
-            // Find the last greatest Axial and Bending force and
-            //      location depending on the Interaction Index...
-            //
+    //
+    // Search the Member divisions...
+    //
+
+    for (int iStation = 0; iStation < ds.iCount; iStation++)
+    {
+        double dIntraLengthMember = ds.adLength[iStation];
+
+        //
+        // Find Maximums for Axial, Shear, and Bending stresses
+        //      and Location of Maximum occurrence...
+        //
+        //      dCurrAxial      =   Axial Force    at current location (length)
+        //      dCurrShear      =   Shear Force    at current location (length)
+        //      dCurrBend       =   Bending Moment at current location (length)
+        //      dMaxAxial       =   Maximum Axial Force
+        //      dMaxShear       =   Maximum Shear Force
+        //      dMaxBend        =   Maximum Bending Moment
+        //      dMaxAxialLoc    =   Location of Maximum Axial Force
+        //      dMaxShearLoc    =   Location of Maximum Shear Force
+        //      dMaxBendLoc     =   Location of Maximum Bending Moment
+        //
+
+        dCurrAxial = ds.adAxial[iStation];
+        dCurrShear = ds.adShear[iStation];
+        dCurrBend  = ds.adBend[iStation];
+
+        if (dCurrAxial > 1.0)
+            bAxialTens = true;
+        else if (dCurrAxial < (-1.0))
+            bAxialComp = true;
+
+        //
+        // Find the last greatest Axial and Bending force and
+        //      location depending on the Interaction Index...
+        //
 
-            if ( this->li.calcAtBendAndAxialMax() )
+        if ( this->li.calcAtBendAndAxialMax() )
+        {
+            if (fabs(dCurrAxial) >= fabs(memberCurr->ma.dMaxAxial))
             {
-                if (fabs(dCurrAxial) >= fabs(memberCurr->ma.dMaxAxial))
-                {
-                    memberCurr->ma.dMaxAxial = dCurrAxial;
-                    memberCurr->ma.dMaxAxialLoc = dIntraLengthMember;
-                }
-                if (fabs(dCurrBend) >= fabs(memberCurr->ma.dMaxBend))
-                {
-                    memberCurr->ma.dMaxBend = dCurrBend;
-                    memberCurr->ma.dMaxBendLoc = dIntraLengthMember;
-                }
+                memberCurr->ma.dMaxAxial = dCurrAxial;
+                memberCurr->ma.dMaxAxialLoc = dIntraLengthMember;
             }
-            else if ( this->li.calcAtAxialMax() )
+            if (fabs(dCurrBend) >= fabs(memberCurr->ma.dMaxBend))
             {
-                if ((fabs(dCurrAxial) >= fabs(memberCurr->ma.dMaxAxial)) ||
-                    (fabs(dCurrAxial) == fabs(memberCurr->ma.dMaxAxial) && fabs(dCurrBend) >= fabs(memberCurr->ma.dMaxBend)))
-                {
-                    memberCurr->ma.dMaxAxial = dCurrAxial;
-                    memberCurr->ma.dMaxBend  = dCurrBend;
-                    memberCurr->ma.dMaxAxialLoc = dIntraLengthMember;
-                    memberCurr->ma.dMaxBendLoc  = dIntraLengthMember;
-                }
+                memberCurr->ma.dMaxBend = dCurrBend;
+                memberCurr->ma.dMaxBendLoc = dIntraLengthMember;
+            }
+        }
+        else if ( this->li.calcAtAxialMax() )
+        {
+            if ((fabs(dCurrAxial) >= fabs(memberCurr->ma.dMaxAxial)) ||
+                (fabs(dCurrAxial) == fabs(memberCurr->ma.dMaxAxial) && fabs(dCurrBend) >= fabs(memberCurr->ma.dMaxBend)))
+            {
+                memberCurr->ma.dMaxAxial = dCurrAxial;
+                memberCurr->ma.dMaxBend  = dCurrBend;
+                memberCurr->ma.dMaxAxialLoc = dIntraLengthMember;
+                memberCurr->ma.dMaxBendLoc  = dIntraLengthMember;
             }
-            else // this->li.calcAtBendMax() || this->li.calcUsingTPI()
+        }
+        else // this->li.calcAtBendMax() || this->li.calcUsingTPI()
+        {
+            if ((fabs(dCurrBend) >= fabs(memberCurr->ma.dMaxBend)) ||
+                (fabs(dCurrBend) == fabs(memberCurr->ma.dMaxBend) && fabs(dCurrAxial) >= fabs(memberCurr->ma.dMaxAxial)))
             {
-                if ((fabs(dCurrBend) >= fabs(memberCurr->ma.dMaxBend)) ||
-                    (fabs(dCurrBend) == fabs(memberCurr->ma.dMaxBend) && fabs(dCurrAxial) >= fabs(memberCurr->ma.dMaxAxial)))
-                {
-                    memberCurr->ma.dMaxAxial = dCurrAxial;
-                    memberCurr->ma.dMaxBend  = dCurrBend;
-                    memberCurr->ma.dMaxAxialLoc = dIntraLengthMember;
-                    memberCurr->ma.dMaxBendLoc  = dIntraLengthMember;
-                }
+                memberCurr->ma.dMaxAxial = dCurrAxial;
+                memberCurr->ma.dMaxBend  = dCurrBend;
+                memberCurr->ma.dMaxAxialLoc = dIntraLengthMember;
+                memberCurr->ma.dMaxBendLoc  = dIntraLengthMember;
             }
+        }
 
-            //
-            // Find the last greatest Shear force and location...
-            //
+        //
+        // Find the last greatest Shear force and location...
+        //
 
-            if (fabs(dCurrShear) >= fabs(dMaxShear))
-            {
-                dMaxShear = dCurrShear;
-                memberCurr->ma.dMaxShearLoc = dIntraLengthMember;
-            }
+        if (fabs(dCurrShear) >= fabs(dMaxShear))
+        {
+            dMaxShear = dCurrShear;
+            memberCurr->ma.dMaxShearLoc = dIntraLengthMember;
         }
 
         //
-        // Check for mixed tension and compression...
+        // Find the force extremes for the Load Case envelope...
         //
 
-        double dEndActionTPI = 0.0;
-        double dBendLocTPI = 0.0;
-        if ( ! this->isSpecialCrossSection() )
+        if (fabs(dCurrBend) > fabs(memberCurr->ma.dExtremeBend))
+            memberCurr->ma.dExtremeBend = dCurrBend;
+        if (fabs(dCurrShear) > fabs(memberCurr->ma.dExtremeShear))
+            memberCurr->ma.dExtremeShear = dCurrShear;
+        if (iStation == 0 || dCurrAxial > memberCurr->ma.dExtremeAxialMax)
+            memberCurr->ma.dExtremeAxialMax = dCurrAxial;
+        if (iStation == 0 || dCurrAxial < memberCurr->ma.dExtremeAxialMin)
+            memberCurr->ma.dExtremeAxialMin = dCurrAxial;
+    }
+
+    //
+    // Check for mixed tension and compression...
+    //
+
+    double dEndActionTPI = 0.0;
+    double dBendLocTPI = 0.0;
+    if ( ! this->isSpecialCrossSection() )
+    {
+        memberCurr->ma.bMixedForces = (bAxialTens && bAxialComp);
+        if ( ! memberCurr->ma.bMixedForces )
         {
-            memberCurr->ma.bMixedForces = (bAxialTens && bAxialComp);
-            if ( ! memberCurr->ma.bMixedForces )
-            {
-                //
-                // Get Allowable Bending Force...
-                //
-                if ( this->li.isNDS1986() )
-                    memberCurr->calcBending1986();
-                else if ( this->li.isNDS1991() )
-                    memberCurr->calcBending1991();
+            //
+            // Get Allowable Bending Force...
+            //
+            if ( this->li.isNDS1986() )
+                memberCurr->calcBending1986();
+            else if ( this->li.isNDS1991() )
+                memberCurr->calcBending1991();
+
+            //
+            // Check Slenderness Ratio > 50 (CS or RB > 50)...
+            //
 
+            if (memberCurr->ma.siSlenderRatioType == 0)
+            {
                 //
-                // Check Slenderness Ratio > 50 (CS or RB > 50)...
+                // TPI Option: Find Panel Point Interaction values for Compression members...
                 //
 
-                if (memberCurr->ma.siSlenderRatioType == 0)
+                if (this->li.calcUsingTPI() && bAxialTens == 0)
                 {
+                    double dForceBendAreaHeight = memberCurr->mp->dThick *
+                                                  (memberCurr->mp->dHeight * memberCurr->mp->dHeight) *
+                                                  memberCurr->ma.dForceBendPrime;
+                    double dCommonActionNeg = fabs(memberCurr->adLocalForce[2]) * 6.0 / dForceBendAreaHeight;
+                    double dCommonActionPos = fabs(memberCurr->adLocalForce[5]) * 6.0 / dForceBendAreaHeight;
+                    double dForceCompArea = memberCurr->ma.dForceCompWork * memberCurr->mp->dThick * memberCurr->mp->dHeight;
+                    double dEndActionNeg = 0.0;
+                    double dEndActionPos = 0.0;
+
                     //
-                    // TPI Option: Find Panel Point Interaction values for Compression members...
+                    // 1986 Beam Column Equation applied at panel points.
                     //
-
-                    if (this->li.calcUsingTPI() && bAxialTens == 0)
+                    if ( this->li.isNDS1986() )
                     {
-                        double dForceBendAreaHeight = memberCurr->mp->dThick *
-                                                      (memberCurr->mp->dHeight * memberCurr->mp->dHeight) *
-                                                      memberCurr->ma.dForceBendPrime;
-                        double dCommonActionNeg = fabs(memberCurr->adLocalForce[2]) * 6.0 / dForceBendAreaHeight;
-                        double dCommonActionPos = fabs(memberCurr->adLocalForce[5]) * 6.0 / dForceBendAreaHeight;
-                        double dForceCompArea = memberCurr->ma.dForceCompWork * memberCurr->mp->dThick * memberCurr->mp->dHeight;
-                        double dEndActionNeg = 0.0;
-                        double dEndActionPos = 0.0;
-
-                        //
-                        // 1986 Beam Column Equation applied at panel points.
-                        //
-                        if ( this->li.isNDS1986() )
-                        {
-                            dEndActionNeg = dCommonActionNeg + fabs(memberCurr->adLocalForce[0]) / dForceCompArea;
-                            dEndActionPos = dCommonActionPos + fabs(memberCurr->adLocalForce[3]) / dForceCompArea;
-                        }
+                        dEndActionNeg = dCommonActionNeg + fabs(memberCurr->adLocalForce[0]) / dForceCompArea;
+                        dEndActionPos = dCommonActionPos + fabs(memberCurr->adLocalForce[3]) / dForceCompArea;
+                    }
 
-                        //
-                        // 1991 Beam Column Equation applied at panel points.
-                        //
-                        else if ( this->li.isNDS1991() )
-                        {
-                            dEndActionNeg = dCommonActionNeg + pow((memberCurr->adLocalForce[0] / dForceCompArea), 2.0);
-                            dEndActionPos = dCommonActionPos + pow((memberCurr->adLocalForce[3] / dForceCompArea), 2.0);
-                        }
+                    //
+                    // 1991 Beam Column Equation applied at panel points.
+                    //
+                    else if ( this->li.isNDS1991() )
+                    {
+                        dEndActionNeg = dCommonActionNeg + pow((memberCurr->adLocalForce[0] / dForceCompArea), 2.0);
+                        dEndActionPos = dCommonActionPos + pow((memberCurr->adLocalForce[3] / dForceCompArea), 2.0);
+                    }
 
-                        // Set to end with largest force...
-                        dEndActionTPI = dEndActionNeg;
-                        dBendLocTPI = 0.0; // Neg End
-                        if (dEndActionPos > dEndActionNeg)
-                        {
-                            dEndActionTPI = dEndActionPos;
-                            dBendLocTPI = memberCurr->dLength; // Pos End
-                        }
+                    // Set to end with largest force...
+                    dEndActionTPI = dEndActionNeg;
+                    dBendLocTPI = 0.0; // Neg End
+                    if (dEndActionPos > dEndActionNeg)
+                    {
+                        dEndActionTPI = dEndActionPos;
+                        dBendLocTPI = memberCurr->dLength; // Pos End
+                    }
 
-                        // Default Bending Location to mid-panel...
-                        memberCurr->ma.dMaxBendLoc = memberCurr->dLength / 2.0;
+                    // Default Bending Location to mid-panel...
+                    memberCurr->ma.dMaxBendLoc = memberCurr->dLength / 2.0;
 
-                        // If present, set Bending, Axial, and Location adjustments for the distributed load...
-                        double dDistBendForce = 0.0;
-                        double dDistAxialForce = 0.0;
-                        for (DistributedSystem * distCurr : memberCurr->dist)
-                        {
-                            if (distCurr->adLoadvect[Y] != 0.0)
-                            {
-                                dDistBendForce  += distCurr->adLoadvect[Y];
-                                dDistAxialForce += distCurr->adLoadvect[X];
-                            }
-                        }
-                        if (dDistBendForce != 0.0)
+                    // If present, set Bending, Axial, and Location adjustments for the distributed load...
+                    double dDistBendForce = 0.0;
+                    double dDistAxialForce = 0.0;
+                    for (DistributedSystem * distCurr : memberCurr->dist)
+                    {
+                        if (distCurr->adLoadvect[Y] != 0.0)
                         {
-                            double dDistForceLocation = (-memberCurr->adLocalForce[1]) / dDistBendForce;
-                            if (dDistForceLocation >= 0.0 && dDistForceLocation <= memberCurr->dLength)
-                                memberCurr->ma.dMaxBendLoc = dDistForceLocation;
+                            dDistBendForce  += distCurr->adLoadvect[Y];
+                            dDistAxialForce += distCurr->adLoadvect[X];
                         }
+                    }
+                    if (dDistBendForce != 0.0)
+                    {
+                        double dDistForceLocation = (-memberCurr->adLocalForce[1]) / dDistBendForce;
+                        if (dDistForceLocation >= 0.0 && dDistForceLocation <= memberCurr->dLength)
+                            memberCurr->ma.dMaxBendLoc = dDistForceLocation;
+                    }
 
-                        // Set Bending Force...
-                        memberCurr->ma.dMaxBend =
-                                memberCurr->adLocalForce[1] * memberCurr->ma.dMaxBendLoc +
-                                dDistBendForce  / 2.0 * memberCurr->ma.dMaxBendLoc * memberCurr->ma.dMaxBendLoc -
-                                memberCurr->adLocalForce[2];
+                    // Set Bending Force...
+                    memberCurr->ma.dMaxBend =
+                            memberCurr->adLocalForce[1] * memberCurr->ma.dMaxBendLoc +
+                            dDistBendForce  / 2.0 * memberCurr->ma.dMaxBendLoc * memberCurr->ma.dMaxBendLoc -
+                            memberCurr->adLocalForce[2];
 
-                        // Set Axial Location and Force...
-                        memberCurr->ma.dMaxAxialLoc = memberCurr->ma.dMaxBendLoc;
-                        memberCurr->ma.dMaxAxial = (-memberCurr->adLocalForce[0]) -
-                                                   dDistAxialForce * memberCurr->ma.dMaxAxialLoc;
-                    }
+                    // Set Axial Location and Force...
+                    memberCurr->ma.dMaxAxialLoc = memberCurr->ma.dMaxBendLoc;
+                    memberCurr->ma.dMaxAxial = (-memberCurr->adLocalForce[0]) -
+                                               dDistAxialForce * memberCurr->ma.dMaxAxialLoc;
                 }
             }
         }
+    }
 
-        if ( ! memberCurr->ma.bMixedForces && memberCurr->ma.siSlenderRatioType == 0 )
-        {
-            memberCurr->ma.dAxial = memberCurr->ma.dMaxAxial / memberCurr->mp->dArea;
-            memberCurr->ma.dMaxShear = dMaxShear / memberCurr->mp->dArea * this->getShearFactor();
-            memberCurr->ma.dBend = memberCurr->ma.dMaxBend / memberCurr->mp->dSectionModulus;
+    if ( ! memberCurr->ma.bMixedForces && memberCurr->ma.siSlenderRatioType == 0 )
+    {
+        memberCurr->ma.dAxial = memberCurr->ma.dMaxAxial / memberCurr->mp->dArea;
+        memberCurr->ma.dMaxShear = dMaxShear / memberCurr->mp->dArea * this->getShearFactor();
+        memberCurr->ma.dBend = memberCurr->ma.dMaxBend / memberCurr->mp->dSectionModulus;
 
-            if ( ! this->isSpecialCrossSection() )
+        if ( ! this->isSpecialCrossSection() )
+        {
+            if (memberCurr->ma.dMaxAxial > 0.0)
             {
-                if (memberCurr->ma.dMaxAxial > 0.0)
-                {
-                    memberCurr->calcTension(this->bNoteStressDifference, this->bNoteTension);
-                    memberCurr->ma.dForceCompPrime = memberCurr->ma.dForceTensWork;
-                }
-                else
-                {
-                    if ( this->li.isNDS1986() )
-                        memberCurr->calcCompression1986(this->ssm.getDiagonal(),
-                                                        this->li.calcUsingTPI(), dEndActionTPI, dBendLocTPI,
-                                                        this->bNoteBuckle, this->siPerpendicular, this->bNoteTPI,
-                                                        this->bNoteCompression50);
+                memberCurr->calcTension(notes.bStressDifference, notes.bTension);
+                memberCurr->ma.dForceCompPrime = memberCurr->ma.dForceTensWork;
+            }
+            else
+            {
+                if ( this->li.isNDS1986() )
+                    memberCurr->calcCompression1986(this->ssm.getDiagonal(),
+                                                    this->li.calcUsingTPI(), dEndActionTPI, dBendLocTPI,
+                                                    notes.bBuckle, notes.siPerpendicular, notes.bTPI,
+                                                    notes.bCompression50);
 
-                    else if ( this->li.isNDS1991() )
-                        memberCurr->calcCompression1991(this->ssm.getDiagonal(),
-                                                        this->li.calcUsingTPI(), dEndActionTPI, dBendLocTPI,
-                                                        this->bNoteBuckle, this->siPerpendicular, this->bNoteTPI,
-                                                        this->bNoteCompression75, this->bNoteCompression50,
-                                                        this->bNoteEuler);
-                }
+                else if ( this->li.isNDS1991() )
+                    memberCurr->calcCompression1991(this->ssm.getDiagonal(),
+                                                    this->li.calcUsingTPI(), dEndActionTPI, dBendLocTPI,
+                                                    notes.bBuckle, notes.siPerpendicular, notes.bTPI,
+                                                    notes.bCompression75, notes.bCompression50,
+                                                    notes.bEuler);
             }
         }
     }
 }
 //*
-//* End of PlaneFrame::analyzeStructureForces
+//* End of PlaneFrame::analyzeMemberForces
 //***************************************************************************
 
 //***************************************************************************
 //*
 //* PlaneFrame::calcDeflections
 //*     This function calculates the displacements for the structure.
+//*     Each Member's deflection is independent, so the Members are dealt
+//*     in blocks to the threads.
 //*
 //***************************************************************************
 
 bool PlaneFrame::calcDeflections()
+{
+    short int siThreadCount = this->findMemberThreads();
+    std::vector<char> vectCalculated(siThreadCount, true);
+    auto calcMembers =
+        [this, &vectCalculated](short int siThread, std::size_t uiFirst, std::size_t uiLast)
+        {
+            for (std::size_t uiMember = uiFirst; uiMember < uiLast; uiMember++)
+            {
+                Member * memberCurr = this->members[uiMember];
+
+                // Member Deflection Calculation...
+                if ( ! memberCurr->calcDeflection( this->isSpecialCrossSection(),
+                                                   this->adDisplaceMatrix,
+                                                   this->getMemberTrapezoidalExtras(memberCurr),
+                                                   this->ps.siDivisions ) )
+                    vectCalculated[siThread] = false;
+            }
+        };
+    this->runMemberThreads(siThreadCount, calcMembers);
+
+    for (char cCalculated : vectCalculated)
+    {
+        if ( ! cCalculated )
+            return false;
+    }
+    return true;
+}
+//*
+//* End of PlaneFrame::calcDeflections
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::envelopeLoadCase
+//*     This function updates each Member's load case envelope with the
+//*     analysis of the current load case (or combination), so the load
+//*     cases need not be kept to envelope them.
+//*
+//***************************************************************************
+
+void PlaneFrame::envelopeLoadCase(short int siLoadCase)
 {
     for (Member * memberCurr : this->members)
+        memberCurr->ce.update(memberCurr->ma, siLoadCase);
+}
+//*
+//* End of PlaneFrame::envelopeLoadCase
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::findMovingPath
+//*     This function finds the Members of the Moving Load path in path
+//*     order, with each Member's direction and start along the path.  The
+//*     path starts at the end of its first Member away from the second.
+//*
+//***************************************************************************
+
+bool PlaneFrame::findMovingPath(LoadMoving & lmove)
+{
+    this->vectMovingPath.clear();
+    this->dMovingPathLength = 0.0;
+
+    Node * nodeAt = nullptr; // ...where the path has reached
+    for (std::size_t uiSpan = 0; uiSpan < lmove.vectPath.size(); uiSpan++)
     {
-        // Member Deflection Calculation...
-        memberCurr->calcDeflection( this->isSpecialCrossSection(),
-                                    this->adDisplaceMatrix,
-                                    this->tl, this->ps.siDivisions );
+        Member * memberFound = this->tableMembers.find(lmove.vectPath[uiSpan]);
+        if (memberFound == nullptr)
+        {
+            std::cerr << "\n ERROR: Member Number " << lmove.vectPath[uiSpan] << std::endl
+                      <<   "        not found in Moving Load Path!\n";
+            return false;
+        }
+
+        bool bReversed = false;
+        if (nodeAt == nullptr)
+        {
+            // Start away from the second Member...
+            if (uiSpan + 1 < lmove.vectPath.size())
+            {
+                Member * memberNext = this->tableMembers.find(lmove.vectPath[uiSpan + 1]);
+                bReversed = ( memberNext != nullptr &&
+                              (memberFound->nodeNeg == memberNext->nodeNeg || memberFound->nodeNeg == memberNext->nodePos) );
+            }
+        }
+        else if (memberFound->nodePos == nodeAt)
+            bReversed = true;
+        else if (memberFound->nodeNeg != nodeAt)
+        {
+            std::cerr << "\n ERROR: Member Number " << memberFound->iID << std::endl
+                      <<   "        not connected to the Moving Load Path before it!\n";
+            return false;
+        }
+
+        this->vectMovingPath.push_back( { memberFound, bReversed, this->dMovingPathLength } );
+        this->dMovingPathLength += memberFound->dLength;
+        nodeAt = (bReversed ? memberFound->nodeNeg : memberFound->nodePos);
     }
 
     return true;
 }
 //*
-//* End of PlaneFrame::calcDeflections
+//* End of PlaneFrame::findMovingPath
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::applyMovingLoad
+//*     This function clears the loads and applies the Moving Load with its
+//*     lead load at the given position along the path.  Each load on the
+//*     path is a Concentrated Load on the first path Member reaching it.
+//*     The loads are processed and applied to the Members as a Load Case's.
+//*
+//***************************************************************************
+
+bool PlaneFrame::applyMovingLoad(LoadMoving & lmove, double dPosition)
+{
+    this->clearLoads();
+
+    for (std::size_t uiLoad = 0; uiLoad < lmove.vectOffset.size(); uiLoad++)
+    {
+        double dAlong = dPosition - lmove.vectOffset[uiLoad];
+        if (dAlong < 0.0 || dAlong > this->dMovingPathLength) // ...off the path
+            continue;
+
+        std::size_t uiSpan = 0;
+        while ( uiSpan + 1 < this->vectMovingPath.size() &&
+                dAlong > this->vectMovingPath[uiSpan].dStart + this->vectMovingPath[uiSpan].member->dLength )
+            uiSpan++;
+        MovingSpan & spanCurr = this->vectMovingPath[uiSpan];
+        double dDistance = std::min(dAlong - spanCurr.dStart, spanCurr.member->dLength);
+
+        LoadPoint * plNew = new LoadPoint;
+        plNew->iMemberID = spanCurr.member->iID;
+        plNew->iID = (int) uiLoad + 1;
+        plNew->adLoadVect[X] = lmove.vectLoadX[uiLoad];
+        plNew->adLoadVect[Y] = lmove.vectLoadY[uiLoad];
+        plNew->dDistance = (spanCurr.bReversed ? spanCurr.member->dLength - dDistance : dDistance);
+        this->pl.push_back(plNew);
+    }
+
+    return ( this->processLoads() && this->loadMembers() );
+}
+//*
+//* End of PlaneFrame::applyMovingLoad
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::solveMovingLoad
+//*     This function solves the given Moving Load at each position of its
+//*     lead load, in steps from the start of the path until its last load
+//*     leaves the end, and sets each Member's envelope over them.  The
+//*     positions are solved in batches of iMovingBatch against the System
+//*     Stiffness Matrix factor of setup().  Each position's loads are
+//*     applied to assemble its Force Matrix for the batch and again, once
+//*     solved, for its Member analysis.  The Load and Interaction are the
+//*     first Load Case's.
+//*
+//***************************************************************************
+
+bool PlaneFrame::solveMovingLoad(LoadMoving & lmove)
+{
+    if ( ! this->findMovingPath(lmove) )
+        return false;
+
+    if ( ! this->lc.empty() )
+        this->li = this->lc[0]->li;
+    if ( this->li.calcUsingTPI() )
+    {
+        std::cerr << "\n ERROR: Moving Load Concentrated Loads\n"
+                  <<   "        not permitted with TPI method!\n";
+        return false;
+    }
+
+    double dTravel = this->dMovingPathLength + lmove.getTrainLength();
+    int iPositions = (int) std::ceil(dTravel / lmove.dStep) + 1;
+    auto findPosition =
+        [&lmove, dTravel](int iPosition)
+        {
+            return std::min(iPosition * lmove.dStep, dTravel);
+        };
+
+    for (Member * memberCurr : this->members)
+        memberCurr->me.clear();
+
+    int iSystemSize = this->ssm.getSystemSize();
+    int iBatchSize = PlaneFrame::iMovingBatch;
+    if (iBatchSize > iPositions)
+        iBatchSize = iPositions;
+    std::vector<double> vectForce( (std::size_t) iBatchSize * iSystemSize );
+    std::vector<double> vectDisplace( (std::size_t) iBatchSize * iSystemSize );
+
+    for (int iFirst = 0; iFirst < iPositions; iFirst += iBatchSize)
+    {
+        int iBatch = std::min(iBatchSize, iPositions - iFirst);
+
+        // Assemble the batch of Force Matrices...
+        for (int iPosition = 0; iPosition < iBatch; iPosition++)
+        {
+            if ( ! this->applyMovingLoad( lmove, findPosition(iFirst + iPosition) ) )
+                return false;
+            std::copy( this->adForceMatrix, this->adForceMatrix + iSystemSize,
+                       vectForce.data() + (long int) iPosition * iSystemSize );
+        }
+
+        if ( ! this->ssm.calcDisplacement( vectDisplace.data(), vectForce.data(), (short int) iBatch ) )
+        {
+            std::cerr << "\n ERROR: Moving Load Displacements not solved!\n";
+            return false;
+        }
+
+        // Envelope each position's Member forces and deflections...
+        for (int iPosition = 0; iPosition < iBatch; iPosition++)
+        {
+            double dPosition = findPosition(iFirst + iPosition);
+            if ( ! this->applyMovingLoad(lmove, dPosition) )
+                return false;
+
+            const double * adDisplace = vectDisplace.data() + (long int) iPosition * iSystemSize;
+            this->adDisplaceMatrix = new double[iSystemSize];
+            std::copy(adDisplace, adDisplace + iSystemSize, this->adDisplaceMatrix);
+
+            this->calcMemberForces();
+            this->envelopeMembers(dPosition);
+        }
+    }
+
+    this->clearLoads();
+    this->iMovingPositions = iPositions;
+
+    return true;
+}
+//*
+//* End of PlaneFrame::solveMovingLoad
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* PlaneFrame::envelopeMembers
+//*     This function adds the Members' forces at their divisions and their
+//*     deflections to their envelopes for the given lead load position.
+//*     The Members are dealt in blocks to the threads.
+//*
+//***************************************************************************
+
+void PlaneFrame::envelopeMembers(double dPosition)
+{
+    short int siThreadCount = this->findMemberThreads();
+    auto envelopeBlock =
+        [this, dPosition](short int, std::size_t uiFirst, std::size_t uiLast)
+        {
+            DivisionStations ds;
+            DivisionSegments dsegs;
+            for (std::size_t uiMember = uiFirst; uiMember < uiLast; uiMember++)
+            {
+                Member * memberCurr = this->members[uiMember];
+                if ( memberCurr->mp->isFictitious() && ! this->isSpecialCrossSection() )
+                    continue;
+
+                this->findMemberStations(memberCurr, ds, dsegs);
+                for (int iStation = 0; iStation < ds.iCount; iStation++)
+                {
+                    memberCurr->me.update(MemberEnvelope::siAxial, ds.adAxial[iStation], ds.adLength[iStation], dPosition);
+                    memberCurr->me.update(MemberEnvelope::siShear, ds.adShear[iStation], ds.adLength[iStation], dPosition);
+                    memberCurr->me.update(MemberEnvelope::siBend,  ds.adBend[iStation],  ds.adLength[iStation], dPosition);
+                }
+
+                if ( memberCurr->calcDeflection( this->isSpecialCrossSection(),
+                                                 this->adDisplaceMatrix,
+                                                 this->getMemberTrapezoidalExtras(memberCurr),
+                                                 this->ps.siDivisions ) )
+                    memberCurr->me.update(MemberEnvelope::siDeflect, memberCurr->ma.dDelta, memberCurr->ma.dDeltaLength, dPosition);
+            }
+        };
+    this->runMemberThreads(siThreadCount, envelopeBlock);
+}
+//*
+//* End of PlaneFrame::envelopeMembers
 //***************************************************************************
@@ -19,8 +19,18 @@
 #include "LoadUniform.hpp"
 #include "LoadNodal.hpp"
 #include "LoadTrapezoidal.hpp"
+#include "LoadCase.hpp"
+#include "LoadCombination.hpp"
+#include "LoadMoving.hpp"
 #include "StiffnessMatrix.hpp"
-
+#include "NodeGraph.hpp"
+#include "IDTable.hpp"
+#include "DivisionKernel.hpp"
+#include "DivisionSegments.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <vector>
 
 // CAPS Plane Frame...
@@ -39,6 +49,7 @@ public:
     std::vector<LoadUniform *> ul;          // Uniform Load
     std::vector<LoadNodal *> nl;            // Nodal (point at node) Load
     std::vector<LoadTrapezoidal *> tl;      // Trapezoidal Load
+    std::vector<LoadCase *> lc;             // Load Cases read ahead for a batch solution
 
     double dCombinedExtHorz;                // Combined External Horizontal Energy
     double dCombinedExtVert;                // Combined External Vertical Energy
@@ -55,6 +66,15 @@ public:
     StiffnessMatrix ssm;                    // System Stiffness Matrix
     double * adForceMatrix;                 // pointer to Force Matrix
     double * adDisplaceMatrix;              // pointer to Displacement Matrix
+    double * adForceBatch;                  // pointer to Force Matrices of the Load Cases
+    double * adDisplaceBatch;               // pointer to Displacement Matrices of the Load Cases
+    short int siCasesSolved;                // Load Cases solved in the batch
+    int iMovingPositions;                   // Moving Load positions solved
+    double dMovingPathLength;               // Moving Load path length
+
+    char cOrderUsed;                        // Node ordering used for the SSM (see cOrder...)
+    int aiOrderBandwidth[2];                // SSM bandwidth of the input and the ordered Node sequence
+    std::size_t auiOrderProfile[2];         // SSM profile of the input and the ordered Node sequence
 
     bool bNoteCompression50;                // Member Note Flags
     bool bNoteCompression75;
@@ -67,6 +87,17 @@ public:
 
     short int siPerpendicular;
 
+    static const char cSolverAuto = 'A';            // Solver by matrix size
+    static const int iSparseThreshold = 3000;       // Auto: Sparse solver from this matrix size
+    static const int iCacheThreshold = 1000;        // Skyline: factor cache from this matrix size
+    static const char cOrderAuto = 'A';             // Node ordering of the least profile
+    static const char cOrderLegacy = 'L';           // Node ordering by Node degree (PPSA)
+    static const char cOrderCached = 'C';           // Node sequence of a cached factor
+    static const char cExtremeSample = 'S';         // Member extremes at the divisions (PPSA)
+    static const char cExtremeExact = 'E';          // Member extremes at the critical points
+    static const int iThreadMembers = 64;           // Member analysis: least Members per thread
+    static const int iMovingBatch = 64;             // Moving Load: most positions solved together
+
     // Methods...
 
     PlaneFrame(void);
@@ -75,15 +106,28 @@ public:
     void clearOption(void);
     void clearLoads(void);
     void clearLoadAnalysis(void);
+    void clearLoadCases(void);
     void clearMemberNoteFlags(void);
     bool setup(void);
+    bool updateMember(int, int);
+    std::span<Member *> getIncidentMembers(Node *);
     bool processLoads(void);
+    std::span<LoadPoint *> getMemberPointLoads(Member *);
+    std::span<LoadUniform *> getMemberUniformLoads(Member *);
+    std::span<LoadTrapezoidal *> getMemberTrapezoidalLoads(Member *);
+    std::span<LoadTrapezoidalExtra> getMemberTrapezoidalExtras(Member *);
     bool loadMembers(void);
-    bool createDisplacementMatrix(void);
+    bool storeLoadCase(bool, bool);
+    void restoreLoadCase(short int);
+    bool storeLoadCombinations(std::vector<LoadCombination *> &);
+    bool solveLoadCases(void);
+    bool createDisplacementMatrix(short int);
     void calcMemberForces(void);
     bool calcActions(void);
     void analyzeStructureForces(void);
     bool calcDeflections(void);
+    void envelopeLoadCase(short int);
+    bool solveMovingLoad(LoadMoving &);
     void setOptionSpecialCrossSection(void);
     void setOptionVersion3(void);
     void setOptionComposite(void);
@@ -92,22 +136,99 @@ public:
     bool isVersion3(void);
     bool isComposite(void);
     double getShearFactor(void);
+    void setSolverOption(char);
+    char getSolverOption(void);
+    void setPanelLength(double);
+    double getPanelLength(void);
+    void setOrderOption(char);
+    char getOrderOption(void);
+    void setExtremeOption(char);
+    char getExtremeOption(void);
 
 private:
+    struct MemberNotes                      // Member Note Flags of a force analysis thread
+    {
+        bool bCompression50 = false;
+        bool bCompression75 = false;
+        bool bTension = false;
+        bool bStressDifference = false;
+        bool bBuckle = false;
+        bool bEuler = false;
+        bool bTPI = false;
+        short int siPerpendicular = 0;
+    };
+    struct MovingSpan                       // Member of the Moving Load path
+    {
+        Member * member;
+        bool bReversed;                     // Path runs from the Pos end to the Neg end?
+        double dStart;                      // Path length at the start of the Member
+    };
+
     char cProcessingOption;         // Option Indicator for processing
                                     //  0  = Standard
                                     // ‘S’ = Special Cross Section
                                     // ‘C’ = Composite (GLULAM, LVL, PSL)
                                     // '3’ = PPSA3 Input Option
     double dShearFactor;
+    char cSolverOption;             // Solver Indicator for the SSM
+                                    // ‘A’ = Auto (by Matrix Size)
+                                    // ‘S’ = Skyline
+                                    // ‘C’ = Sparse Supernodal Cholesky
+                                    // ‘J’ = Iterative PCG, Jacobi
+                                    // ‘I’ = Iterative PCG, IC(0)
+                                    // ‘M’ = Mixed Precision Skyline
+    double dPanelLength;            // Panel Length along X to condense (0 = no Panels)
+    IDTable<Node> tableNodes;                       // Nodes by ID
+    IDTable<Member> tableMembers;                   // Members by ID
+    IDTable<MaterialProperty> tableMatProps;        // Member Properties by ID
+    std::vector<std::vector<Member *>> vectPanels; // Members of each Panel to condense
+    std::vector<std::size_t> vectIncidenceStart;   // First incident Member of each Node (by Node position)
+    std::vector<Member *> vectIncidence;            // Members incident to each Node, in Member order
+    std::vector<Node *> vectSequenceNodes;          // Used Nodes in sequence order (Node sequence - 1)
+    std::vector<std::size_t> vectPointStart;        // First Concentrated Load of each Member (by Member position)
+    std::vector<LoadPoint *> vectPointLoads;        // Concentrated Loads of each Member, in load order
+    std::vector<std::size_t> vectUniformStart;      // First Uniform Load of each Member (by Member position)
+    std::vector<LoadUniform *> vectUniformLoads;    // Uniform Loads of each Member, in load order
+    std::vector<std::size_t> vectTrapezoidalStart;  // First Trapezoidal Load of each Member (by Member position)
+    std::vector<LoadTrapezoidal *> vectTrapezoidalLoads; // Trapezoidal Loads of each Member, in load order
+    std::vector<LoadTrapezoidalExtra> vectTrapezoidalExtras; // Deflection constants of each binned Trapezoidal Load
+    char cOrderOption;              // Node ordering Indicator for the SSM
+                                    // ‘A’ = Auto (least profile of RCM, Sloan, GPS)
+                                    // ‘R’ = Reverse Cuthill-McKee
+                                    // ‘S’ = Sloan
+                                    // ‘G’ = Gibbs-Poole-Stockmeyer
+                                    // ‘L’ = Legacy (by Node degree)
+    char cExtremeOption;            // Member extremes Indicator for the force analysis
+                                    // ‘S’ = Sample at the divisions
+                                    // ‘E’ = Exact at the critical points
+    std::vector<MovingSpan> vectMovingPath;         // Members of the Moving Load path, in path order
 
     bool processMembers(void);
+    short int findMemberThreads(void);
+    template <typename Work>
+    void runMemberThreads(short int, Work &);
+    void findMemberStations(Member *, DivisionStations &, DivisionSegments &);
+    void analyzeMemberForces(Member *, DivisionStations &, DivisionSegments &, MemberNotes &);
+    bool findMovingPath(LoadMoving &);
+    bool applyMovingLoad(LoadMoving &, double);
+    void envelopeMembers(double);
+    void setWorkingStress(void);
+    void clearMemberLoads(void);
+    void binMemberLoads(void);
+    template <typename Load>
+    void binLoads(std::vector<Load *> &, std::vector<std::size_t> &, std::vector<Load *> &);
+    void findIncidence(void);
     bool processReactions(void);
     bool processReactionFreedom(void);
     bool findNodeFreedom(void);
-    bool minimizeBandwidth(void);
-    short int findSystemStiffnessMatrixSize(void);
-    short int findSystemStiffnessMatrixBandwidth(void);
+    void findNodeGraph(NodeGraph &, std::vector<Node *> &, std::vector<int> &);
+    bool minimizeBandwidth(bool);
+    bool orderLegacy(void);
+    std::uint64_t hashStructure(void);
+    bool applySequence(std::vector<int> &);
+    int findPanels(void);
+    int findSystemStiffnessMatrixSize(void);
+    int findSystemStiffnessMatrixBandwidth(void);
 };
 
 #endif /* PLANEFRAME_HPP_ */
@@ -31,8 +31,8 @@ void ProblemSize::clear(void)
     this->siPrintOut = 0;
     this->siLoads = 0;
     this->siDivisions = 0;
-    this->siNodeFreedom = 0;
-    this->siNodePinned = 0;
+    this->iNodeFreedom = 0;
+    this->iNodePinned = 0;
     this->uiReactions = 0;
 }
 
@@ -27,8 +27,8 @@ public:
     short int siDivisions;          // Number of Division Parts
 
     // Computed values...
-    short int siNodeFreedom;        // Number of Total Coordinates
-    short int siNodePinned;         // Number of Usage Coordinates
+    int iNodeFreedom;              // Number of Total Coordinates
+    int iNodePinned;               // Number of Usage Coordinates
     long unsigned int uiReactions;  // Number of Reactions
 
     ProblemSize(void);
@@ -33,7 +33,7 @@ Reaction::~Reaction(void)
 
 void Reaction::clear(void)
 {
-    this->siNodeID = 0;
+    this->iNodeID = 0;
     this->siType = Reaction::siPIN;
 
     this->dVector[0] = 0.0;
@@ -43,6 +43,11 @@ void Reaction::clear(void)
     this->vectMembersNeg.clear();
     this->vectMembersPos.clear();
 
+    this->clearLoadAnalysis();
+}
+
+void Reaction::clearLoadAnalysis(void)
+{
     this->dHorzReaction = 0.0;
     this->dVertReaction = 0.0;
     this->dRotReaction = 0.0;
@@ -58,7 +63,7 @@ std::string Reaction::report()
     return fmt::vformat(
                 strFormat,
                 fmt::make_format_args(
-                    this->siNodeID,
+                    this->iNodeID,
                     this->typeToString(),
                     this->dVector[0], this->dVector[1]
                 )
@@ -70,20 +75,14 @@ std::string Reaction::typeToString(void)
     return Reaction::strType[this->siType];
 }
 
-bool Reaction::linkNodes(std::vector<Node *> & nodes)
+bool Reaction::linkNodes(IDTable<Node> & tableNodes)
 {
-    Node * nodeFound = nullptr;
-    for (Node * nodeCurr : nodes)
-    {
-        if (this->siNodeID == nodeCurr->siID && nodeCurr->siSequence != 0)
-        {
-            nodeFound = nodeCurr;
-            break;
-        }
-    }
+    Node * nodeFound = tableNodes.find(this->iNodeID);
+    if (nodeFound != nullptr && nodeFound->iSequence == 0) // ...unused Node
+        nodeFound = nullptr;
     if (nodeFound == nullptr)
     {
-        std::cerr << "\n ERROR: Reaction Node " << this->siNodeID << std::endl
+        std::cerr << "\n ERROR: Reaction Node " << this->iNodeID << std::endl
                   <<   "        not found in Nodes!\n";
         return false;
     }
@@ -94,15 +93,15 @@ bool Reaction::linkNodes(std::vector<Node *> & nodes)
     return true;
 }
 
-bool Reaction::linkMembers(std::vector<Member *> & members)
+bool Reaction::linkMembers(std::span<Member *> members)
 {
     for (Member * memberCurr : members)
     {
-        if (memberCurr->siNegNodeID == this->siNodeID)
+        if (memberCurr->iNegNodeID == this->iNodeID)
         {
             this->vectMembersNeg.push_back(memberCurr);
         }
-        if (memberCurr->siPosNodeID == this->siNodeID)
+        if (memberCurr->iPosNodeID == this->iNodeID)
         {
             this->vectMembersPos.push_back(memberCurr);
         }
@@ -110,7 +109,7 @@ bool Reaction::linkMembers(std::vector<Member *> & members)
 
     if (this->vectMembersNeg.empty() && this->vectMembersPos.empty())
     {
-        std::cerr << "\n ERROR: Reaction Node " << this->siNodeID << std::endl
+        std::cerr << "\n ERROR: Reaction Node " << this->iNodeID << std::endl
                   <<   "        not found in Member End Nodes!\n";
         return false;
     }
@@ -163,9 +162,9 @@ void Reaction::processAction(ReactionCounts & reactionCounts)
     if (this->siType == Reaction::siFIX) // FIX
     {
         reactionCounts.siFixRgd++;
-        this->nodeReact->siHorzFlag = true; // FIXED
-        this->nodeReact->siVertFlag = true; // FIXED
-        this->nodeReact->siRotFlag = true; // FIXED
+        this->nodeReact->iHorzFlag = true; // FIXED
+        this->nodeReact->iVertFlag = true; // FIXED
+        this->nodeReact->iRotFlag = true; // FIXED
         // NOTE: DO NOT set a Node's Member Fixture to FIXED here
         //       (this->nodeReact->bMemberFixture = false) as it only
         //       applies to Member processing.  The Reaction's Fixture
@@ -174,15 +173,15 @@ void Reaction::processAction(ReactionCounts & reactionCounts)
     else if (this->siType == Reaction::siPIN) // PIN
     {
         reactionCounts.siFixPin++;
-        this->nodeReact->siHorzFlag = true; // FIXED
-        this->nodeReact->siVertFlag = true; // FIXED
+        this->nodeReact->iHorzFlag = true; // FIXED
+        this->nodeReact->iVertFlag = true; // FIXED
     }
     else // Roll Types...
     {
         if (this->siType == Reaction::siFIRL) // FIRL
         {
             reactionCounts.siRolRgd++;
-            this->nodeReact->siRotFlag = true; // FIXED
+            this->nodeReact->iRotFlag = true; // FIXED
             // NOTE: DO NOT set a Node's Member Fixture to FIXED here
             //       (this->nodeReact->bMemberFixture = false) as it only
             //       applies to Member processing.  The Reaction's Fixture
@@ -193,10 +192,10 @@ void Reaction::processAction(ReactionCounts & reactionCounts)
 
         // FIRLs and ROLLs can roll at an angle, so check for Vector Movement...
         if (this->dVector[X] == 0.0) // ...X held, only Y movement
-            this->nodeReact->siHorzFlag = true; // FIXED
+            this->nodeReact->iHorzFlag = true; // FIXED
         else
         {   // Y Held OR Both FREE
-            this->nodeReact->siVertFlag = true; // FIXED, Y held...maybe
+            this->nodeReact->iVertFlag = true; // FIXED, Y held...maybe
             if (this->dVector[Y] != 0.0) // Both FREE: Vector Movement
             {   // VertFlag == TRUE && X & Y Vector != 0.0
                 // Setup Vector info...
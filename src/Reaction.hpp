@@ -10,7 +10,9 @@
 
 #include "Node.hpp"
 #include "Member.hpp"
+#include "IDTable.hpp"
 
+#include <span>
 #include <string>
 #include <vector>
 
@@ -34,7 +36,7 @@ public:
     static const short int siROLL;          // ROLL Reaction Type
     static const short int siFIRL;          // FIRL Reaction Type
 
-    short int siNodeID;             // Reaction's Node Number
+    int iNodeID;                   // Reaction's Node Number
 
     short int siType;               // Reaction Type
     								// 0 = "FIX" : FIX RGD: 3 parts are held ( Horz, Vert, and Rot  )
@@ -55,12 +57,13 @@ public:
     Reaction(void);
     ~Reaction(void);
     void clear(void);
+    void clearLoadAnalysis(void);
 
     std::string report();
     std::string typeToString(void);
 
-    bool linkNodes(std::vector<Node *> &);
-    bool linkMembers(std::vector<Member *> &);
+    bool linkNodes(IDTable<Node> &);
+    bool linkMembers(std::span<Member *>);
     void processNodeForces(void);
     void processMemberForces(void);
     void processAction(ReactionCounts &);
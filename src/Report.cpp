@@ -58,6 +58,11 @@ void Report::setQuiet(void)
     this->bQuiet = true;
 }
 
+void Report::setEnvelopeOption(char cEnvelope)
+{
+    this->cEnvelopeOption = cEnvelope;
+}
+
 bool Report::checkReport(void)
 {
     if ( ! osOutFile.good() )
@@ -424,6 +429,37 @@ void Report::reportStructureSSM(void)
     // Print the System Stiffness Matrix report...
     //
     this->osOutFile << this->pframe->ssm.report();
+
+    //
+    // Print the Node ordering's bandwidth and profile (Skyline storage)...
+    //
+    std::string strOrder;
+    switch (this->pframe->cOrderUsed)
+    {
+        case NodeGraph::cOrderRCM:
+            strOrder = "RCM";
+            break;
+        case NodeGraph::cOrderSloan:
+            strOrder = "Sloan";
+            break;
+        case NodeGraph::cOrderGPS:
+            strOrder = "GPS";
+            break;
+        case PlaneFrame::cOrderLegacy:
+            strOrder = "Legacy";
+            break;
+        case PlaneFrame::cOrderCached:
+            strOrder = "Cached";
+            break;
+    }
+    if (this->pframe->getOrderOption() == PlaneFrame::cOrderAuto && this->pframe->cOrderUsed != PlaneFrame::cOrderCached)
+        strOrder += " (Auto: least Profile of RCM, Sloan, GPS)";
+    this->osOutFile
+        << fmt::format( "   Node Ordering:              {}\n", strOrder )
+        << fmt::format( "   Input Node Sequence:        Bandwidth {:6d}, Profile {:9d}\n",
+                        this->pframe->aiOrderBandwidth[0], this->pframe->auiOrderProfile[0] )
+        << fmt::format( "   Ordered Node Sequence:      Bandwidth {:6d}, Profile {:9d}\n",
+                        this->pframe->aiOrderBandwidth[1], this->pframe->auiOrderProfile[1] );
     this->osOutFile << "\n";
 }
 
@@ -507,9 +543,24 @@ void Report::reportLoadCaseLoads(void)
     //* Report the Load Case ID...
     //*****************************************************
 
-            //         1         2         3         4         5         6         7
-    this->osOutFile << " ***** LOAD CASE: " << std::setw(3) << std::right << siLoadCase
-                             << " ********************************************************\n\n";
+    LoadCombination * comboCurr = this->pframe->lc[this->siLoadCase - 1]->combo;
+    if (comboCurr == nullptr)
+    {
+                //         1         2         3         4         5         6         7
+        this->osOutFile << " ***** LOAD CASE: " << std::setw(3) << std::right << siLoadCase
+                                 << " ********************************************************\n\n";
+    }
+    else
+    {
+                //         1         2         3         4         5         6         7
+        this->osOutFile << " ***** LOAD COMBINATION: " << std::setw(3) << std::right << comboCurr->siNumber
+                                 << " *************************************************\n\n"
+                        << "  Load Combination: " << comboCurr->report() << "\n\n";
+    }
+
+    // Only the Load Case envelope is tabled...
+    if (this->cEnvelopeOption == Report::cEnvelopeOnly)
+        return;
 
     //*
     //* Report the Table of Stress Factor and Loads...
@@ -742,6 +793,17 @@ void Report::reportResults(void)
         << " ********************************** RESULTS **********************************\n"
         << " *****************************************************************************\n\n";
 
+    // Report the accuracy of an iterative solution (or the superposition of a combination)...
+    LoadCombination * comboCurr = this->pframe->lc[this->siLoadCase - 1]->combo;
+    if (comboCurr == nullptr)
+        this->osOutFile << this->pframe->ssm.reportSolution(this->siLoadCase - 1);
+    else
+        this->osOutFile << "   Superposed Solution: " << comboCurr->report() << "\n\n";
+
+    // Only the Load Case envelope is tabled...
+    if (this->cEnvelopeOption == Report::cEnvelopeOnly)
+        return;
+
     //
     // Report the Table of Plane Frame Load Actions (Tables 7 & 8)...
     //
@@ -807,7 +869,7 @@ void Report::reportResultsReactions(void)
     {
         // TODO: Reformat as repost function: reactCurr->reportResults()
         this->osOutFile
-            << "    " << std::setw(4) << std::right << reactCurr->siNodeID << "        "
+            << "    " << std::setw(4) << std::right << reactCurr->iNodeID << "        "
             << fmt::format(SF14_3f, reactCurr->dHorzReaction) << "    "
             << fmt::format(SF14_3f, reactCurr->dVertReaction) << "     "
             << fmt::format(SF14_4E, reactCurr->dRotReaction) << "\n";
@@ -860,7 +922,7 @@ void Report::reportResultsEndActions(void)
     {
         // TODO: Reformat as repost function: memberCurr->reportResultsEndActions()
         this->osOutFile
-            << "   " << std::setw(4) << std::right << memberCurr->siID
+            << "   " << std::setw(4) << std::right << memberCurr->iID
             << " ---[ Neg End "
             << fmt::format(SF14_3f, memberCurr->adLocalForce[0]) << " "
             << fmt::format(SF14_3f, memberCurr->adLocalForce[1]) << " "
@@ -893,17 +955,20 @@ void Report::reportResultsStressAxialBend(void)
 
     this->osOutFile << "                  ";
     if ( this->pframe->li.calcUsingTPI() )
-        this->osOutFile << "TPI Interaction: Truss with Uniform and Nodal Loads\n\n";
+        this->osOutFile << "TPI Interaction: Truss with Uniform and Nodal Loads\n";
     else if ( this->pframe->li.calcAtBendAndAxialMax() )
-        this->osOutFile << "Using Maximum Axial Force and Maximum Moment\n\n";
+        this->osOutFile << "Using Maximum Axial Force and Maximum Moment\n";
     else // if ( this->pframe->li.calcAtBendMax() || this->pframe->li.calcAtAxialMax() )
     {
         this->osOutFile << "Calculated at position of Maximum ";
         if ( this->pframe->li.calcAtBendMax() )
-            this->osOutFile << "Moment\n\n";
+            this->osOutFile << "Moment\n";
         else // this->pframe->li.calcAtAxialMax()
-            this->osOutFile << "Axial Force\n\n";
+            this->osOutFile << "Axial Force\n";
     }
+    if ( this->pframe->getExtremeOption() == PlaneFrame::cExtremeExact )
+        this->osOutFile << "                  Exact Extremes: Critical Points between Load Points\n";
+    this->osOutFile << "\n";
 
     if ( this->pframe->isSpecialCrossSection() )
     {
@@ -927,7 +992,7 @@ void Report::reportResultsStressAxialBend(void)
     for (Member * memberCurr : this->pframe->members)
     {
         // TODO: Reformat as repost function: memberCurr->reportResultsAxialBending()
-        this->osOutFile << "   " << std::setw(4) << std::right << memberCurr->siID;
+        this->osOutFile << "   " << std::setw(4) << std::right << memberCurr->iID;
 
         // Fictitious members that are NOT Special Cross-Section...
         if ( memberCurr->mp->isFictitious() && ! this->pframe->isSpecialCrossSection() )
@@ -1125,7 +1190,7 @@ void Report::reportResultsStressAxialBend(void)
         for (Member * memberCurr : this->pframe->members)
         {
             // TODO: Reformat as repost function: memberCurr->reportResultsAdjustedAxialBending()
-            this->osOutFile << "   " << std::setw(4) << std::right << memberCurr->siID;
+            this->osOutFile << "   " << std::setw(4) << std::right << memberCurr->iID;
 
             if ( memberCurr->mp->isFictitious() && ! this->pframe->isSpecialCrossSection() )
                 this->osOutFile << "     Fictitious Member: No Member Force Analysis performed.\n";
@@ -1156,7 +1221,10 @@ void Report::reportResultsStressShear(void)
     //***********************************************************
 
     this->osOutFile
-        << " TABLE 10:        Shear Stress Analysis\n\n";
+        << " TABLE 10:        Shear Stress Analysis\n";
+    if ( this->pframe->getExtremeOption() == PlaneFrame::cExtremeExact )
+        this->osOutFile << "                  Exact Extremes: Critical Points between Load Points\n";
+    this->osOutFile << "\n";
 
     this->osOutFile
         << "              Maximum          Location from       Member\n"
@@ -1166,7 +1234,7 @@ void Report::reportResultsStressShear(void)
     for (Member * memberCurr : this->pframe->members)
     {
         // TODO: Reformat as repost function: memberCurr->reportResultsShear()
-        this->osOutFile << "   " << std::setw(4) << std::right << memberCurr->siID;
+        this->osOutFile << "   " << std::setw(4) << std::right << memberCurr->iID;
 
         if ( memberCurr->mp->isFictitious() && ! this->pframe->isSpecialCrossSection() )
             this->osOutFile << "     Fictitious Member: No Shear Stress Analysis performed.\n";
@@ -1206,7 +1274,7 @@ void Report::reportResultsDeflection(void)
     for (Member * memberCurr : this->pframe->members)
     {
         // TODO: Reformat as repost function: memberCurr->reportResultsDeflection()
-        this->osOutFile << "   " << std::setw(4) << std::right << memberCurr->siID;
+        this->osOutFile << "   " << std::setw(4) << std::right << memberCurr->iID;
 
         if ( memberCurr->mp->isFictitious() && ! this->pframe->isSpecialCrossSection() )
             this->osOutFile << "     Fictitious Member: No Member Deflection Analysis performed.\n";
@@ -1242,22 +1310,22 @@ void Report::reportResultsDisplacement(void)
     for (Node * nodeCurr : this->pframe->nodes)
     {
         // TODO: Reformat as repost function: nodeCurr->reportResultsDisplacement()
-        if ( ! nodeCurr->siSequence )
+        if ( ! nodeCurr->iSequence )
             continue;
 
         double dHorzDisplace = 0.0;
         double dVertDisplace = 0.0;
         double dRotDisplace  = 0.0;
 
-        if (nodeCurr->siHorzFlag)
-            dHorzDisplace = this->pframe->adDisplaceMatrix[nodeCurr->siHorzFlag - 1];
-        if (nodeCurr->siVertFlag)
-            dVertDisplace = this->pframe->adDisplaceMatrix[nodeCurr->siVertFlag - 1];
-        if (nodeCurr->siRotFlag)
-            dRotDisplace  = this->pframe->adDisplaceMatrix[nodeCurr->siRotFlag  - 1];
+        if (nodeCurr->iHorzFlag)
+            dHorzDisplace = this->pframe->adDisplaceMatrix[nodeCurr->iHorzFlag - 1];
+        if (nodeCurr->iVertFlag)
+            dVertDisplace = this->pframe->adDisplaceMatrix[nodeCurr->iVertFlag - 1];
+        if (nodeCurr->iRotFlag)
+            dRotDisplace  = this->pframe->adDisplaceMatrix[nodeCurr->iRotFlag  - 1];
 
         this->osOutFile
-            << "   " << std::setw(4) << std::right << nodeCurr->siID
+            << "   " << std::setw(4) << std::right << nodeCurr->iID
             << "      " << this->formatReal(dHorzDisplace, 9, 6)
             << "         " << this->formatReal(dVertDisplace, 9, 6)
             << "   " << fmt::format(SF12_4E, dRotDisplace);
@@ -1284,6 +1352,228 @@ void Report::reportResultsDisplacement(void)
     this->osOutFile << "\n";
 }
 
+//***************************************************************************
+//*
+//* Report::reportLoadCaseEnvelope
+//*     Outputs the Member envelopes over the analyzed load cases and
+//*     combinations.
+//*
+//***************************************************************************
+
+void Report::reportLoadCaseEnvelope(short int siLoadCases)
+{
+    if ( this->bNotTerminalOut ) // ...if the general output is not to the terminal output...
+    {
+        if ( ! this->bQuiet )
+        {
+            // Print the Load Case Envelope Report indicator...
+            std::cout << "ENVELOPE     : "
+                      << std::setw(TAGLINE_WIDTH) << "Reporting Load Case Envelope..."
+                      << std::setfill(Report::cBackup) << std::setw(TAGLINE_WIDTH) << Report::cBackup << std::setfill(' ');
+        }
+    }
+
+            //         1         2         3         4         5         6         7
+    this->osOutFile << " ***** LOAD CASE ENVELOPE ****************************************************\n\n";
+
+    if (siLoadCases == 0)
+    {
+        this->osOutFile << Report::strNoLoad;
+        return;
+    }
+
+    this->reportLoadCaseEnvelopeMembers(siLoadCases);
+}
+
+void Report::reportLoadCaseEnvelopeMembers(short int siLoadCases)
+{
+    //*
+    //* Report the Table of Member Envelopes over the load cases...
+    //***********************************************************
+
+    short int siCombos = 0;
+    for (short int siCase = 0; siCase < siLoadCases; siCase++)
+        if (this->pframe->lc[siCase]->combo != nullptr)
+            siCombos++;
+
+    this->osOutFile
+        << fmt::format( " TABLE 13:        Load Case Envelope: {:d} Load Cases, {:d} Load Combinations\n",
+                        siLoadCases - siCombos, siCombos );
+    if ( this->pframe->getExtremeOption() == PlaneFrame::cExtremeExact )
+        this->osOutFile << "                  Exact Extremes: Critical Points between Load Points\n";
+    this->osOutFile << "\n";
+
+    this->osOutFile
+        << "          Greatest      Greatest       Maximum       Minimum      Stress       Greatest\n"
+        << "  Member    Moment  LC     Shear  LC     Axial  LC     Axial  LC   Index  LC  Deflection  LC\n"
+        << "  Number  (IN-LBS)         (LBS)         (LBS)         (LBS)                       (IN)\n\n";
+
+    // A governing Load Combination is marked by a 'C' on its number...
+    auto formatCase = [this](short int siCase) -> std::string
+    {
+        LoadCombination * comboCase = this->pframe->lc[siCase - 1]->combo;
+        if (comboCase == nullptr)
+            return fmt::format( "{:>4d}", siCase );
+        return fmt::format( "{:>4}", fmt::format("C{:d}", comboCase->siNumber) );
+    };
+
+    for (Member * memberCurr : this->pframe->members)
+    {
+        this->osOutFile << "   " << std::setw(4) << std::right << memberCurr->iID;
+
+        if ( memberCurr->mp->isFictitious() && ! this->pframe->isSpecialCrossSection() )
+            this->osOutFile << "     Fictitious Member: No Load Case Envelope found.\n";
+        else
+        {
+            MemberCaseEnvelope & ceCurr = memberCurr->ce;
+            this->osOutFile
+                << " "
+                << this->formatReal(ceCurr.dBend, 10, 2) << formatCase(ceCurr.siBendCase)
+                << this->formatReal(ceCurr.dShear, 10, 2) << formatCase(ceCurr.siShearCase)
+                << this->formatReal(ceCurr.dAxialMax, 10, 2) << formatCase(ceCurr.siAxialMaxCase)
+                << this->formatReal(ceCurr.dAxialMin, 10, 2) << formatCase(ceCurr.siAxialMinCase)
+                << this->formatReal(ceCurr.dAction, 8, 3) << formatCase(ceCurr.siActionCase)
+                << this->formatReal(ceCurr.dDelta, 12, 4) << formatCase(ceCurr.siDeltaCase) << "\n";
+        }
+    }
+    this->osOutFile << "\n";
+}
+
+void Report::reportMovingLoadSolving(void)
+{
+    // If the general output is not to the terminal output...
+    if (  this->bNotTerminalOut )
+    {
+        if ( ! this->bQuiet )
+        {
+            // Print the Moving Load Solve indicator...
+            std::cout << "MOVING LOAD  : "
+                      << std::setw(TAGLINE_WIDTH) <<  "Solving Moving Load..."
+                      << std::setfill(Report::cBackup) << std::setw(TAGLINE_WIDTH) << Report::cBackup << std::setfill(' ');
+        }
+    }
+}
+
+//***************************************************************************
+//*
+//* Report::reportMovingLoad
+//*     Outputs the Moving Load and the Member envelopes over its positions.
+//*
+//***************************************************************************
+
+void Report::reportMovingLoad(LoadMoving & lmove)
+{
+    if ( this->bNotTerminalOut ) // ...if the general output is not to the terminal output...
+    {
+        if ( ! this->bQuiet )
+        {
+            // Print the Moving Load Report indicator...
+            std::cout << std::setw(TAGLINE_WIDTH) << "Reporting Moving Load..."
+                      << std::setfill(Report::cBackup) << std::setw(TAGLINE_WIDTH) << Report::cBackup << std::setfill(' ');
+        }
+    }
+
+            //         1         2         3         4         5         6         7
+    this->osOutFile << " ***** MOVING LOAD ***********************************************************\n\n";
+
+    this->reportMovingLoadTrain(lmove);
+
+    this->osOutFile
+        << " *****************************************************************************\n"
+        << " ********************************** RESULTS **********************************\n"
+        << " *****************************************************************************\n\n"
+        << fmt::format( "   Batched Solution: {:d} Positions in batches of up to {:d}\n\n",
+                        this->pframe->iMovingPositions, (int) PlaneFrame::iMovingBatch )
+        << " * * * * * * * * * * * * *  MOVING LOAD ENVELOPES  * * * * * * * * * * * * * *\n\n";
+
+    for (short int siQuantity = 0; siQuantity < MemberEnvelope::siQuantities; siQuantity++)
+        this->reportMovingLoadEnvelope(siQuantity);
+}
+
+void Report::reportMovingLoadTrain(LoadMoving & lmove)
+{
+    //*
+    //* Report the Table of the Moving Load train and path...
+    //*****************************************************
+
+    this->osOutFile << " TABLE 14:        Moving Load\n\n";
+
+    this->osOutFile
+        << fmt::format( "   Load   {:>12}  {:>12}  {:>12}\n", "Offset", "Horizontal", "Vertical" )
+        << fmt::format( "  Number  {:>12}  {:>12}  {:>12}\n", "behind Lead", "Load", "Load" )
+        << fmt::format( "          {:>12}  {:>12}  {:>12}\n\n", "(IN)", "(LBS)", "(LBS)" );
+
+    for (std::size_t uiLoad = 0; uiLoad < lmove.vectOffset.size(); uiLoad++)
+    {
+        this->osOutFile
+            << "   " << std::setw(4) << std::right << uiLoad + 1 << "   "
+            << this->formatReal(lmove.vectOffset[uiLoad], 12, 3) << "  "
+            << this->formatReal(lmove.vectLoadX[uiLoad], 12, 3) << "  "
+            << this->formatReal(lmove.vectLoadY[uiLoad], 12, 3) << "\n";
+    }
+    this->osOutFile << "\n";
+
+    this->osOutFile << "   Path Members:";
+    for (std::size_t uiSpan = 0; uiSpan < lmove.vectPath.size(); uiSpan++)
+    {
+        if (uiSpan > 0 && uiSpan % 12 == 0)
+            this->osOutFile << "\n                ";
+        this->osOutFile << " " << std::setw(4) << std::right << lmove.vectPath[uiSpan];
+    }
+    this->osOutFile << "\n"
+        << fmt::format( "   Path Length: {:.3f} (IN), Step: {:.3f} (IN), Positions: {:d}\n\n",
+                        this->pframe->dMovingPathLength, lmove.dStep, this->pframe->iMovingPositions );
+}
+
+void Report::reportMovingLoadEnvelope(short int siQuantity)
+{
+    //*
+    //* Report a Table of Member Envelopes over the Moving Load positions...
+    //***********************************************************
+
+    static const char * astrTable[] = { "A", "B", "C", "D" };
+    static const char * astrTitle[] = { "Axial Force", "Shear Force", "Bending Moment", "Deflection" };
+    static const char * astrLabel[] = { "Axial", "Shear", "Moment", "Deflection" };
+    static const char * astrUnits[] = { "(LBS)", "(LBS)", "(IN-LBS)", "(IN)" };
+    unsigned long int uliPrecision = (siQuantity == MemberEnvelope::siDeflect ? 4 : 3);
+
+    this->osOutFile
+        << " TABLE 15 " << astrTable[siQuantity] << ":      Moving Load Envelope: " << astrTitle[siQuantity] << "\n";
+    if ( siQuantity != MemberEnvelope::siDeflect &&
+         this->pframe->getExtremeOption() == PlaneFrame::cExtremeExact )
+        this->osOutFile << "                  Exact Extremes: Critical Points between Load Points\n";
+    this->osOutFile << "\n";
+
+    this->osOutFile
+        << fmt::format( "        {:>12}{:>10}{:>11}  {:>12}{:>10}{:>11}\n",
+                        "Maximum", "Location", "Lead Load", "Minimum", "Location", "Lead Load" )
+        << fmt::format( "  Member{:>12}{:>10}{:>11}  {:>12}{:>10}{:>11}\n",
+                        astrLabel[siQuantity], "from Neg", "Position", astrLabel[siQuantity], "from Neg", "Position" )
+        << fmt::format( "  Number{:>12}{:>10}{:>11}  {:>12}{:>10}{:>11}\n\n",
+                        astrUnits[siQuantity], "(IN)", "(IN)", astrUnits[siQuantity], "(IN)", "(IN)" );
+
+    for (Member * memberCurr : this->pframe->members)
+    {
+        this->osOutFile << "   " << std::setw(4) << std::right << memberCurr->iID;
+
+        if ( memberCurr->mp->isFictitious() && ! this->pframe->isSpecialCrossSection() )
+            this->osOutFile << "     Fictitious Member: No Moving Load Envelope found.\n";
+        else
+        {
+            MemberEnvelope & meCurr = memberCurr->me;
+            this->osOutFile
+                << " "
+                << this->formatReal(meCurr.adMax[siQuantity], 12, uliPrecision)
+                << this->formatReal(meCurr.adMaxLoc[siQuantity], 10, 3)
+                << this->formatReal(meCurr.adMaxPos[siQuantity], 11, 3) << "  "
+                << this->formatReal(meCurr.adMin[siQuantity], 12, uliPrecision)
+                << this->formatReal(meCurr.adMinLoc[siQuantity], 10, 3)
+                << this->formatReal(meCurr.adMinPos[siQuantity], 11, 3) << "\n";
+        }
+    }
+    this->osOutFile << "\n";
+}
+
 void Report::reportLoadCaseNext(void)
 {
     if ( this->bNotTerminalOut ) // ...if the general output is not to the terminal output...
@@ -16,13 +16,19 @@
 #define TAGLINE_WIDTH 40
 
 class PlaneFrame;
+class LoadMoving;
 
 class Report
 {
 public:
+    static const char cEnvelopeNone = 'N';         // No Load Case envelope (default)
+    static const char cEnvelopeAdd = 'A';          // Load Case tables and envelope
+    static const char cEnvelopeOnly = 'O';         // Load Case envelope without the tables
+
     Report(void);
     Report(std::string &);
     void setQuiet(void);
+    void setEnvelopeOption(char);
     bool checkReport(void);
     void setPlaneFrame(PlaneFrame *);
     void setTitle(short int, std::string, std::string, std::string);
@@ -52,6 +58,11 @@ public:
 
     void reportLoadCaseNext(void);
 
+    void reportLoadCaseEnvelope(short int);
+
+    void reportMovingLoadSolving(void);
+    void reportMovingLoad(LoadMoving &);
+
     void close(void);
 
 private:
@@ -71,6 +82,7 @@ private:
     std::string strTitleID;
     std::string strTitleOpt;
     short int siLoadCase = 0;
+    char cEnvelopeOption = Report::cEnvelopeNone;
 
     void reportPreamble(std::ostream &);
     void reportTitle(std::ostream &);
@@ -95,6 +107,11 @@ private:
     void reportResultsDeflection(void);             // Table 11
     void reportResultsDisplacement(void);           // Table 12
 
+    void reportLoadCaseEnvelopeMembers(short int);  // Table 13
+
+    void reportMovingLoadTrain(LoadMoving &);       // Table 14
+    void reportMovingLoadEnvelope(short int);       // Table 15 A - D
+
     std::string formatReal(double, unsigned long int, unsigned long int );
 };
 
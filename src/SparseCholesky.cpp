@@ -0,0 +1,811 @@
+/*
+ * SparseCholesky.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#include "SparseCholesky.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <unordered_map>
+
+SparseCholesky::SparseCholesky(void)
+{
+    this->clear();
+}
+
+SparseCholesky::~SparseCholesky(void)
+{
+    this->clear();
+}
+
+void SparseCholesky::clear(void)
+{
+    this->iSize = 0;
+    this->vectPerm.clear();
+    this->vectPermInv.clear();
+
+    this->iSupers = 0;
+    this->vectSuperStart.clear();
+    this->vectColumnSuper.clear();
+    this->vectSuperRowPtr.clear();
+    this->vectSuperRows.clear();
+    this->vectSuperValPtr.clear();
+    this->vectValues.clear();
+    this->vectPivot.clear();
+    this->vectPivotInverse.clear();
+
+    this->vectNodeAdjPtr.clear();
+    this->vectNodeAdj.clear();
+    this->vectNodeRegion.clear();
+    this->vectNodeLevel.clear();
+    this->vectNodeMark.clear();
+    this->vectNodeOrder.clear();
+    this->iRegions = 0;
+    this->iMark = 0;
+    this->iSeparators = 0;
+}
+
+//***************************************************************************
+//*
+//* SparseCholesky::analyze
+//*     This function orders the equations and finds the structure of the
+//*     factor from the given matrix size and members.  The member DoF
+//*     indices (1 based, 0 = FIXED) are the matrix equations.  The factor
+//*     blocks are allocated and cleared to 0 ready for add().
+//*
+//***************************************************************************
+
+bool SparseCholesky::analyze(int iMatrixSize, std::vector<Member *> & members)
+{
+    this->clear();
+    this->iSize = iMatrixSize;
+
+    // Fill-reducing order...
+    this->orderNestedDissection(members);
+
+    // Elimination tree, factor structure and supernodes...
+    if ( ! this->analyzeSymbolic(members) )
+    {
+        this->clear();
+        return false;
+    }
+
+    return true;
+}
+
+//*
+//* End of SparseCholesky::analyze
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* SparseCholesky::orderNestedDissection
+//*     This function orders the equations by Nested Dissection of the
+//*     structure's node graph.  A node's free DoF are kept together so
+//*     they fall into the same supernodes.
+//*
+//*     Each subgraph is split by the middle level of a level structure
+//*     rooted at a pseudo-peripheral node (George-Liu).  The two halves
+//*     are ordered first and the separator last, so the separator's fill
+//*     is confined to the separator.
+//*
+//***************************************************************************
+
+void SparseCholesky::orderNestedDissection(std::vector<Member *> & members)
+{
+    //*
+    //* Build the node graph...
+    //************************************************************
+
+    std::unordered_map<Node *, int> mapNodeIndex;
+    std::vector<Node *> vectNodes;
+    for (Member * memberCurr : members)
+    {
+        Node * anodeEnds[2] = { memberCurr->nodeNeg, memberCurr->nodePos };
+        for (Node * nodeCurr : anodeEnds)
+        {
+            if ( mapNodeIndex.find(nodeCurr) == mapNodeIndex.end() )
+            {
+                mapNodeIndex[nodeCurr] = (int) vectNodes.size();
+                vectNodes.push_back(nodeCurr);
+            }
+        }
+    }
+
+    int iNodes = (int) vectNodes.size();
+    std::vector<std::vector<int>> vectAdjacent(iNodes);
+    for (Member * memberCurr : members)
+    {
+        int iNeg = mapNodeIndex[memberCurr->nodeNeg];
+        int iPos = mapNodeIndex[memberCurr->nodePos];
+        if (iNeg != iPos)
+        {
+            vectAdjacent[iNeg].push_back(iPos);
+            vectAdjacent[iPos].push_back(iNeg);
+        }
+    }
+
+    this->vectNodeAdjPtr.assign(iNodes + 1, 0);
+    for (int iNode = 0; iNode < iNodes; iNode++)
+    {
+        std::vector<int> & vectAdj = vectAdjacent[iNode];
+        std::sort( vectAdj.begin(), vectAdj.end() );
+        vectAdj.erase( std::unique( vectAdj.begin(), vectAdj.end() ), vectAdj.end() );
+        this->vectNodeAdjPtr[iNode + 1] = this->vectNodeAdjPtr[iNode] + (int) vectAdj.size();
+    }
+    this->vectNodeAdj.reserve( this->vectNodeAdjPtr[iNodes] );
+    for (int iNode = 0; iNode < iNodes; iNode++)
+        this->vectNodeAdj.insert( this->vectNodeAdj.end(), vectAdjacent[iNode].begin(), vectAdjacent[iNode].end() );
+
+    //*
+    //* Dissect the node graph...
+    //************************************************************
+
+    this->vectNodeRegion.assign(iNodes, 0);
+    this->vectNodeLevel.assign(iNodes, 0);
+    this->vectNodeMark.assign(iNodes, 0);
+    this->vectNodeOrder.clear();
+    this->vectNodeOrder.reserve(iNodes);
+    this->iRegions = 1;
+    this->iMark = 0;
+
+    std::vector<int> vectAll(iNodes);
+    for (int iNode = 0; iNode < iNodes; iNode++)
+        vectAll[iNode] = iNode;
+    if (iNodes > 0)
+        this->dissect(vectAll, 0);
+
+    //*
+    //* Expand the node order to the equation order...
+    //************************************************************
+
+    this->vectPerm.clear();
+    this->vectPerm.reserve(this->iSize);
+    this->vectPermInv.assign(this->iSize, -1);
+    for (int iNode : this->vectNodeOrder)
+    {
+        int aiIndex[3] = { vectNodes[iNode]->iHorzFlag,
+                           vectNodes[iNode]->iVertFlag,
+                           vectNodes[iNode]->iRotFlag };
+        for (int iIndex : aiIndex)
+        {
+            if (iIndex > 0 && this->vectPermInv[iIndex - 1] < 0) // ...element is FREE...
+            {
+                this->vectPermInv[iIndex - 1] = (int) this->vectPerm.size();
+                this->vectPerm.push_back(iIndex - 1);
+            }
+        }
+    }
+    // ...any equation no member reaches goes last (it is SINGULAR)...
+    for (int iIndex = 0; iIndex < this->iSize; iIndex++)
+    {
+        if (this->vectPermInv[iIndex] < 0)
+        {
+            this->vectPermInv[iIndex] = (int) this->vectPerm.size();
+            this->vectPerm.push_back(iIndex);
+        }
+    }
+
+    this->vectNodeAdjPtr.clear();
+    this->vectNodeAdj.clear();
+    this->vectNodeRegion.clear();
+    this->vectNodeLevel.clear();
+    this->vectNodeMark.clear();
+    this->vectNodeOrder.clear();
+}
+
+//*
+//* End of SparseCholesky::orderNestedDissection
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* SparseCholesky::findLevels
+//*     This function finds the level structure of a subgraph rooted at the
+//*     given node by a breadth first search.  The nodes are returned in
+//*     search order with the start of each level.  It returns the number
+//*     of levels.
+//*
+//***************************************************************************
+
+int SparseCholesky::findLevels(int iStart, int iRegion, std::vector<int> & vectSearch, std::vector<int> & vectLevelPtr)
+{
+    ++this->iMark;
+    vectSearch.clear();
+    vectLevelPtr.clear();
+
+    vectSearch.push_back(iStart);
+    this->vectNodeMark[iStart] = this->iMark;
+    this->vectNodeLevel[iStart] = 0;
+
+    size_t uiLevelStart = 0;
+    while ( uiLevelStart < vectSearch.size() )
+    {
+        size_t uiLevelEnd = vectSearch.size();
+        vectLevelPtr.push_back( (int) uiLevelStart );
+        int iLevel = (int) vectLevelPtr.size();
+        for (size_t uiIndex = uiLevelStart; uiIndex < uiLevelEnd; uiIndex++)
+        {
+            int iNode = vectSearch[uiIndex];
+            for (int iAdj = this->vectNodeAdjPtr[iNode]; iAdj < this->vectNodeAdjPtr[iNode + 1]; iAdj++)
+            {
+                int iNext = this->vectNodeAdj[iAdj];
+                if ( this->vectNodeRegion[iNext] == iRegion && this->vectNodeMark[iNext] != this->iMark )
+                {
+                    this->vectNodeMark[iNext] = this->iMark;
+                    this->vectNodeLevel[iNext] = iLevel;
+                    vectSearch.push_back(iNext);
+                }
+            }
+        }
+        uiLevelStart = uiLevelEnd;
+    }
+    vectLevelPtr.push_back( (int) vectSearch.size() );
+
+    return (int) vectLevelPtr.size() - 1;
+}
+
+//*
+//* End of SparseCholesky::findLevels
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* SparseCholesky::dissect
+//*     This function orders a subgraph (region) of the node graph.  Small
+//*     subgraphs are ordered as found.  Disconnected subgraphs are split
+//*     into their parts.  Otherwise, the middle level of a level structure
+//*     separates the subgraph into two parts ordered before the separator.
+//*
+//***************************************************************************
+
+void SparseCholesky::dissect(std::vector<int> & vectVerts, int iRegion)
+{
+    if ( (int) vectVerts.size() <= SparseCholesky::iLeafSize )
+    {
+        for (int iNode : vectVerts)
+        {
+            this->vectNodeRegion[iNode] = -1;
+            this->vectNodeOrder.push_back(iNode);
+        }
+        return;
+    }
+
+    std::vector<int> vectSearch;
+    std::vector<int> vectLevelPtr;
+
+    // Find a pseudo-peripheral node (George-Liu)...
+    int iStart = vectVerts[0];
+    int iLevels = this->findLevels(iStart, iRegion, vectSearch, vectLevelPtr);
+
+    if ( vectSearch.size() < vectVerts.size() )
+    {
+        // ...disconnected: split off the part found...
+        int iRegionFound = this->iRegions++;
+        int iRegionRest = this->iRegions++;
+        std::vector<int> vectRest;
+        for (int iNode : vectVerts)
+        {
+            if (this->vectNodeMark[iNode] != this->iMark)
+            {
+                this->vectNodeRegion[iNode] = iRegionRest;
+                vectRest.push_back(iNode);
+            }
+        }
+        for (int iNode : vectSearch)
+            this->vectNodeRegion[iNode] = iRegionFound;
+        std::vector<int> vectFound(vectSearch);
+        this->dissect(vectFound, iRegionFound);
+        this->dissect(vectRest, iRegionRest);
+        return;
+    }
+
+    while (true)
+    {
+        // ...the last level's node of least degree...
+        int iNext = vectSearch[ vectLevelPtr[iLevels - 1] ];
+        int iDegreeMin = this->vectNodeAdjPtr[iNext + 1] - this->vectNodeAdjPtr[iNext];
+        for (int iIndex = vectLevelPtr[iLevels - 1]; iIndex < vectLevelPtr[iLevels]; iIndex++)
+        {
+            int iNode = vectSearch[iIndex];
+            int iDegree = this->vectNodeAdjPtr[iNode + 1] - this->vectNodeAdjPtr[iNode];
+            if (iDegree < iDegreeMin)
+            {
+                iDegreeMin = iDegree;
+                iNext = iNode;
+            }
+        }
+
+        std::vector<int> vectSearchNext;
+        std::vector<int> vectLevelPtrNext;
+        int iLevelsNext = this->findLevels(iNext, iRegion, vectSearchNext, vectLevelPtrNext);
+        if (iLevelsNext <= iLevels)
+        {
+            // ...restore the kept level structure's levels...
+            for (int iLevel = 0; iLevel < iLevels; iLevel++)
+                for (int iIndex = vectLevelPtr[iLevel]; iIndex < vectLevelPtr[iLevel + 1]; iIndex++)
+                    this->vectNodeLevel[ vectSearch[iIndex] ] = iLevel;
+            break;
+        }
+        iStart = iNext;
+        iLevels = iLevelsNext;
+        vectSearch.swap(vectSearchNext);
+        vectLevelPtr.swap(vectLevelPtrNext);
+    }
+
+    // Too shallow to separate...
+    if (iLevels < 3)
+    {
+        for (int iNode : vectVerts)
+        {
+            this->vectNodeRegion[iNode] = -1;
+            this->vectNodeOrder.push_back(iNode);
+        }
+        return;
+    }
+
+    // Separate at the middle level...
+    int iHalf = (int) vectSearch.size() / 2;
+    int iMiddle = 1;
+    while (iMiddle < iLevels - 2 && vectLevelPtr[iMiddle + 1] <= iHalf)
+        iMiddle++;
+
+    int iRegionLow = this->iRegions++;
+    int iRegionHigh = this->iRegions++;
+    std::vector<int> vectLow;
+    std::vector<int> vectHigh;
+    std::vector<int> vectSeparator;
+    for (int iNode : vectSearch)
+    {
+        int iLevel = this->vectNodeLevel[iNode];
+        if (iLevel < iMiddle)
+            vectLow.push_back(iNode);
+        else if (iLevel > iMiddle)
+            vectHigh.push_back(iNode);
+        else
+        {
+            // ...only middle nodes touching the next level separate...
+            bool bSeparates = false;
+            for (int iAdj = this->vectNodeAdjPtr[iNode]; iAdj < this->vectNodeAdjPtr[iNode + 1]; iAdj++)
+            {
+                int iNext = this->vectNodeAdj[iAdj];
+                if (this->vectNodeRegion[iNext] == iRegion && this->vectNodeLevel[iNext] == iMiddle + 1)
+                {
+                    bSeparates = true;
+                    break;
+                }
+            }
+            if (bSeparates)
+                vectSeparator.push_back(iNode);
+            else
+                vectLow.push_back(iNode);
+        }
+    }
+    for (int iNode : vectLow)
+        this->vectNodeRegion[iNode] = iRegionLow;
+    for (int iNode : vectHigh)
+        this->vectNodeRegion[iNode] = iRegionHigh;
+    for (int iNode : vectSeparator)
+        this->vectNodeRegion[iNode] = -1;
+    this->iSeparators++;
+
+    this->dissect(vectLow, iRegionLow);
+    this->dissect(vectHigh, iRegionHigh);
+    for (int iNode : vectSeparator)
+        this->vectNodeOrder.push_back(iNode);
+}
+
+//*
+//* End of SparseCholesky::dissect
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* SparseCholesky::analyzeSymbolic
+//*     This function finds the elimination tree of the ordered matrix
+//*     (Liu), the row structures of the factor by walking each row's
+//*     subtree and the fundamental supernodes.  It then sets up the
+//*     supernode blocks.
+//*
+//***************************************************************************
+
+bool SparseCholesky::analyzeSymbolic(std::vector<Member *> & members)
+{
+    int iSize = this->iSize;
+
+    // Lower adjacency of each ordered equation...
+    std::vector<std::vector<int>> vectLower(iSize);
+    for (Member * memberCurr : members)
+    {
+        int aiPositionIndex[6];
+        aiPositionIndex[0] = memberCurr->nodeNeg->iHorzFlag;
+        aiPositionIndex[1] = memberCurr->nodeNeg->iVertFlag;
+        aiPositionIndex[2] = memberCurr->nodeNeg->iRotFlag;
+        aiPositionIndex[3] = memberCurr->nodePos->iHorzFlag;
+        aiPositionIndex[4] = memberCurr->nodePos->iVertFlag;
+        aiPositionIndex[5] = memberCurr->nodePos->iRotFlag;
+
+        for (short int siIndex1 = 0; siIndex1 < 6; siIndex1++)
+        {
+            if ( ! aiPositionIndex[siIndex1] ) // ...element is FIXED...
+                continue;
+            int iRow = this->vectPermInv[ aiPositionIndex[siIndex1] - 1 ];
+            for (short int siIndex2 = 0; siIndex2 < 6; siIndex2++)
+            {
+                if ( ! aiPositionIndex[siIndex2] ) // ...element is FIXED...
+                    continue;
+                int iCol = this->vectPermInv[ aiPositionIndex[siIndex2] - 1 ];
+                if (iCol < iRow)
+                    vectLower[iRow].push_back(iCol);
+            }
+        }
+    }
+    for (std::vector<int> & vectRow : vectLower)
+    {
+        std::sort( vectRow.begin(), vectRow.end() );
+        vectRow.erase( std::unique( vectRow.begin(), vectRow.end() ), vectRow.end() );
+    }
+
+    // Elimination tree...
+    std::vector<int> vectParent(iSize, -1);
+    std::vector<int> vectAncestor(iSize, -1);
+    for (int iRow = 0; iRow < iSize; iRow++)
+    {
+        for (int iCol : vectLower[iRow])
+        {
+            int iNode = iCol;
+            while (vectAncestor[iNode] != -1 && vectAncestor[iNode] != iRow)
+            {
+                int iNext = vectAncestor[iNode];
+                vectAncestor[iNode] = iRow;
+                iNode = iNext;
+            }
+            if (vectAncestor[iNode] == -1)
+            {
+                vectAncestor[iNode] = iRow;
+                vectParent[iNode] = iRow;
+            }
+        }
+    }
+    vectAncestor.clear();
+
+    // Column structures (rows below the diagonal) from each row's subtree...
+    std::vector<std::vector<int>> vectColumnRows(iSize);
+    std::vector<int> vectMark(iSize, -1);
+    for (int iRow = 0; iRow < iSize; iRow++)
+    {
+        vectMark[iRow] = iRow;
+        for (int iCol : vectLower[iRow])
+        {
+            for (int iNode = iCol; vectMark[iNode] != iRow; iNode = vectParent[iNode])
+            {
+                vectColumnRows[iNode].push_back(iRow);
+                vectMark[iNode] = iRow;
+            }
+        }
+        vectLower[iRow].clear();
+        vectLower[iRow].shrink_to_fit();
+    }
+
+    // Fundamental supernodes...
+    this->vectSuperStart.clear();
+    this->vectColumnSuper.assign(iSize, 0);
+    for (int iCol = 0; iCol < iSize; iCol++)
+    {
+        if ( iCol == 0 ||
+             vectParent[iCol - 1] != iCol ||
+             vectColumnRows[iCol - 1].size() != vectColumnRows[iCol].size() + 1 ||
+             iCol - this->vectSuperStart.back() >= SparseCholesky::iSuperMax )
+            this->vectSuperStart.push_back(iCol);
+        this->vectColumnSuper[iCol] = (int) this->vectSuperStart.size() - 1;
+    }
+    this->iSupers = (int) this->vectSuperStart.size();
+    this->vectSuperStart.push_back(iSize);
+
+    // Supernode rows and blocks...
+    this->vectSuperRowPtr.assign(this->iSupers + 1, 0);
+    this->vectSuperValPtr.assign(this->iSupers + 1, 0);
+    for (int iSuper = 0; iSuper < this->iSupers; iSuper++)
+    {
+        int iFirst = this->vectSuperStart[iSuper];
+        int iLast = this->vectSuperStart[iSuper + 1] - 1;
+        int iCols = iLast - iFirst + 1;
+        int iRows = iCols + (int) vectColumnRows[iLast].size();
+        this->vectSuperRowPtr[iSuper + 1] = this->vectSuperRowPtr[iSuper] + iRows;
+        this->vectSuperValPtr[iSuper + 1] = this->vectSuperValPtr[iSuper] + (long int) iRows * iCols;
+    }
+    this->vectSuperRows.resize( this->vectSuperRowPtr[this->iSupers] );
+    for (int iSuper = 0; iSuper < this->iSupers; iSuper++)
+    {
+        int iFirst = this->vectSuperStart[iSuper];
+        int iLast = this->vectSuperStart[iSuper + 1] - 1;
+        int * aiRows = this->vectSuperRows.data() + this->vectSuperRowPtr[iSuper];
+        for (int iCol = iFirst; iCol <= iLast; iCol++)
+            *aiRows++ = iCol;
+        for (int iRow : vectColumnRows[iLast])
+            *aiRows++ = iRow;
+    }
+
+    this->vectValues.assign( this->vectSuperValPtr[this->iSupers], 0.0 );
+    this->vectPivot.assign(iSize, 0.0);
+    this->vectPivotInverse.assign(iSize, 0.0);
+
+    return true;
+}
+
+//*
+//* End of SparseCholesky::analyzeSymbolic
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* SparseCholesky::add
+//*     This function adds a value to the matrix at the given (0 based)
+//*     original row and column.  Only one of each symmetric pair is added.
+//*
+//***************************************************************************
+
+void SparseCholesky::add(int iEquationRow, int iEquationCol, double dValue)
+{
+    int iRow = this->vectPermInv[iEquationRow];
+    int iCol = this->vectPermInv[iEquationCol];
+    if (iRow < iCol)
+        std::swap(iRow, iCol);
+
+    int iSuper = this->vectColumnSuper[iCol];
+    int iFirst = this->vectSuperStart[iSuper];
+    const int * aiRows = this->vectSuperRows.data() + this->vectSuperRowPtr[iSuper];
+    int iRows = this->vectSuperRowPtr[iSuper + 1] - this->vectSuperRowPtr[iSuper];
+    int iCols = this->vectSuperStart[iSuper + 1] - iFirst;
+
+    int iPos = iRow - iFirst;
+    if (iPos >= iCols) // ...below the supernode's diagonal block...
+        iPos = (int) ( std::lower_bound(aiRows + iCols, aiRows + iRows, iRow) - aiRows );
+
+    this->vectValues[ this->vectSuperValPtr[iSuper] + (long int) (iCol - iFirst) * iRows + iPos ] += dValue;
+}
+
+//*
+//* End of SparseCholesky::add
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* SparseCholesky::factor
+//*     This function factors the assembled matrix into L D Lt by
+//*     supernodes.  Each supernode first receives the updates of the
+//*     factored supernodes whose structures reach its columns.  Those
+//*     supernodes wait on a list for the supernode holding their next row
+//*     (Ng-Peyton).  Its dense block is then factored column by column.
+//*
+//***************************************************************************
+
+bool SparseCholesky::factor(void)
+{
+    std::vector<int> vectHead(this->iSupers, -1);     // Updating supernodes list
+    std::vector<int> vectNext(this->iSupers, -1);     // ...next on list
+    std::vector<int> vectNextRow(this->iSupers, 0);   // ...next row position to update from
+    std::vector<int> vectRelative(this->iSize, 0);    // Row -> position in the current supernode
+    double * adValues = this->vectValues.data();
+
+    for (int iSuper = 0; iSuper < this->iSupers; iSuper++)
+    {
+        int iFirst = this->vectSuperStart[iSuper];
+        int iLast = this->vectSuperStart[iSuper + 1] - 1;
+        int iCols = iLast - iFirst + 1;
+        const int * aiRows = this->vectSuperRows.data() + this->vectSuperRowPtr[iSuper];
+        int iRows = this->vectSuperRowPtr[iSuper + 1] - this->vectSuperRowPtr[iSuper];
+        double * adBlock = adValues + this->vectSuperValPtr[iSuper];
+
+        for (int iRow = 0; iRow < iRows; iRow++)
+            vectRelative[ aiRows[iRow] ] = iRow;
+
+        //*
+        //* Apply the updates of the factored supernodes...
+        //************************************************************
+
+        int iUpdate = vectHead[iSuper];
+        vectHead[iSuper] = -1;
+        while (iUpdate != -1)
+        {
+            int iUpdateNext = vectNext[iUpdate];
+
+            int iUpdateCols = this->vectSuperStart[iUpdate + 1] - this->vectSuperStart[iUpdate];
+            const int * aiUpdateRows = this->vectSuperRows.data() + this->vectSuperRowPtr[iUpdate];
+            int iUpdateRows = this->vectSuperRowPtr[iUpdate + 1] - this->vectSuperRowPtr[iUpdate];
+            const double * adUpdate = adValues + this->vectSuperValPtr[iUpdate];
+            const double * adUpdatePivot = this->vectPivot.data() + this->vectSuperStart[iUpdate];
+
+            // ...the update rows falling in this supernode's columns...
+            int iStart = vectNextRow[iUpdate];
+            int iEnd = iStart;
+            while (iEnd < iUpdateRows && aiUpdateRows[iEnd] <= iLast)
+                iEnd++;
+
+            for (int iTarget = iStart; iTarget < iEnd; iTarget++)
+            {
+                double * adTarget = adBlock + (long int) (aiUpdateRows[iTarget] - iFirst) * iRows;
+                for (int iCol = 0; iCol < iUpdateCols; iCol++)
+                {
+                    const double * adUpdateCol = adUpdate + (long int) iCol * iUpdateRows;
+                    double dFactor = adUpdateCol[iTarget] * adUpdatePivot[iCol];
+                    if (dFactor == 0.0)
+                        continue;
+                    for (int iRow = iTarget; iRow < iUpdateRows; iRow++)
+                        adTarget[ vectRelative[ aiUpdateRows[iRow] ] ] -= adUpdateCol[iRow] * dFactor;
+                }
+            }
+
+            // ...wait for the supernode holding the next row...
+            vectNextRow[iUpdate] = iEnd;
+            if (iEnd < iUpdateRows)
+            {
+                int iSuperNext = this->vectColumnSuper[ aiUpdateRows[iEnd] ];
+                vectNext[iUpdate] = vectHead[iSuperNext];
+                vectHead[iSuperNext] = iUpdate;
+            }
+
+            iUpdate = iUpdateNext;
+        }
+
+        //*
+        //* Factor the dense block...
+        //************************************************************
+
+        for (int iCol = 0; iCol < iCols; iCol++)
+        {
+            double * adCol = adBlock + (long int) iCol * iRows;
+            for (int iPrev = 0; iPrev < iCol; iPrev++)
+            {
+                const double * adPrev = adBlock + (long int) iPrev * iRows;
+                double dFactor = adPrev[iCol] * this->vectPivot[iFirst + iPrev];
+                if (dFactor == 0.0)
+                    continue;
+                for (int iRow = iCol; iRow < iRows; iRow++)
+                    adCol[iRow] -= adPrev[iRow] * dFactor;
+            }
+
+            double dPivot = adCol[iCol];
+            if (dPivot == 0.0)
+            {
+                std::cerr << "\n WARNING: Stiffness Matrix is SINGULAR!\n"
+                          <<   "          Unable to find solution for Plane Frame!\n";
+                return false;
+            }
+            double dPivotInverse = 1.0 / dPivot;
+            this->vectPivot[iFirst + iCol] = dPivot;
+            this->vectPivotInverse[iFirst + iCol] = dPivotInverse;
+            for (int iRow = iCol + 1; iRow < iRows; iRow++)
+                adCol[iRow] *= dPivotInverse;
+        }
+
+        // Wait for the supernode holding the first row below the block...
+        vectNextRow[iSuper] = iCols;
+        if (iCols < iRows)
+        {
+            int iSuperNext = this->vectColumnSuper[ aiRows[iCols] ];
+            vectNext[iSuper] = vectHead[iSuperNext];
+            vectHead[iSuperNext] = iSuper;
+        }
+    }
+
+    return true;
+}
+
+//*
+//* End of SparseCholesky::factor
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* SparseCholesky::solve
+//*     This function solves for the displacements given the forces using
+//*     the factor: L y = P f, D z = y, Lt x' = z, x = Pt x'.  A batch of
+//*     force vectors (each Matrix Size long) is solved together.  The work
+//*     holds each row's values for all of the vectors side by side, so
+//*     each factor entry is loaded once and applied across the batch.
+//*
+//***************************************************************************
+
+void SparseCholesky::solve(double * adDisplace, double * adForce, int iCount)
+{
+    long int lStride = this->iSize;
+    std::vector<double> vectWork(lStride * iCount);
+    std::vector<double> vectSum(iCount);
+    double * adWork = vectWork.data();
+    double * adSum = vectSum.data();
+    for (int iIndex = 0; iIndex < this->iSize; iIndex++)
+    {
+        for (int iCase = 0; iCase < iCount; iCase++)
+            adWork[(long int) iIndex * iCount + iCase] = adForce[ iCase * lStride + this->vectPerm[iIndex] ];
+    }
+
+    // Forward...
+    for (int iSuper = 0; iSuper < this->iSupers; iSuper++)
+    {
+        int iFirst = this->vectSuperStart[iSuper];
+        int iCols = this->vectSuperStart[iSuper + 1] - iFirst;
+        const int * aiRows = this->vectSuperRows.data() + this->vectSuperRowPtr[iSuper];
+        int iRows = this->vectSuperRowPtr[iSuper + 1] - this->vectSuperRowPtr[iSuper];
+        const double * adBlock = this->vectValues.data() + this->vectSuperValPtr[iSuper];
+        for (int iCol = 0; iCol < iCols; iCol++)
+        {
+            const double * adCol = adBlock + (long int) iCol * iRows;
+            const double * adValue = adWork + (long int) (iFirst + iCol) * iCount;
+            for (int iRow = iCol + 1; iRow < iRows; iRow++)
+            {
+                double dEntry = adCol[iRow];
+                double * adTarget = adWork + (long int) aiRows[iRow] * iCount;
+                for (int iCase = 0; iCase < iCount; iCase++)
+                    adTarget[iCase] -= dEntry * adValue[iCase];
+            }
+        }
+    }
+
+    // Diagonal...
+    for (int iIndex = 0; iIndex < this->iSize; iIndex++)
+    {
+        for (int iCase = 0; iCase < iCount; iCase++)
+            adWork[(long int) iIndex * iCount + iCase] *= this->vectPivotInverse[iIndex];
+    }
+
+    // Back...
+    for (int iSuper = this->iSupers - 1; iSuper >= 0; iSuper--)
+    {
+        int iFirst = this->vectSuperStart[iSuper];
+        int iCols = this->vectSuperStart[iSuper + 1] - iFirst;
+        const int * aiRows = this->vectSuperRows.data() + this->vectSuperRowPtr[iSuper];
+        int iRows = this->vectSuperRowPtr[iSuper + 1] - this->vectSuperRowPtr[iSuper];
+        const double * adBlock = this->vectValues.data() + this->vectSuperValPtr[iSuper];
+        for (int iCol = iCols - 1; iCol >= 0; iCol--)
+        {
+            const double * adCol = adBlock + (long int) iCol * iRows;
+            std::fill(adSum, adSum + iCount, 0.0);
+            for (int iRow = iCol + 1; iRow < iRows; iRow++)
+            {
+                double dEntry = adCol[iRow];
+                const double * adSource = adWork + (long int) aiRows[iRow] * iCount;
+                for (int iCase = 0; iCase < iCount; iCase++)
+                    adSum[iCase] += dEntry * adSource[iCase];
+            }
+            double * adValue = adWork + (long int) (iFirst + iCol) * iCount;
+            for (int iCase = 0; iCase < iCount; iCase++)
+                adValue[iCase] -= adSum[iCase];
+        }
+    }
+
+    for (int iIndex = 0; iIndex < this->iSize; iIndex++)
+    {
+        for (int iCase = 0; iCase < iCount; iCase++)
+            adDisplace[ iCase * lStride + this->vectPerm[iIndex] ] = adWork[(long int) iIndex * iCount + iCase];
+    }
+}
+
+//* End of SparseCholesky::solve
+//***************************************************************************
+
+long int SparseCholesky::getFactorSize(void)
+{
+    // Lower triangle entries including the diagonal...
+    long int lSize = 0;
+    for (int iSuper = 0; iSuper < this->iSupers; iSuper++)
+    {
+        long int lCols = this->vectSuperStart[iSuper + 1] - this->vectSuperStart[iSuper];
+        long int lRows = this->vectSuperRowPtr[iSuper + 1] - this->vectSuperRowPtr[iSuper];
+        lSize += lCols * lRows - lCols * (lCols - 1) / 2;
+    }
+    return lSize;
+}
+
+int SparseCholesky::getSupernodes(void)
+{
+    return this->iSupers;
+}
+
+int SparseCholesky::getSeparators(void)
+{
+    return this->iSeparators;
+}
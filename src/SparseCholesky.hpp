@@ -0,0 +1,75 @@
+/*
+ * SparseCholesky.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#ifndef SPARSECHOLESKY_HPP_
+#define SPARSECHOLESKY_HPP_
+
+#include "Member.hpp"
+
+#include <string>
+#include <vector>
+
+// Sparse Supernodal Cholesky (LDLt) Factorization of the System Stiffness Matrix...
+//
+//   The equations are ordered by Nested Dissection of the structure's node
+//   graph.  A symbolic phase finds the elimination tree, the nonzero
+//   structure of the factor and its supernodes (runs of columns sharing
+//   one structure).  The numeric phase factors each supernode as a dense
+//   block using the updates of the supernodes below it (left looking).
+
+class SparseCholesky
+{
+public:
+    static const int iLeafSize = 16;        // Nested Dissection: smallest subgraph dissected
+    static const int iSuperMax = 96;        // Largest supernode (columns)
+
+    SparseCholesky(void);
+    ~SparseCholesky(void);
+    void clear(void);
+
+    bool analyze(int, std::vector<Member *> &);
+    void add(int, int, double);
+    bool factor(void);
+    void solve(double *, double *, int);
+
+    long int getFactorSize(void);
+    int getSupernodes(void);
+    int getSeparators(void);
+
+private:
+    int iSize;                              // Matrix size (equations)
+    std::vector<int> vectPerm;              // Permuted equation -> original equation
+    std::vector<int> vectPermInv;           // Original equation -> permuted equation
+
+    int iSupers;                            // # of supernodes
+    std::vector<int> vectSuperStart;        // First column of each supernode (+ end)
+    std::vector<int> vectColumnSuper;       // Supernode of each column
+    std::vector<int> vectSuperRowPtr;       // Start of each supernode's rows (+ end)
+    std::vector<int> vectSuperRows;         // Row structure of the supernodes
+    std::vector<long int> vectSuperValPtr;  // Start of each supernode's block (+ end)
+    std::vector<double> vectValues;         // Supernode blocks (column major)
+    std::vector<double> vectPivot;          // D of the factor
+    std::vector<double> vectPivotInverse;   // D^-1 of the factor
+
+    // Nested Dissection work on the node graph...
+    std::vector<int> vectNodeAdjPtr;        // Node adjacency starts (+ end)
+    std::vector<int> vectNodeAdj;           // Node adjacency
+    std::vector<int> vectNodeRegion;        // Subgraph of each node (-1 = ordered)
+    std::vector<int> vectNodeLevel;         // Level of each node in the last search
+    std::vector<int> vectNodeMark;          // Search marks
+    std::vector<int> vectNodeOrder;         // Node elimination order
+    int iRegions;                           // # of subgraphs made
+    int iMark;                              // Current search mark
+    int iSeparators;                        // # of separators found
+
+    void orderNestedDissection(std::vector<Member *> &);
+    void dissect(std::vector<int> &, int);
+    int findLevels(int, int, std::vector<int> &, std::vector<int> &);
+    bool analyzeSymbolic(std::vector<Member *> &);
+};
+
+#endif /* SPARSECHOLESKY_HPP_ */
@@ -0,0 +1,319 @@
+/*
+ * StiffnessKernel.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#include "StiffnessKernel.hpp"
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#define CAPS_KERNEL_X86
+#include <immintrin.h>
+#endif
+
+StiffnessKernel::Dot StiffnessKernel::fnDot = StiffnessKernel::dotScalar;
+StiffnessKernel::Axpy StiffnessKernel::fnAxpy = StiffnessKernel::axpyScalar;
+StiffnessKernel::DotFloat StiffnessKernel::fnDotFloat = StiffnessKernel::dotScalar;
+StiffnessKernel::AxpyFloat StiffnessKernel::fnAxpyFloat = StiffnessKernel::axpyScalar;
+const char * StiffnessKernel::strName = "Scalar";
+
+//***************************************************************************
+//*
+//* StiffnessKernel::dotScalar
+//*     This function sums the products of three streams.  The terms are
+//*     summed in 8 lanes which are then reduced pairwise as a vector unit
+//*     would: lanes 0-3 with 4-7, then 0-1 with 2-3, then 0 with 1.  Any
+//*     remaining terms are added in order.
+//*
+//***************************************************************************
+
+double StiffnessKernel::dotScalar(const double * adA, const double * adB, const double * adC, int iCount)
+{
+    double adSum[siLanes] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+    int iIndex = 0;
+    for ( ; iIndex + siLanes <= iCount; iIndex += siLanes)
+    {
+        for (short int siLane = 0; siLane < siLanes; siLane++)
+            adSum[siLane] += adA[iIndex + siLane] * adB[iIndex + siLane] * adC[iIndex + siLane];
+    }
+
+    double adHalf[4];
+    for (short int siLane = 0; siLane < 4; siLane++)
+        adHalf[siLane] = adSum[siLane] + adSum[siLane + 4];
+    double dSum = (adHalf[0] + adHalf[2]) + (adHalf[1] + adHalf[3]);
+
+    for ( ; iIndex < iCount; iIndex++)
+        dSum += adA[iIndex] * adB[iIndex] * adC[iIndex];
+
+    return dSum;
+}
+
+//*
+//* End of StiffnessKernel::dotScalar
+//***************************************************************************
+
+void StiffnessKernel::axpyScalar(double * adY, const double * adX, double dAlpha, int iCount)
+{
+    for (int iIndex = 0; iIndex < iCount; iIndex++)
+        adY[iIndex] -= dAlpha * adX[iIndex];
+}
+
+float StiffnessKernel::dotScalar(const float * afA, const float * afB, const float * afC, int iCount)
+{
+    float afSum[siLanes] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+    int iIndex = 0;
+    for ( ; iIndex + siLanes <= iCount; iIndex += siLanes)
+    {
+        for (short int siLane = 0; siLane < siLanes; siLane++)
+            afSum[siLane] += afA[iIndex + siLane] * afB[iIndex + siLane] * afC[iIndex + siLane];
+    }
+
+    float afHalf[4];
+    for (short int siLane = 0; siLane < 4; siLane++)
+        afHalf[siLane] = afSum[siLane] + afSum[siLane + 4];
+    float fSum = (afHalf[0] + afHalf[2]) + (afHalf[1] + afHalf[3]);
+
+    for ( ; iIndex < iCount; iIndex++)
+        fSum += afA[iIndex] * afB[iIndex] * afC[iIndex];
+
+    return fSum;
+}
+
+void StiffnessKernel::axpyScalar(float * afY, const float * afX, float fAlpha, int iCount)
+{
+    for (int iIndex = 0; iIndex < iCount; iIndex++)
+        afY[iIndex] -= fAlpha * afX[iIndex];
+}
+
+#ifdef CAPS_KERNEL_X86
+
+//***************************************************************************
+//*
+//* AVX2 Kernels
+//*     Two 4 lane registers hold lanes 0-3 and 4-7.
+//*
+//***************************************************************************
+
+__attribute__((target("avx2")))
+static double dotAVX2(const double * adA, const double * adB, const double * adC, int iCount)
+{
+    __m256d vSumLow = _mm256_setzero_pd();
+    __m256d vSumHigh = _mm256_setzero_pd();
+
+    int iIndex = 0;
+    for ( ; iIndex + StiffnessKernel::siLanes <= iCount; iIndex += StiffnessKernel::siLanes)
+    {
+        __m256d vTerm = _mm256_mul_pd( _mm256_mul_pd( _mm256_loadu_pd(adA + iIndex),
+                                                      _mm256_loadu_pd(adB + iIndex) ),
+                                       _mm256_loadu_pd(adC + iIndex) );
+        vSumLow = _mm256_add_pd(vSumLow, vTerm);
+        vTerm = _mm256_mul_pd( _mm256_mul_pd( _mm256_loadu_pd(adA + iIndex + 4),
+                                              _mm256_loadu_pd(adB + iIndex + 4) ),
+                               _mm256_loadu_pd(adC + iIndex + 4) );
+        vSumHigh = _mm256_add_pd(vSumHigh, vTerm);
+    }
+
+    __m256d vHalf = _mm256_add_pd(vSumLow, vSumHigh);
+    __m128d vQuarter = _mm_add_pd( _mm256_castpd256_pd128(vHalf), _mm256_extractf128_pd(vHalf, 1) );
+    double dSum = _mm_cvtsd_f64(vQuarter) + _mm_cvtsd_f64( _mm_unpackhi_pd(vQuarter, vQuarter) );
+
+    for ( ; iIndex < iCount; iIndex++)
+        dSum += adA[iIndex] * adB[iIndex] * adC[iIndex];
+
+    return dSum;
+}
+
+__attribute__((target("avx2")))
+static void axpyAVX2(double * adY, const double * adX, double dAlpha, int iCount)
+{
+    __m256d vAlpha = _mm256_set1_pd(dAlpha);
+
+    int iIndex = 0;
+    for ( ; iIndex + 4 <= iCount; iIndex += 4)
+    {
+        __m256d vY = _mm256_sub_pd( _mm256_loadu_pd(adY + iIndex),
+                                    _mm256_mul_pd( vAlpha, _mm256_loadu_pd(adX + iIndex) ) );
+        _mm256_storeu_pd(adY + iIndex, vY);
+    }
+
+    for ( ; iIndex < iCount; iIndex++)
+        adY[iIndex] -= dAlpha * adX[iIndex];
+}
+
+//***************************************************************************
+//*
+//* AVX2 Single Precision Kernels
+//*     One 8 lane register holds all lanes.
+//*
+//***************************************************************************
+
+__attribute__((target("avx2")))
+static float dotFloatAVX2(const float * afA, const float * afB, const float * afC, int iCount)
+{
+    __m256 vSum = _mm256_setzero_ps();
+
+    int iIndex = 0;
+    for ( ; iIndex + StiffnessKernel::siLanes <= iCount; iIndex += StiffnessKernel::siLanes)
+    {
+        __m256 vTerm = _mm256_mul_ps( _mm256_mul_ps( _mm256_loadu_ps(afA + iIndex),
+                                                     _mm256_loadu_ps(afB + iIndex) ),
+                                      _mm256_loadu_ps(afC + iIndex) );
+        vSum = _mm256_add_ps(vSum, vTerm);
+    }
+
+    __m128 vHalf = _mm_add_ps( _mm256_castps256_ps128(vSum), _mm256_extractf128_ps(vSum, 1) );
+    __m128 vQuarter = _mm_add_ps( vHalf, _mm_movehl_ps(vHalf, vHalf) );
+    float fSum = _mm_cvtss_f32(vQuarter) + _mm_cvtss_f32( _mm_shuffle_ps(vQuarter, vQuarter, 1) );
+
+    for ( ; iIndex < iCount; iIndex++)
+        fSum += afA[iIndex] * afB[iIndex] * afC[iIndex];
+
+    return fSum;
+}
+
+__attribute__((target("avx2")))
+static void axpyFloatAVX2(float * afY, const float * afX, float fAlpha, int iCount)
+{
+    __m256 vAlpha = _mm256_set1_ps(fAlpha);
+
+    int iIndex = 0;
+    for ( ; iIndex + 8 <= iCount; iIndex += 8)
+    {
+        __m256 vY = _mm256_sub_ps( _mm256_loadu_ps(afY + iIndex),
+                                   _mm256_mul_ps( vAlpha, _mm256_loadu_ps(afX + iIndex) ) );
+        _mm256_storeu_ps(afY + iIndex, vY);
+    }
+
+    for ( ; iIndex < iCount; iIndex++)
+        afY[iIndex] -= fAlpha * afX[iIndex];
+}
+
+//***************************************************************************
+//*
+//* AVX-512 Kernels
+//*     One 8 lane register holds all lanes.
+//*
+//***************************************************************************
+
+__attribute__((target("avx512f")))
+static double dotAVX512(const double * adA, const double * adB, const double * adC, int iCount)
+{
+    __m512d vSum = _mm512_setzero_pd();
+
+    int iIndex = 0;
+    for ( ; iIndex + StiffnessKernel::siLanes <= iCount; iIndex += StiffnessKernel::siLanes)
+    {
+        __m512d vTerm = _mm512_mul_pd( _mm512_mul_pd( _mm512_loadu_pd(adA + iIndex),
+                                                      _mm512_loadu_pd(adB + iIndex) ),
+                                       _mm512_loadu_pd(adC + iIndex) );
+        vSum = _mm512_add_pd(vSum, vTerm);
+    }
+
+    // The halves are extracted over zeroed lanes, so no lane is left undefined...
+    __m256d vLow = _mm512_mask_extractf64x4_pd( _mm256_setzero_pd(), 0x0F, vSum, 0 );
+    __m256d vHigh = _mm512_mask_extractf64x4_pd( _mm256_setzero_pd(), 0x0F, vSum, 1 );
+    __m256d vHalf = _mm256_add_pd(vLow, vHigh);
+    __m128d vQuarter = _mm_add_pd( _mm256_castpd256_pd128(vHalf), _mm256_extractf128_pd(vHalf, 1) );
+    double dSum = _mm_cvtsd_f64(vQuarter) + _mm_cvtsd_f64( _mm_unpackhi_pd(vQuarter, vQuarter) );
+
+    for ( ; iIndex < iCount; iIndex++)
+        dSum += adA[iIndex] * adB[iIndex] * adC[iIndex];
+
+    return dSum;
+}
+
+__attribute__((target("avx512f")))
+static void axpyAVX512(double * adY, const double * adX, double dAlpha, int iCount)
+{
+    __m512d vAlpha = _mm512_set1_pd(dAlpha);
+
+    int iIndex = 0;
+    for ( ; iIndex + 8 <= iCount; iIndex += 8)
+    {
+        __m512d vY = _mm512_sub_pd( _mm512_loadu_pd(adY + iIndex),
+                                    _mm512_mul_pd( vAlpha, _mm512_loadu_pd(adX + iIndex) ) );
+        _mm512_storeu_pd(adY + iIndex, vY);
+    }
+
+    for ( ; iIndex < iCount; iIndex++)
+        adY[iIndex] -= dAlpha * adX[iIndex];
+}
+
+#endif /* CAPS_KERNEL_X86 */
+
+//***************************************************************************
+//*
+//* StiffnessKernel::select
+//*     This function selects the kernels for the best instruction set
+//*     supported by the running CPU.
+//*
+//***************************************************************************
+
+void StiffnessKernel::select(void)
+{
+    StiffnessKernel::selectScalar();
+
+#ifdef CAPS_KERNEL_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") )
+    {
+        StiffnessKernel::fnDot = dotAVX512;
+        StiffnessKernel::fnAxpy = axpyAVX512;
+        StiffnessKernel::fnDotFloat = dotFloatAVX2;
+        StiffnessKernel::fnAxpyFloat = axpyFloatAVX2;
+        StiffnessKernel::strName = "AVX-512";
+    }
+    else if ( __builtin_cpu_supports("avx2") )
+    {
+        StiffnessKernel::fnDot = dotAVX2;
+        StiffnessKernel::fnAxpy = axpyAVX2;
+        StiffnessKernel::fnDotFloat = dotFloatAVX2;
+        StiffnessKernel::fnAxpyFloat = axpyFloatAVX2;
+        StiffnessKernel::strName = "AVX2";
+    }
+#endif
+}
+
+//*
+//* End of StiffnessKernel::select
+//***************************************************************************
+
+void StiffnessKernel::selectScalar(void)
+{
+    StiffnessKernel::fnDot = StiffnessKernel::dotScalar;
+    StiffnessKernel::fnAxpy = StiffnessKernel::axpyScalar;
+    StiffnessKernel::fnDotFloat = StiffnessKernel::dotScalar;
+    StiffnessKernel::fnAxpyFloat = StiffnessKernel::axpyScalar;
+    StiffnessKernel::strName = "Scalar";
+}
+
+const char * StiffnessKernel::getName(void)
+{
+    return StiffnessKernel::strName;
+}
+
+double StiffnessKernel::dot(const double * adA, const double * adB, const double * adC, int iCount)
+{
+    return StiffnessKernel::fnDot(adA, adB, adC, iCount);
+}
+
+void StiffnessKernel::axpy(double * adY, const double * adX, double dAlpha, int iCount)
+{
+    StiffnessKernel::fnAxpy(adY, adX, dAlpha, iCount);
+}
+
+float StiffnessKernel::dot(const float * afA, const float * afB, const float * afC, int iCount)
+{
+    return StiffnessKernel::fnDotFloat(afA, afB, afC, iCount);
+}
+
+void StiffnessKernel::axpy(float * afY, const float * afX, float fAlpha, int iCount)
+{
+    StiffnessKernel::fnAxpyFloat(afY, afX, fAlpha, iCount);
+}
+
+// Select the kernels once at start up...
+[[maybe_unused]] static const bool bKernelSelected = ( StiffnessKernel::select(), true );
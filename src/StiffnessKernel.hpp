@@ -0,0 +1,55 @@
+/*
+ * StiffnessKernel.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#ifndef STIFFNESSKERNEL_HPP_
+#define STIFFNESSKERNEL_HPP_
+
+// System Stiffness Matrix streaming kernels...
+//
+//   The kernels are selected at run time for the best instruction set the
+//   CPU supports (AVX-512, AVX2 or Scalar).  Every kernel sums its terms in
+//   the same fixed 8 lane order and never fuses multiplies into adds, so all
+//   kernels give identical results on every CPU.  The single precision
+//   kernels (for a Mixed Precision factor) use one 8 lane AVX2 register on
+//   both vector instruction sets.
+
+class StiffnessKernel
+{
+public:
+    static const short int siLanes = 8;     // Fixed summation lanes
+
+    // Sum of A[i] * B[i] * C[i]...
+    static double dot(const double *, const double *, const double *, int);
+    // Y[i] -= Alpha * X[i]...
+    static void axpy(double *, const double *, double, int);
+    // Single precision...
+    static float dot(const float *, const float *, const float *, int);
+    static void axpy(float *, const float *, float, int);
+
+    static void select(void);
+    static void selectScalar(void);
+    static const char * getName(void);
+
+    static double dotScalar(const double *, const double *, const double *, int);
+    static void axpyScalar(double *, const double *, double, int);
+    static float dotScalar(const float *, const float *, const float *, int);
+    static void axpyScalar(float *, const float *, float, int);
+
+private:
+    typedef double (* Dot)(const double *, const double *, const double *, int);
+    typedef void (* Axpy)(double *, const double *, double, int);
+    typedef float (* DotFloat)(const float *, const float *, const float *, int);
+    typedef void (* AxpyFloat)(float *, const float *, float, int);
+
+    static Dot fnDot;
+    static Axpy fnAxpy;
+    static DotFloat fnDotFloat;
+    static AxpyFloat fnAxpyFloat;
+    static const char * strName;
+};
+
+#endif /* STIFFNESSKERNEL_HPP_ */
@@ -7,16 +7,38 @@
 
 #include "StiffnessMatrix.hpp"
 #include "Member.hpp"
+#include "StiffnessKernel.hpp"
 
 #include "SystemDef.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
+#include <new>
 #include <fmt/format.h>
+#include <thread>
+#include <vector>
 
 StiffnessMatrix::StiffnessMatrix(void)
 {
     this->adLocation = nullptr;
     this->adDiagonal = nullptr;
+    this->adPivotInverse = nullptr;
+    this->adPivot = nullptr;
+    this->auiDiagonalPos = nullptr;
+    this->auiColumnTop = nullptr;
+    this->aiSkyline = nullptr;
+    this->aiRowEnd = nullptr;
+    this->sparse = nullptr;
+    this->pcg = nullptr;
+    this->afLocation = nullptr;
+    this->afPivotInverse = nullptr;
+    this->siThreads = 1;
+    this->cSolver = StiffnessMatrix::cSolverSkyline;
+    this->cKernel = StiffnessMatrix::cKernelLegacy;
+    this->dTolerance = 1.0E-12;
+    this->bCached = false;
     this->clear();
 }
 
@@ -27,6 +49,18 @@ StiffnessMatrix::~StiffnessMatrix(void)
 
 void StiffnessMatrix::clear(void)
 {
+    // A cached factor belongs to the cache's mapping...
+    if (this->bCached)
+    {
+        this->adLocation = nullptr;
+        this->adPivotInverse = nullptr;
+    }
+    this->cache.clear();
+    this->uiCacheKey = 0;
+    this->vectCacheSequence.clear();
+    this->bCacheSave = false;
+    this->bCached = false;
+
     if (this->adLocation != nullptr)
         delete this->adLocation;
     this->adLocation = nullptr;
@@ -35,12 +69,104 @@ void StiffnessMatrix::clear(void)
         delete this->adDiagonal;
     this->adDiagonal = nullptr;
 
+    if (this->adPivotInverse != nullptr)
+        delete [] this->adPivotInverse;
+    this->adPivotInverse = nullptr;
+
+    if (this->adPivot != nullptr)
+        delete [] this->adPivot;
+    this->adPivot = nullptr;
+
+    if (this->auiDiagonalPos != nullptr)
+        delete [] this->auiDiagonalPos;
+    this->auiDiagonalPos = nullptr;
+
+    if (this->auiColumnTop != nullptr)
+        delete [] this->auiColumnTop;
+    this->auiColumnTop = nullptr;
+
+    if (this->aiSkyline != nullptr)
+        delete [] this->aiSkyline;
+    this->aiSkyline = nullptr;
+
+    if (this->aiRowEnd != nullptr)
+        delete [] this->aiRowEnd;
+    this->aiRowEnd = nullptr;
+
+    if (this->sparse != nullptr)
+        delete this->sparse;
+    this->sparse = nullptr;
+
+    if (this->pcg != nullptr)
+        delete this->pcg;
+    this->pcg = nullptr;
+
+    this->clearMixed();
+    this->bMixedFallback = false;
+    this->vectCaseSteps.clear();
+    this->vectCaseResidual.clear();
+    this->iUpdates = 0;
+    this->iUpdateRanks = 0;
+
     this->uiArraySize = 0;
-    this->siMatrixSize = 0;
-    this->siBandwidth = 0;
-    this->siCut = 0;
+    this->uiBandSize = 0;
+    this->iMatrixSize = 0;
+    this->iBandwidth = 0;
+    this->iCut = 0;
+    this->iSystemSize = 0;
+
+    for (Substructure * subCurr : this->vectSubstructures)
+        delete subCurr;
+    this->vectSubstructures.clear();
+    this->setCondensed.clear();
+}
+
+//***************************************************************************
+//*
+//* StiffnessMatrix::addPanel
+//*     This function adds a Panel of the given Members to condense when
+//*     the SSM is created.  The Panel's Interior Nodes must be marked and
+//*     all of its Nodes indexed.  An identical Panel shares the condensed
+//*     Substructure of the first.
+//*
+//*     Only the Skyline solvers condense Panels.
+//*
+//***************************************************************************
+
+bool StiffnessMatrix::addPanel(std::vector<Member *> & members)
+{
+    for (Substructure * subCurr : this->vectSubstructures)
+    {
+        if ( subCurr->matches(members) )
+        {
+            subCurr->addPanel(members);
+            this->setCondensed.insert( members.begin(), members.end() );
+            return true;
+        }
+    }
+
+    Substructure * subNew = new Substructure;
+    if (subNew == nullptr)
+    {
+        std::cerr << "\n ERROR: OUT OF MEMORY!\n"
+                  <<   "        Substructure for Panel!\n";
+        return false;
+    }
+    if ( ! subNew->create(members) )
+    {
+        delete subNew;
+        return false;
+    }
+    this->vectSubstructures.push_back(subNew);
+    this->setCondensed.insert( members.begin(), members.end() );
+
+    return true;
 }
 
+//*
+//* End of StiffnessMatrix::addPanel
+//***************************************************************************
+
 //***************************************************************************
 //*
 //* StiffnessMatrix::create
@@ -48,17 +174,65 @@ void StiffnessMatrix::clear(void)
 //*     its matrix size and upper bandwidth.  It populates the matrix with
 //*     the structure's given members.
 //*
+//*     The SSM is stored in Skyline (Profile) form: each column of the
+//*     upper triangle only keeps the entries from its first nonzero row
+//*     down to the diagonal.  The Banded Matrix size is still calculated
+//*     for reporting as the profile never exceeds the band.
+//*
+//*     For the Sparse solver, the SSM is stored directly into the blocks
+//*     of the Sparse factor instead.  For the PCG solvers, it is stored in
+//*     compressed rows.  The Skyline is still found to report its size.
+//*
+//*     When a cached factor was opened and agrees with the Skyline, the
+//*     factor is used from the cache and only the diagonal is loaded.
+//*
+//*     The Members of condensed Panels are only loaded into the diagonal.
+//*     Each Panel's condensed Boundary stiffness is stored instead, and
+//*     the SSM only holds the equations ahead of the Panel Interiors.
+//*
 //***************************************************************************
 
-bool StiffnessMatrix::create(short int siNewMatrixSize, short int siNewBandwidth, std::vector<Member *> & members)
+bool StiffnessMatrix::create(int iNewMatrixSize, int iNewBandwidth, std::vector<Member *> & members)
 {
     //************************************************************
     //* Set up the System Stiffness Matrix...
     //************************************************************
 
-    this->siMatrixSize = siNewMatrixSize;
-    this->siBandwidth = siNewBandwidth;
-    this->siCut = this->siMatrixSize - this->siBandwidth;
+    // Condensed Panel Interior equations follow the SSM equations...
+    this->iSystemSize = iNewMatrixSize;
+    this->iMatrixSize = iNewMatrixSize;
+    for (Substructure * subCurr : this->vectSubstructures)
+        this->iMatrixSize -= subCurr->getInterior() * (int) subCurr->vectPanels.size();
+    for (Substructure * subCurr : this->vectSubstructures)
+    {
+        for (Substructure::Panel & panelCurr : subCurr->vectPanels)
+        {
+            for (int iEquation : panelCurr.vectInterior)
+            {
+                if (iEquation < this->iMatrixSize)
+                {
+                    std::cerr << "\n ERROR: Panel Interior equations must follow the\n"
+                              <<   "        System Stiffness Matrix equations!\n";
+                    this->clear();
+                    return false;
+                }
+            }
+        }
+    }
+
+    // Find the Skyline (Profile) of the SSM...
+    if ( ! this->createSkyline(members) )
+        return false;
+
+    // The condensed SSM's bandwidth is found from its Skyline...
+    this->iBandwidth = iNewBandwidth;
+    if ( ! this->vectSubstructures.empty() )
+    {
+        this->iBandwidth = 0;
+        for (int iCol = 0; iCol < this->iMatrixSize; iCol++)
+            this->iBandwidth = std::max( this->iBandwidth, iCol - this->aiSkyline[iCol] + 1 );
+    }
+    this->iCut = this->iMatrixSize - this->iBandwidth;
 
     // Original Formula:
     // ArraySize = Bandwidth * Cut + ( Bandwidth ^ 2 + Bandwidth ) / 2
@@ -90,35 +264,108 @@ bool StiffnessMatrix::create(short int siNewMatrixSize, short int siNewBandwidth
     // If M even, B odd,  then C odd  => O * ( E + O + 1 ) = O * ( O + 1 ) = O * E = E
     // If M even, B even, then C even => E * ( E + E + 1 ) = E * ( E + 1 ) = E * O = E
 
-    this->uiArraySize = ( (unsigned int) this->siBandwidth *
-                          (unsigned int) ( this->siMatrixSize + this->siCut + 1 )
-                        ) / 2;
+    //
+    // The sizes are calculated in std::size_t and checked before use so a
+    // large structure fails cleanly instead of wrapping to a small array.
+
+    std::size_t uiBandFactor = (std::size_t) this->iMatrixSize + (std::size_t) this->iCut + 1;
+    if ( this->iBandwidth > 0 &&
+         uiBandFactor > std::numeric_limits<std::size_t>::max() / (std::size_t) this->iBandwidth )
+    {
+        std::cerr << "\n ERROR: OUT OF MEMORY!\n"
+                  <<   "        System Stiffness Matrix size overflows!\n"
+                  <<   "        Matrix Side = " << this->iMatrixSize << ",\n"
+                  <<   "          Bandwidth = " << this->iBandwidth  << "\n";
+        this->clear();
+        return false;
+    }
+    this->uiBandSize = ( (std::size_t) this->iBandwidth * uiBandFactor ) / 2;
 
     // DEBUG: Band Matrix Integer Math...
     // ----------------------------------------
-    //unsigned int uiArrayTest = ( (unsigned int) ( this->siCut + this->siMatrixSize + 1 ) / 2 ) *
-    //                           (unsigned int) this->siBandwidth;
+    //unsigned int uiArrayTest = ( (unsigned int) ( this->iCut + this->iMatrixSize + 1 ) / 2 ) *
+    //                           (unsigned int) this->iBandwidth;
     //std::cerr << "\n DEBUG: BAND MATRIX INTEGER MATH!\n"
-    //          <<   "        Matrix Side = " << this->siMatrixSize << ",\n"
-    //          <<   "          Bandwidth = " << this->siBandwidth  << ",\n"
-    //          <<   "                Cut = " << this->siCut        << ",\n"
-    //          <<   "         Array Size = " << this->uiArraySize  << ",\n"
+    //          <<   "        Matrix Side = " << this->iMatrixSize << ",\n"
+    //          <<   "          Bandwidth = " << this->iBandwidth  << ",\n"
+    //          <<   "                Cut = " << this->iCut        << ",\n"
+    //          <<   "         Array Size = " << this->uiBandSize   << ",\n"
     //          <<   "         Array Test = " << uiArrayTest        << "\n";
     // ----------------------------------------
 
+    // Allocate SSM Diagonal Array (all System equations) and clear to 0...
+    this->adDiagonal = new (std::nothrow) double[this->iSystemSize]();
+    if (this->adDiagonal == nullptr)
+    {
+        std::cerr << "\n ERROR: OUT OF MEMORY!\n"
+                  <<   "        Diagonal too large!\n"
+                  <<   "        Diagonal = System Side = " << this->iSystemSize << "\n";
+        this->clear();
+        return false;
+    }
+
+    if (this->cSolver == StiffnessMatrix::cSolverSparse)
+    {
+        // Order and find the structure of the Sparse factor...
+        this->sparse = new SparseCholesky;
+        if ( this->sparse == nullptr || ! this->sparse->analyze(this->iMatrixSize, members) )
+        {
+            std::cerr << "\n ERROR: OUT OF MEMORY!\n"
+                      <<   "        Sparse System Stiffness Matrix too large!\n"
+                      <<   "        Matrix Side = " << this->iMatrixSize << "\n";
+            this->clear();
+            return false;
+        }
+    }
+    else if ( this->cSolver == StiffnessMatrix::cSolverPCGJacobi ||
+              this->cSolver == StiffnessMatrix::cSolverPCGIC )
+    {
+        // Find the structure of the compressed rows...
+        this->pcg = new ConjugateGradient;
+        if ( this->pcg == nullptr || ! this->pcg->analyze(this->iMatrixSize, members) )
+        {
+            std::cerr << "\n ERROR: OUT OF MEMORY!\n"
+                      <<   "        Compressed System Stiffness Matrix too large!\n"
+                      <<   "        Matrix Side = " << this->iMatrixSize << "\n";
+            this->clear();
+            return false;
+        }
+        this->pcg->setPreconditioner( (this->cSolver == StiffnessMatrix::cSolverPCGJacobi) ?
+                                        ConjugateGradient::cPrecondJacobi : ConjugateGradient::cPrecondIC );
+        this->pcg->setTolerance(this->dTolerance);
+    }
+    else if ( this->cache.isOpen() &&
+              this->cache.getMatrixSize() == this->iMatrixSize &&
+              this->cache.getBandwidth() == this->iBandwidth &&
+              this->cache.getArraySize() == this->uiArraySize )
+    {
+        // Use the cached factor in place...
+        delete [] this->adPivotInverse;
+        this->adLocation = const_cast<double *>( this->cache.getLocation() );
+        this->adPivotInverse = const_cast<double *>( this->cache.getPivotInverse() );
+        this->bCached = true;
+        for (int iCol = 0; iCol < this->iMatrixSize; iCol++)
+            this->adPivot[iCol] = this->adLocation[ this->auiDiagonalPos[iCol] ];
+    }
+    else
+    {
+    // ...a cached factor of another Skyline is not used...
+    this->cache.clear();
+
     // Allocate SSM Location Array and clear to 0...
-    this->adLocation = new double[this->uiArraySize]();
+    this->adLocation = new (std::nothrow) double[this->uiArraySize]();
     if (this->adLocation == nullptr)
     {
         std::cerr << "\n ERROR: OUT OF MEMORY!\n"
                   <<   "        System Stiffness Matrix too large!\n"
-                  <<   "        Matrix Side = " << this->siMatrixSize << ",\n"
-                  <<   "          Bandwidth = " << this->siBandwidth  << ",\n"
-                  <<   "                Cut = " << this->siCut        << ",\n"
-                  <<   "         Array Size = " << this->uiArraySize  << "\n";
+                  <<   "        Matrix Side = " << this->iMatrixSize << ",\n"
+                  <<   "          Bandwidth = " << this->iBandwidth  << ",\n"
+                  <<   "                Cut = " << this->iCut        << ",\n"
+                  <<   "       Profile Size = " << this->uiArraySize  << "\n";
         this->clear();
         return false;
     }
+    }
 
     //************************************************************
     //* Load the System Stiffness Matrix...
@@ -126,114 +373,159 @@ bool StiffnessMatrix::create(short int siNewMatrixSize, short int siNewBandwidth
 
     for (Member * memberCurr : members)
     {
-        double adSSM_Local[6][6];
-
-        // Calculate the Local Member Stiffness Matrix...
-        memberCurr->calcStiffnessMatrix(adSSM_Local);
-
-        //*
-        //* Set up Local to Global Matrix Conversion values...
-        //************************************************************
-
-        double adSSM_LocalToGlobal[6][6];
-        for (short int siIndex = 0; siIndex < 6; siIndex++)
-        {
-            adSSM_LocalToGlobal[siIndex][0] = adSSM_Local[siIndex][0] * memberCurr->adNodeVectorNeg[X] -
-                                              adSSM_Local[siIndex][1] * memberCurr->adNodeVectorNeg[Y];
-            adSSM_LocalToGlobal[siIndex][1] = adSSM_Local[siIndex][0] * memberCurr->adNodeVectorNeg[Y] +
-                                              adSSM_Local[siIndex][1] * memberCurr->adNodeVectorNeg[X];
-            adSSM_LocalToGlobal[siIndex][2] = adSSM_Local[siIndex][2];
-            adSSM_LocalToGlobal[siIndex][3] = adSSM_Local[siIndex][3] * memberCurr->adNodeVectorPos[X] -
-                                              adSSM_Local[siIndex][4] * memberCurr->adNodeVectorPos[Y];
-            adSSM_LocalToGlobal[siIndex][4] = adSSM_Local[siIndex][3] * memberCurr->adNodeVectorPos[Y] +
-                                              adSSM_Local[siIndex][4] * memberCurr->adNodeVectorPos[X];
-            adSSM_LocalToGlobal[siIndex][5] = adSSM_Local[siIndex][5];
-        }
-
         double adSSM_Global[6][6];
-        for (short int siIndex = 0; siIndex < 6; siIndex++)
-        {
-            adSSM_Global[0][siIndex] = adSSM_LocalToGlobal[0][siIndex] * memberCurr->adNodeVectorNeg[X] -
-                                       adSSM_LocalToGlobal[1][siIndex] * memberCurr->adNodeVectorNeg[Y];
-            adSSM_Global[1][siIndex] = adSSM_LocalToGlobal[0][siIndex] * memberCurr->adNodeVectorNeg[Y] +
-                                       adSSM_LocalToGlobal[1][siIndex] * memberCurr->adNodeVectorNeg[X];
-            adSSM_Global[2][siIndex] = adSSM_LocalToGlobal[2][siIndex];
-            adSSM_Global[3][siIndex] = adSSM_LocalToGlobal[3][siIndex] * memberCurr->adNodeVectorPos[X] -
-                                       adSSM_LocalToGlobal[4][siIndex] * memberCurr->adNodeVectorPos[Y];
-            adSSM_Global[4][siIndex] = adSSM_LocalToGlobal[3][siIndex] * memberCurr->adNodeVectorPos[Y] +
-                                       adSSM_LocalToGlobal[4][siIndex] * memberCurr->adNodeVectorPos[X];
-            adSSM_Global[5][siIndex] = adSSM_LocalToGlobal[5][siIndex];
-        }
+        this->calcGlobalStiffness(memberCurr, adSSM_Global);
 
         //*
         //* Store Global Member Stiffness Matrix into System Stiffness Matrix...
         //************************************************************
 
-        short int asiPositionIndex[6];
-        asiPositionIndex[0] = memberCurr->nodeNeg->siHorzFlag;
-        asiPositionIndex[1] = memberCurr->nodeNeg->siVertFlag;
-        asiPositionIndex[2] = memberCurr->nodeNeg->siRotFlag;
-        asiPositionIndex[3] = memberCurr->nodePos->siHorzFlag;
-        asiPositionIndex[4] = memberCurr->nodePos->siVertFlag;
-        asiPositionIndex[5] = memberCurr->nodePos->siRotFlag;
+        int aiPositionIndex[6];
+        aiPositionIndex[0] = memberCurr->nodeNeg->iHorzFlag;
+        aiPositionIndex[1] = memberCurr->nodeNeg->iVertFlag;
+        aiPositionIndex[2] = memberCurr->nodeNeg->iRotFlag;
+        aiPositionIndex[3] = memberCurr->nodePos->iHorzFlag;
+        aiPositionIndex[4] = memberCurr->nodePos->iVertFlag;
+        aiPositionIndex[5] = memberCurr->nodePos->iRotFlag;
 
         for (short int siIndex1 = 0; siIndex1 < 6; siIndex1++)
         {
-            if (asiPositionIndex[siIndex1]) // ...element is FREE...
+            if (aiPositionIndex[siIndex1]) // ...element is FREE...
             {
                 for (short int siIndex2 = siIndex1; siIndex2 < 6; siIndex2++)
                 {
-                    if (asiPositionIndex[siIndex2]) // ...element is FREE...
+                    if (aiPositionIndex[siIndex2]) // ...element is FREE...
                     {
-                        // ...set matrix position...
-                        unsigned int siPosition =
-                                this->position( asiPositionIndex[siIndex1] - 1,
-                                                asiPositionIndex[siIndex2] - 1 );
-                        // ...set matrix position value to selected SSM Global value...
-                        this->adLocation[siPosition] += adSSM_Global[siIndex1][siIndex2];
+                        if (this->sparse != nullptr)
+                        {
+                            // ...add SSM Global value to the Sparse factor's position...
+                            this->sparse->add( aiPositionIndex[siIndex1] - 1,
+                                               aiPositionIndex[siIndex2] - 1,
+                                               adSSM_Global[siIndex1][siIndex2] );
+                        }
+                        else if (this->pcg != nullptr)
+                        {
+                            // ...add SSM Global value to the compressed row position...
+                            this->pcg->add( aiPositionIndex[siIndex1] - 1,
+                                            aiPositionIndex[siIndex2] - 1,
+                                            adSSM_Global[siIndex1][siIndex2] );
+                        }
+                        else if ( ! this->bCached && ! this->setCondensed.count(memberCurr) )
+                        {
+                            // ...set matrix position...
+                            std::size_t uiPosition =
+                                    this->position( aiPositionIndex[siIndex1] - 1,
+                                                    aiPositionIndex[siIndex2] - 1 );
+                            // ...set matrix position value to selected SSM Global value...
+                            this->adLocation[uiPosition] += adSSM_Global[siIndex1][siIndex2];
+                        }
+
+                        // ...store System Stiffness Matrix Diagonal for use
+                        //    in Column Calculations...
+                        if (aiPositionIndex[siIndex1] == aiPositionIndex[siIndex2])
+                            this->adDiagonal[ aiPositionIndex[siIndex1] - 1 ] += adSSM_Global[siIndex1][siIndex2];
                     }
                 }
             }
         }
     }
 
-    //************************************************************
-    //* Store System Stiffness Matrix Diagonal for use in Column
-    //* Calculations...
+    // Store each condensed Panel's Boundary stiffness...
+    for (Substructure * subCurr : this->vectSubstructures)
+    {
+        int iBoundary = subCurr->getBoundary();
+        const double * adCondensed = subCurr->getCondensed();
+        for (Substructure::Panel & panelCurr : subCurr->vectPanels)
+        {
+            for (int iBound1 = 0; iBound1 < iBoundary; iBound1++)
+            {
+                int iRow = panelCurr.vectBoundary[iBound1];
+                if (iRow < 0) // ...element is FIXED...
+                    continue;
+                for (int iBound2 = 0; iBound2 < iBoundary; iBound2++)
+                {
+                    int iCol = panelCurr.vectBoundary[iBound2];
+                    if (iCol >= iRow) // ...element is FREE and in the upper triangle...
+                        this->adLocation[ this->position(iRow, iCol) ] +=
+                                adCondensed[ (std::size_t) iBound1 * iBoundary + iBound2 ];
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+//*
+//* End of StiffnessMatrix::create
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* StiffnessMatrix::calcGlobalStiffness
+//*     This function calculates the given member's stiffness matrix in
+//*     global coordinates from its current Member Property.
+//*
+//***************************************************************************
+
+void StiffnessMatrix::calcGlobalStiffness(Member * member, double adSSM_Global[6][6])
+{
+    double adSSM_Local[6][6];
+
+    // Calculate the Local Member Stiffness Matrix...
+    member->calcStiffnessMatrix(adSSM_Local);
+
+    //*
+    //* Set up Local to Global Matrix Conversion values...
     //************************************************************
 
-    // Allocate SSM Diagonal Array and clear to 0...
-    double * adDiagonalNew = new double[siNewMatrixSize]();
-    if (adDiagonalNew == nullptr)
+    double adSSM_LocalToGlobal[6][6];
+    for (short int siIndex = 0; siIndex < 6; siIndex++)
     {
-        std::cerr << "\n ERROR: OUT OF MEMORY!\n"
-                  <<   "        Diagonal too large!\n"
-                  <<   "        Diagonal = Matrix Side = " << this->siMatrixSize << "\n";
-        this->clear();
-        return false;
+        adSSM_LocalToGlobal[siIndex][0] = adSSM_Local[siIndex][0] * member->adNodeVectorNeg[X] -
+                                          adSSM_Local[siIndex][1] * member->adNodeVectorNeg[Y];
+        adSSM_LocalToGlobal[siIndex][1] = adSSM_Local[siIndex][0] * member->adNodeVectorNeg[Y] +
+                                          adSSM_Local[siIndex][1] * member->adNodeVectorNeg[X];
+        adSSM_LocalToGlobal[siIndex][2] = adSSM_Local[siIndex][2];
+        adSSM_LocalToGlobal[siIndex][3] = adSSM_Local[siIndex][3] * member->adNodeVectorPos[X] -
+                                          adSSM_Local[siIndex][4] * member->adNodeVectorPos[Y];
+        adSSM_LocalToGlobal[siIndex][4] = adSSM_Local[siIndex][3] * member->adNodeVectorPos[Y] +
+                                          adSSM_Local[siIndex][4] * member->adNodeVectorPos[X];
+        adSSM_LocalToGlobal[siIndex][5] = adSSM_Local[siIndex][5];
     }
-    // Copy SSM Location Array's diagonal to SSM Diagonal Array...
-    for (short int siIndex = 0; siIndex < siNewMatrixSize; siIndex++)
+
+    for (short int siIndex = 0; siIndex < 6; siIndex++)
     {
-        adDiagonalNew[siIndex] = this->adLocation[ this->position(siIndex, siIndex) ];
+        adSSM_Global[0][siIndex] = adSSM_LocalToGlobal[0][siIndex] * member->adNodeVectorNeg[X] -
+                                   adSSM_LocalToGlobal[1][siIndex] * member->adNodeVectorNeg[Y];
+        adSSM_Global[1][siIndex] = adSSM_LocalToGlobal[0][siIndex] * member->adNodeVectorNeg[Y] +
+                                   adSSM_LocalToGlobal[1][siIndex] * member->adNodeVectorNeg[X];
+        adSSM_Global[2][siIndex] = adSSM_LocalToGlobal[2][siIndex];
+        adSSM_Global[3][siIndex] = adSSM_LocalToGlobal[3][siIndex] * member->adNodeVectorPos[X] -
+                                   adSSM_LocalToGlobal[4][siIndex] * member->adNodeVectorPos[Y];
+        adSSM_Global[4][siIndex] = adSSM_LocalToGlobal[3][siIndex] * member->adNodeVectorPos[Y] +
+                                   adSSM_LocalToGlobal[4][siIndex] * member->adNodeVectorPos[X];
+        adSSM_Global[5][siIndex] = adSSM_LocalToGlobal[5][siIndex];
     }
-    this->adDiagonal = adDiagonalNew;
-
-    return true;
 }
 
 //*
-//* End of StiffnessMatrix::create
+//* End of StiffnessMatrix::calcGlobalStiffness
 //***************************************************************************
 
-short int StiffnessMatrix::getMatrixSize(void)
+int StiffnessMatrix::getSystemSize(void)
+{
+    return this->iSystemSize;
+}
+
+int StiffnessMatrix::getMatrixSize(void)
 {
-    return this->siMatrixSize;
+    return this->iMatrixSize;
 }
 
-short int StiffnessMatrix::getBandwidth(void)
+int StiffnessMatrix::getBandwidth(void)
 {
-    return this->siBandwidth;
+    return this->iBandwidth;
 }
 
 double * StiffnessMatrix::getDiagonal(void)
@@ -243,163 +535,1348 @@ double * StiffnessMatrix::getDiagonal(void)
 
 //***************************************************************************
 //*
-//* StiffnessMatrix::position
-//*     This function calculates the position in the linear array representing
-//*     matrix array given a row and column. Since the matrix is
-//*     symmetric and only the upper half of the matrix is stored,
-//*     the row and column are switched if the column is less than
-//*     the row.
+//* StiffnessMatrix::createSkyline
+//*     This function finds the Skyline (Profile) of the System Stiffness
+//*     Matrix from the given members.  The Skyline of a column is the first
+//*     row holding a nonzero entry.  As the Skyline is preserved by the
+//*     decomposition, no fill-in occurs outside of it.
+//*
+//*     Each column is stored contiguously from its Skyline row down to
+//*     its diagonal.  The first entry and diagonal positions of each column
+//*     are kept so the decomposition and solution can stream down columns
+//*     without calculating positions.
 //*
 //***************************************************************************
 
-unsigned int StiffnessMatrix::position(short int siRow, short int siCol)
+bool StiffnessMatrix::createSkyline(std::vector<Member *> & members)
 {
-    // Upper Band Matrix = Condensed Band Array = Bandwidth * ( 2 * Matrix Size - Bandwidth - 1) / 2
-    // x x x x 0 0 0 0 0     x x x x
-    // 0 x x x x 0 0 0 0     x x x x
-    // 0 0 x x x x 0 0 0     x x x x
-    // 0 0 0 x x x x 0 0  =  x x x x
-    // 0 0 0 0 x x x x 0     x x x x
-    // 0 0 0 0 0 x x x x     x x x x
-    // 0 0 0 0 0 0 x x x     x x x
-    // 0 0 0 0 0 0 0 x x     x x
-    // 0 0 0 0 0 0 0 0 x     x
+    this->aiSkyline = new (std::nothrow) int[this->iMatrixSize]();
+    this->auiColumnTop = new (std::nothrow) std::size_t[this->iMatrixSize]();
+    this->auiDiagonalPos = new (std::nothrow) std::size_t[this->iMatrixSize]();
+    this->adPivotInverse = new (std::nothrow) double[this->iMatrixSize]();
+    this->adPivot = new (std::nothrow) double[this->iMatrixSize]();
+    this->aiRowEnd = new (std::nothrow) int[this->iMatrixSize]();
+    if (this->aiSkyline == nullptr || this->auiColumnTop == nullptr ||
+        this->auiDiagonalPos == nullptr || this->adPivotInverse == nullptr ||
+        this->adPivot == nullptr || this->aiRowEnd == nullptr)
+    {
+        std::cerr << "\n ERROR: OUT OF MEMORY!\n"
+                  <<   "        System Stiffness Matrix Skyline too large!\n"
+                  <<   "        Matrix Side = " << this->iMatrixSize << "\n";
+        this->clear();
+        return false;
+    }
 
-    if (siCol < siRow)
-    {   // SWAP...
-        short int temp = siRow;
-        siRow = siCol;
-        siCol = temp;
+    // Each column starts at its diagonal...
+    for (int iCol = 0; iCol < this->iMatrixSize; iCol++)
+    {
+        this->aiSkyline[iCol] = iCol;
+        this->aiRowEnd[iCol] = iCol;
     }
 
-    unsigned int uiRowOffset;
-    //if (siRow > (this->siMatrixSize - this->siBandwidth))
-    if (siRow > this->siCut)
+    // Raise each column's Skyline to the lowest DoF index coupled to it...
+    for (Member * memberCurr : members)
     {
-        unsigned int uiRowLength = this->siMatrixSize - siRow;
-        uiRowOffset = this->uiArraySize - (uiRowLength * uiRowLength + uiRowLength) / 2;
+        if ( this->setCondensed.count(memberCurr) ) // ...coupled by its Panel...
+            continue;
+
+        int aiPositionIndex[6];
+        aiPositionIndex[0] = memberCurr->nodeNeg->iHorzFlag;
+        aiPositionIndex[1] = memberCurr->nodeNeg->iVertFlag;
+        aiPositionIndex[2] = memberCurr->nodeNeg->iRotFlag;
+        aiPositionIndex[3] = memberCurr->nodePos->iHorzFlag;
+        aiPositionIndex[4] = memberCurr->nodePos->iVertFlag;
+        aiPositionIndex[5] = memberCurr->nodePos->iRotFlag;
+
+        int iLow = this->iMatrixSize + 1;
+        for (short int siIndex = 0; siIndex < 6; siIndex++)
+        {
+            if (aiPositionIndex[siIndex] && aiPositionIndex[siIndex] < iLow) // ...element is FREE...
+                iLow = aiPositionIndex[siIndex];
+        }
+
+        for (short int siIndex = 0; siIndex < 6; siIndex++)
+        {
+            if (aiPositionIndex[siIndex]) // ...element is FREE...
+            {
+                int iCol = aiPositionIndex[siIndex] - 1;
+                if (this->aiSkyline[iCol] > iLow - 1)
+                    this->aiSkyline[iCol] = iLow - 1;
+            }
+        }
     }
-    else
+
+    // ...and to the lowest Boundary DoF index of each condensed Panel...
+    for (Substructure * subCurr : this->vectSubstructures)
+    {
+        for (Substructure::Panel & panelCurr : subCurr->vectPanels)
+        {
+            int iLow = this->iMatrixSize;
+            for (int iEquation : panelCurr.vectBoundary)
+            {
+                if (iEquation >= 0 && iEquation < iLow) // ...element is FREE...
+                    iLow = iEquation;
+            }
+            for (int iEquation : panelCurr.vectBoundary)
+            {
+                if (iEquation >= 0 && this->aiSkyline[iEquation] > iLow)
+                    this->aiSkyline[iEquation] = iLow;
+            }
+        }
+    }
+
+    // Set each column's first entry and diagonal positions and the last
+    // column reaching each row...
+    std::size_t uiPosition = 0;
+    std::size_t uiPositionLimit = std::numeric_limits<std::size_t>::max() / sizeof(double);
+    for (int iCol = 0; iCol < this->iMatrixSize; iCol++)
+    {
+        if ( (std::size_t) (iCol - this->aiSkyline[iCol]) >= uiPositionLimit - uiPosition )
+        {
+            std::cerr << "\n ERROR: OUT OF MEMORY!\n"
+                      <<   "        System Stiffness Matrix Skyline size overflows!\n"
+                      <<   "        Matrix Side = " << this->iMatrixSize << "\n";
+            this->clear();
+            return false;
+        }
+        this->auiColumnTop[iCol] = uiPosition;
+        uiPosition += iCol - this->aiSkyline[iCol];
+        this->auiDiagonalPos[iCol] = uiPosition++;
+
+        int iRow = this->aiSkyline[iCol];
+        if (this->aiRowEnd[iRow] < iCol)
+            this->aiRowEnd[iRow] = iCol;
+    }
+    for (int iRow = 1; iRow < this->iMatrixSize; iRow++)
     {
-        // uiRowLength = this->siBandwidth;
-        uiRowOffset = this->siBandwidth * siRow;
+        if (this->aiRowEnd[iRow] < this->aiRowEnd[iRow - 1])
+            this->aiRowEnd[iRow] = this->aiRowEnd[iRow - 1];
     }
+    this->uiArraySize = uiPosition;
 
-    // Position = Row Offset + Column Offset
-    return uiRowOffset + (siCol - siRow);
+    return true;
 }
 
 //*
-//* End of StiffnessMatrix::position
+//* End of StiffnessMatrix::createSkyline
 //***************************************************************************
 
 //***************************************************************************
 //*
-//* StiffnessMatrix::decompose
-//*     This function decomposes the structure's K Matrix into the
-//*     A Matrix.
+//* StiffnessMatrix::position
+//*     This function calculates the position in the linear array representing
+//*     matrix array given a row and column. Since the matrix is
+//*     symmetric and only the upper half of the matrix is stored,
+//*     the row and column are switched if the column is less than
+//*     the row.  The row must be on or below the column's Skyline.
 //*
 //***************************************************************************
 
-bool StiffnessMatrix::decompose()
+std::size_t StiffnessMatrix::position(int iRow, int iCol)
 {
-    unsigned int uiPos[4];
+    // Upper Skyline Matrix = Column Heights stored to each diagonal
+    // x x 0 x 0 0 0 0 0     x | x | x | x | x | x | x | x | x
+    // 0 x x x 0 0 0 0 0         x   x   x   x   x   x   x   x
+    // 0 0 x x x 0 0 x 0             x   x   x       x   x
+    // 0 0 0 x x 0 0 x 0  =              x   x       x
+    // 0 0 0 0 x x x x 0                             x
+    // 0 0 0 0 0 x x x x
+    // 0 0 0 0 0 0 x x x
+    // 0 0 0 0 0 0 0 x x
+    // 0 0 0 0 0 0 0 0 x
 
-    for (short int siRow2 = 0; siRow2 < (this->siMatrixSize - 1); siRow2++)
-    {
-        for (short int siRow1 = (siRow2 + 1); (siRow1 - siRow2) < this->siBandwidth && siRow1 < this->siMatrixSize; siRow1++)
-        {
-            for (short int siCol = siRow1; siCol < (this->siBandwidth + siRow2) && siCol < this->siMatrixSize; siCol++)
-            {
-                uiPos[0] = this->position(siRow1, siCol);
-                uiPos[1] = this->position(siRow2, siRow1);
-                uiPos[2] = this->position(siRow2, siCol);
-                uiPos[3] = this->position(siRow2, siRow2);
-                if (this->adLocation[uiPos[3]] != 0.0)
-                    this->adLocation[uiPos[0]] -= (this->adLocation[uiPos[1]] * this->adLocation[uiPos[2]] / adLocation[uiPos[3]]);
-                else
-                {
-                    std::cerr << "\n WARNING: Stiffness Matrix is SINGULAR!\n"
-                              <<   "          Unable to find solution for Plane Frame!\n";
-                    return false;
-                }
-            }
-        }
+    if (iCol < iRow)
+    {   // SWAP...
+        int temp = iRow;
+        iRow = iCol;
+        iCol = temp;
     }
 
-    return true;
+    // Position = Column Diagonal - Row Offset from Diagonal
+    return this->auiDiagonalPos[iCol] - (iCol - iRow);
 }
 
 //*
-//* End of StiffnessMatrix::decompose
+//* End of StiffnessMatrix::position
 //***************************************************************************
 
-std::string StiffnessMatrix::report()
+void StiffnessMatrix::setThreads(short int siNewThreads)
 {
-    std::string strFormat;
-    strFormat = strFormat +
-        "      Cut  Matrix    Band  |      Array    Band  Matrix     Cut\n" +
-        "     Size    Side    Size  |       Size    Size    Side    Size\n" +
-        "   ------  ------  ------  |  ---------  ------  ------  ------\n" +
-        "   {:6d} ={:6d} -{:6d}  |  {:9d} ={:6d} ({:6d} +{:6d} + 1 ) / 2\n";
-    return fmt::vformat(
-                strFormat,
-                fmt::make_format_args(
-                    this->siCut, this->siMatrixSize, this->siBandwidth,
-                    this->uiArraySize, this->siBandwidth, this->siMatrixSize, this->siCut
-                )
-            );
+    // 0 = use all hardware threads...
+    if (siNewThreads == 0)
+        siNewThreads = (short int) std::thread::hardware_concurrency();
+    if (siNewThreads < 1)
+        siNewThreads = 1;
+    this->siThreads = siNewThreads;
+}
+
+short int StiffnessMatrix::getThreads(void)
+{
+    return this->siThreads;
+}
+
+void StiffnessMatrix::setSolver(char cNewSolver)
+{
+    this->cSolver = cNewSolver;
+}
+
+char StiffnessMatrix::getSolver(void)
+{
+    return this->cSolver;
+}
+
+void StiffnessMatrix::setTolerance(double dNewTolerance)
+{
+    this->dTolerance = dNewTolerance;
+}
+
+double StiffnessMatrix::getTolerance(void)
+{
+    return this->dTolerance;
+}
+
+void StiffnessMatrix::setKernel(char cNewKernel)
+{
+    this->cKernel = cNewKernel;
+}
+
+char StiffnessMatrix::getKernel(void)
+{
+    return this->cKernel;
+}
+
+void StiffnessMatrix::setCacheDirectory(std::string strDirectory)
+{
+    this->cache.setDirectory(strDirectory);
+}
+
+std::string StiffnessMatrix::getCacheDirectory(void)
+{
+    return this->cache.getDirectory();
+}
+
+bool StiffnessMatrix::isCacheEnabled(void)
+{
+    return this->cache.isEnabled();
+}
+
+bool StiffnessMatrix::isCached(void)
+{
+    return this->bCached;
 }
 
 //***************************************************************************
 //*
-//* StiffnessMatrix::displacement
-//*     This function calculates the force displacements of the structure's
-//*     K Matrix into the A Matrix.
+//* StiffnessMatrix::openCache
+//*     This function opens the cached factor of the structure with the
+//*     given key and node count, returning the node sequence it was
+//*     factored with.  The factor is used by the next create() when the
+//*     Skyline agrees with it.  A clear() closes it.
 //*
 //***************************************************************************
 
-void StiffnessMatrix::calcDisplacement(double * adDisplace, double * adForce)
+bool StiffnessMatrix::openCache(std::uint64_t uiKey, int iNodes, std::vector<int> & vectSequence)
 {
-    // Decompose Force Matrix...
-
-    for (short int siRow = 0; siRow < (this->siMatrixSize - 1); siRow++)
-    {
-        short int siMaxCol = this->siBandwidth + siRow;
-        if (siMaxCol > this->siMatrixSize)
-            siMaxCol = this->siMatrixSize;
-        for (short int siCol = (siRow + 1); siCol < siMaxCol; siCol++)
-        {
-            unsigned int uiPos = this->position(siRow, siCol);
-            short int siDiagonal = this->position(siRow, siRow);
-            if (this->adLocation[siDiagonal] != 0.0)
-                adForce[siCol] -=
-                        (this->adLocation[uiPos] * adForce[siRow] /
-                                this->adLocation[siDiagonal]);
-        }
-    }
-
-    // Calculate System Displacements...
-
-    // Start with last diagonal value...
-    short int siRow = this->siMatrixSize - 1;
-    adDisplace[siRow] = adForce[siRow] /
-                        this->adLocation[ this->position(siRow, siRow) ];
-    for (siRow = (this->siMatrixSize - 2); siRow >= 0 ; siRow--)
-    {
-        short int siMaxCol = this->siBandwidth + siRow;
-        if (siMaxCol > this->siMatrixSize)
-            siMaxCol = this->siMatrixSize;
-        double dSum = 0.0;
-        for (short int siCol = (siRow + 1); siCol < siMaxCol; siCol++)
-        {
-            dSum += ( this->adLocation[ this->position(siRow, siCol) ] * adDisplace[siCol] );
-        }
-        adDisplace[siRow] = (adForce[siRow] - dSum) /
-                            this->adLocation[ this->position(siRow, siRow) ];
-    }
+    return this->cache.open(uiKey, iNodes, vectSequence);
 }
 
 //*
-//* End of StiffnessMatrix::displacement
+//* End of StiffnessMatrix::openCache
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* StiffnessMatrix::setCacheSequence
+//*     This function sets the structure key and node sequence to be saved
+//*     with the factor.  The factor is saved once it is decomposed.
+//*
+//***************************************************************************
+
+void StiffnessMatrix::setCacheSequence(std::uint64_t uiKey, std::vector<int> & vectSequence)
+{
+    this->uiCacheKey = uiKey;
+    this->vectCacheSequence = vectSequence;
+    this->bCacheSave = this->cache.isEnabled();
+}
+
+//*
+//* End of StiffnessMatrix::setCacheSequence
+//***************************************************************************
+
+void StiffnessMatrix::saveCache(void)
+{
+    if ( ! this->bCacheSave || this->bCached || this->adLocation == nullptr )
+        return;
+
+    this->cache.save( this->uiCacheKey, this->vectCacheSequence,
+                      this->iMatrixSize, this->iBandwidth, this->uiArraySize,
+                      this->adLocation, this->adPivotInverse );
+    this->bCacheSave = false;
+}
+
+//***************************************************************************
+//*
+//* StiffnessMatrix::reduceColumn
+//*     This function reduces a column using the previously reduced columns.
+//*     The reductions of an entry stream down both its own column and the
+//*     column of its row from the higher of the two Skylines.  The Legacy
+//*     kernel divides each term by its pivot and sums the terms in order,
+//*     as PPSA does.  The Vector kernel scales by the pivot reciprocals and
+//*     sums in fixed vector lanes, so its results differ in the last bits.
+//*
+//*     When column completion flags are given, each column of a row is
+//*     waited on before it is used.  The pivots above the row are then also
+//*     complete as their entries in this column were reduced first (the
+//*     Skyline row's column is waited on before starting).
+//*
+//***************************************************************************
+
+void StiffnessMatrix::reduceColumn(int iCol, std::atomic<bool> * abColumnDone)
+{
+    int iSkyCol = this->aiSkyline[iCol];
+    double * adCol = this->adLocation + this->auiColumnTop[iCol];  // ...adCol[0] is row iSkyCol
+
+    if (abColumnDone != nullptr && iSkyCol < iCol)
+    {
+        while ( ! abColumnDone[iSkyCol].load(std::memory_order_acquire) )
+            std::this_thread::yield();
+    }
+
+    for (int iRow1 = (iSkyCol + 1); iRow1 <= iCol; iRow1++)
+    {
+        if (abColumnDone != nullptr && iRow1 < iCol)
+        {
+            while ( ! abColumnDone[iRow1].load(std::memory_order_acquire) )
+                std::this_thread::yield();
+        }
+
+        int iSkyRow = this->aiSkyline[iRow1];
+        int iTop = (iSkyRow > iSkyCol) ? iSkyRow : iSkyCol;
+        int iCount = iRow1 - iTop;
+        const double * adRow = this->adLocation + this->auiColumnTop[iRow1] + (iTop - iSkyRow);
+        const double * adColTop = adCol + (iTop - iSkyCol);
+        if (this->cKernel == StiffnessMatrix::cKernelVector)
+        {
+            adCol[iRow1 - iSkyCol] -=
+                    StiffnessKernel::dot(adRow, adColTop, this->adPivotInverse + iTop, iCount);
+        }
+        else
+        {
+            const double * adPivotTop = this->adPivot + iTop;
+            double dValue = adCol[iRow1 - iSkyCol];
+            for (int iIndex = 0; iIndex < iCount; iIndex++)
+                dValue -= (adRow[iIndex] * adColTop[iIndex] / adPivotTop[iIndex]);
+            adCol[iRow1 - iSkyCol] = dValue;
+        }
+    }
+
+    this->adPivot[iCol] = adCol[iCol - iSkyCol];
+    this->adPivotInverse[iCol] = 1.0 / adCol[iCol - iSkyCol];
+}
+
+//*
+//* End of StiffnessMatrix::reduceColumn
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* StiffnessMatrix::decompose
+//*     This function decomposes the structure's K Matrix into the
+//*     A Matrix.  A cached A Matrix is already decomposed.  A newly
+//*     decomposed Skyline A Matrix is saved to the cache when requested.
+//*
+//*     The Mixed solver decomposes a single precision copy and keeps the
+//*     K Matrix for refinement.  If the single precision decomposition
+//*     fails, the K Matrix is decomposed in double precision instead.
+//*
+//***************************************************************************
+
+bool StiffnessMatrix::decompose()
+{
+    if (this->sparse != nullptr)
+        return this->sparse->factor();
+    if (this->pcg != nullptr)
+        return this->pcg->precondition();
+    if (this->bCached)
+        return true;
+
+    if (this->cSolver == StiffnessMatrix::cSolverMixed && ! this->bMixedFallback)
+    {
+        if ( this->decomposeMixed() )
+            return true;
+        this->bMixedFallback = true;
+    }
+
+    if (this->siThreads > 1 && this->iMatrixSize > 1)
+    {
+        if ( ! this->decomposeParallel() )
+            return false;
+        this->saveCache();
+        return true;
+    }
+
+    // Reduce each column in turn...
+    for (int iCol = 0; iCol < this->iMatrixSize; iCol++)
+    {
+        this->reduceColumn(iCol, nullptr);
+
+        // Check the reduced column's pivot before it is used...
+        if ( iCol < (this->iMatrixSize - 1) &&
+             this->adLocation[ this->auiDiagonalPos[iCol] ] == 0.0 )
+        {
+            std::cerr << "\n WARNING: Stiffness Matrix is SINGULAR!\n"
+                      <<   "          Unable to find solution for Plane Frame!\n";
+            return false;
+        }
+    }
+
+    this->saveCache();
+    return true;
+}
+
+//*
+//* End of StiffnessMatrix::decompose
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* StiffnessMatrix::decomposeParallel
+//*     This function decomposes the structure's K Matrix into the
+//*     A Matrix using a pipelined schedule across threads.  The columns
+//*     are dealt round robin to the threads.  Each column is reduced as
+//*     soon as the columns it depends on are complete, so the threads
+//*     work down the Skyline together.
+//*
+//*     Each entry is reduced by exactly the same operations as the serial
+//*     decomposition, so the results are identical for any thread count.
+//*
+//***************************************************************************
+
+bool StiffnessMatrix::decomposeParallel(void)
+{
+    std::atomic<bool> * abColumnDone = new std::atomic<bool>[this->iMatrixSize];
+    if (abColumnDone == nullptr)
+    {
+        std::cerr << "\n ERROR: OUT OF MEMORY!\n"
+                  <<   "        Parallel decomposition flags!\n";
+        return false;
+    }
+    for (int iCol = 0; iCol < this->iMatrixSize; iCol++)
+        abColumnDone[iCol].store(false, std::memory_order_relaxed);
+
+    std::atomic<bool> bSingular(false);
+    short int siThreadCount = this->siThreads;
+    if (siThreadCount > this->iMatrixSize)
+        siThreadCount = this->iMatrixSize;
+
+    auto reduceColumns =
+        [this, abColumnDone, &bSingular, siThreadCount](short int siThread)
+        {
+            for (int iCol = siThread; iCol < this->iMatrixSize; iCol += siThreadCount)
+            {
+                this->reduceColumn(iCol, abColumnDone);
+
+                // Check the reduced column's pivot.  The columns are all
+                // still reduced after a SINGULAR pivot so no thread waits
+                // forever on a column...
+                if ( iCol < (this->iMatrixSize - 1) &&
+                     this->adLocation[ this->auiDiagonalPos[iCol] ] == 0.0 )
+                    bSingular.store(true, std::memory_order_relaxed);
+                abColumnDone[iCol].store(true, std::memory_order_release);
+            }
+        };
+
+    std::vector<std::thread> vectThreads;
+    for (short int siThread = 1; siThread < siThreadCount; siThread++)
+        vectThreads.emplace_back(reduceColumns, siThread);
+    reduceColumns(0);
+    for (std::thread & threadCurr : vectThreads)
+        threadCurr.join();
+
+    delete [] abColumnDone;
+
+    if ( bSingular.load() )
+    {
+        std::cerr << "\n WARNING: Stiffness Matrix is SINGULAR!\n"
+                  <<   "          Unable to find solution for Plane Frame!\n";
+        return false;
+    }
+
+    return true;
+}
+
+//*
+//* End of StiffnessMatrix::decomposeParallel
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* StiffnessMatrix::decomposeMixed
+//*     This function decomposes a single precision copy of the structure's
+//*     K Matrix into a single precision A Matrix.  The single precision
+//*     columns are half the size, so twice the entries stream through
+//*     cache and vector registers.  The K Matrix is kept in double
+//*     precision for the refinement residuals.
+//*
+//*     A K Matrix entry beyond single precision range, or a pivot that is
+//*     0 or not finite, fails the decomposition.
+//*
+//***************************************************************************
+
+bool StiffnessMatrix::decomposeMixed(void)
+{
+    this->afLocation = new (std::nothrow) float[this->uiArraySize];
+    this->afPivotInverse = new (std::nothrow) float[this->iMatrixSize]();
+    if (this->afLocation == nullptr || this->afPivotInverse == nullptr)
+    {
+        this->clearMixed();
+        return false;
+    }
+
+    for (std::size_t uiPosition = 0; uiPosition < this->uiArraySize; uiPosition++)
+    {
+        if ( std::fabs(this->adLocation[uiPosition]) > (double) std::numeric_limits<float>::max() )
+        {
+            this->clearMixed();
+            return false;
+        }
+        this->afLocation[uiPosition] = (float) this->adLocation[uiPosition];
+    }
+
+    // Reduce each column in turn (as reduceColumn)...
+    for (int iCol = 0; iCol < this->iMatrixSize; iCol++)
+    {
+        int iSkyCol = this->aiSkyline[iCol];
+        float * afCol = this->afLocation + this->auiColumnTop[iCol];
+        for (int iRow1 = (iSkyCol + 1); iRow1 <= iCol; iRow1++)
+        {
+            int iSkyRow = this->aiSkyline[iRow1];
+            int iTop = (iSkyRow > iSkyCol) ? iSkyRow : iSkyCol;
+            afCol[iRow1 - iSkyCol] -=
+                    StiffnessKernel::dot( this->afLocation + this->auiColumnTop[iRow1] + (iTop - iSkyRow),
+                                          afCol + (iTop - iSkyCol),
+                                          this->afPivotInverse + iTop,
+                                          iRow1 - iTop );
+        }
+
+        float fPivot = afCol[iCol - iSkyCol];
+        if ( fPivot == 0.0f || ! std::isfinite(fPivot) )
+        {
+            this->clearMixed();
+            return false;
+        }
+        this->afPivotInverse[iCol] = 1.0f / fPivot;
+    }
+
+    return true;
+}
+
+//*
+//* End of StiffnessMatrix::decomposeMixed
+//***************************************************************************
+
+void StiffnessMatrix::clearMixed(void)
+{
+    if (this->afLocation != nullptr)
+        delete [] this->afLocation;
+    this->afLocation = nullptr;
+
+    if (this->afPivotInverse != nullptr)
+        delete [] this->afPivotInverse;
+    this->afPivotInverse = nullptr;
+}
+
+//***************************************************************************
+//*
+//* StiffnessMatrix::solveMixed
+//*     This function solves the single precision A Matrix for the given
+//*     forces in place, leaving the displacements.
+//*
+//***************************************************************************
+
+void StiffnessMatrix::solveMixed(float * afWork)
+{
+    // Decompose Force Matrix...
+    for (int iCol = 1; iCol < this->iMatrixSize; iCol++)
+    {
+        int iSkyCol = this->aiSkyline[iCol];
+        afWork[iCol] -= StiffnessKernel::dot( this->afLocation + this->auiColumnTop[iCol],
+                                              afWork + iSkyCol,
+                                              this->afPivotInverse + iSkyCol,
+                                              iCol - iSkyCol );
+    }
+
+    // Calculate System Displacements: each solved displacement replaces
+    // its force as only the forces above it are still used...
+    for (int iCol = (this->iMatrixSize - 1); iCol >= 0; iCol--)
+    {
+        int iSkyCol = this->aiSkyline[iCol];
+        afWork[iCol] *= this->afPivotInverse[iCol];
+        StiffnessKernel::axpy( afWork + iSkyCol,
+                               this->afLocation + this->auiColumnTop[iCol],
+                               afWork[iCol],
+                               iCol - iSkyCol );
+    }
+}
+
+//*
+//* End of StiffnessMatrix::solveMixed
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* StiffnessMatrix::calcResidual
+//*     This function calculates the residual forces F - K X of the given
+//*     displacements in double precision from the K Matrix.  Each Skyline
+//*     column gives its entry's row sum and, by symmetry, its terms of the
+//*     rows above.
+//*
+//***************************************************************************
+
+void StiffnessMatrix::calcResidual(const double * adDisplace, const double * adForce, double * adResidual)
+{
+    for (int iCol = 0; iCol < this->iMatrixSize; iCol++)
+        adResidual[iCol] = adForce[iCol];
+
+    for (int iCol = 0; iCol < this->iMatrixSize; iCol++)
+    {
+        int iSkyCol = this->aiSkyline[iCol];
+        int iCount = iCol - iSkyCol;
+        const double * adCol = this->adLocation + this->auiColumnTop[iCol];
+
+        double dSum = adCol[iCount] * adDisplace[iCol];
+        for (int iIndex = 0; iIndex < iCount; iIndex++)
+            dSum += adCol[iIndex] * adDisplace[iSkyCol + iIndex];
+        adResidual[iCol] -= dSum;
+
+        StiffnessKernel::axpy( adResidual + iSkyCol, adCol, adDisplace[iCol], iCount );
+    }
+}
+
+//*
+//* End of StiffnessMatrix::calcResidual
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* StiffnessMatrix::refine
+//*     This function solves the given forces by iterative refinement.
+//*     Each step solves a correction for the residual forces with the
+//*     single precision A Matrix and recalculates the residual in double
+//*     precision.  The refinement converges when the relative residual
+//*     |F - K X| / |F| reaches the tolerance or the correction falls to
+//*     double precision roundoff.  It fails when a correction does not at
+//*     least halve or the step limit is reached.
+//*
+//***************************************************************************
+
+bool StiffnessMatrix::refine(double * adDisplace, const double * adForce, int & iSteps, double & dResidual)
+{
+    std::vector<double> vectResidual(adForce, adForce + this->iMatrixSize);
+    std::vector<float> vectCorrection(this->iMatrixSize);
+
+    double dForceNorm = 0.0;
+    for (int iCol = 0; iCol < this->iMatrixSize; iCol++)
+    {
+        adDisplace[iCol] = 0.0;
+        dForceNorm += adForce[iCol] * adForce[iCol];
+    }
+    dForceNorm = std::sqrt(dForceNorm);
+
+    iSteps = 0;
+    dResidual = 0.0;
+    if (dForceNorm == 0.0) // ...no load, no displacement
+        return true;
+
+    double dLastCorrection = std::numeric_limits<double>::infinity();
+    while (iSteps < StiffnessMatrix::iRefineLimit)
+    {
+        ++iSteps;
+
+        // Solve the correction in single precision...
+        for (int iCol = 0; iCol < this->iMatrixSize; iCol++)
+            vectCorrection[iCol] = (float) vectResidual[iCol];
+        this->solveMixed( vectCorrection.data() );
+
+        double dCorrection = 0.0;
+        double dDisplace = 0.0;
+        for (int iCol = 0; iCol < this->iMatrixSize; iCol++)
+        {
+            adDisplace[iCol] += (double) vectCorrection[iCol];
+            dCorrection = std::max( dCorrection, std::fabs( (double) vectCorrection[iCol] ) );
+            dDisplace = std::max( dDisplace, std::fabs(adDisplace[iCol]) );
+        }
+        if ( ! std::isfinite(dDisplace) )
+            return false;
+
+        // Recalculate the residual in double precision...
+        this->calcResidual( adDisplace, adForce, vectResidual.data() );
+        double dResidualNorm = 0.0;
+        for (int iCol = 0; iCol < this->iMatrixSize; iCol++)
+            dResidualNorm += vectResidual[iCol] * vectResidual[iCol];
+        dResidual = std::sqrt(dResidualNorm) / dForceNorm;
+
+        if ( dResidual <= this->dTolerance ||
+             dCorrection <= 4.0 * std::numeric_limits<double>::epsilon() * dDisplace )
+            return true;
+        if (dCorrection > 0.5 * dLastCorrection) // ...not converging
+            return false;
+        dLastCorrection = dCorrection;
+    }
+
+    return false;
+}
+
+//*
+//* End of StiffnessMatrix::refine
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* updateSkyline
+//*     This function applies the rank one change Alpha V Vt to a decomposed
+//*     Skyline A Matrix in place (Gill, Golub, Murray and Saunders, Method
+//*     C1).  Each column streams down its entries once, so a change costs
+//*     one pass over the Skyline below its first row instead of a new
+//*     decomposition.  V is only nonzero on the first row and the rows
+//*     coupled to it, so the columns above the first row are unchanged and
+//*     no entry outside the Skyline fills in.
+//*
+//*     The A Matrix holds each entry scaled by its row's pivot, so an entry
+//*     is unscaled by its old pivot and rescaled by its new pivot.  The
+//*     same pass serves the double and the single precision A Matrix.
+//*
+//*     A pivot that changes sign, reaches 0 or is not finite fails the
+//*     change, leaving the A Matrix partly changed.
+//*
+//***************************************************************************
+
+template <typename Entry>
+static bool updateSkyline(Entry * aeLocation, Entry * aePivotInverse,
+                          const int * aiSkyline, const std::size_t * auiColumnTop,
+                          int iMatrixSize, int iFirst, double dAlpha, const double * adVector)
+{
+    int iCount = iMatrixSize - iFirst;
+    std::vector<double> vectPassed(iCount);        // Vector remaining at each pivot
+    std::vector<double> vectBeta(iCount);          // Entry change of each row
+    std::vector<double> vectOldInverse(iCount);    // Old pivot reciprocal of each row
+    std::vector<double> vectNewPivot(iCount);      // New pivot of each row
+
+    for (int iCol = iFirst; iCol < iMatrixSize; iCol++)
+    {
+        int iSkyCol = aiSkyline[iCol];
+        int iTop = (iSkyCol > iFirst) ? iSkyCol : iFirst;
+        Entry * aeCol = aeLocation + auiColumnTop[iCol];  // ...aeCol[0] is row iSkyCol
+
+        double dVector = adVector[iCol];
+        for (int iRow = iTop; iRow < iCol; iRow++)
+        {
+            int iIndex = iRow - iFirst;
+            double dEntry = (double) aeCol[iRow - iSkyCol] * vectOldInverse[iIndex];
+            dVector -= vectPassed[iIndex] * dEntry;
+            dEntry += vectBeta[iIndex] * dVector;
+            aeCol[iRow - iSkyCol] = (Entry) ( dEntry * vectNewPivot[iIndex] );
+        }
+
+        double dPivot = (double) aeCol[iCol - iSkyCol];
+        double dNewPivot = dPivot + dAlpha * dVector * dVector;
+        if ( ! std::isfinite(dNewPivot) || dNewPivot * dPivot <= 0.0 )
+            return false;
+
+        int iIndex = iCol - iFirst;
+        vectPassed[iIndex] = dVector;
+        vectBeta[iIndex] = dAlpha * dVector / dNewPivot;
+        vectOldInverse[iIndex] = (double) aePivotInverse[iCol];
+        vectNewPivot[iIndex] = dNewPivot;
+        dAlpha = dAlpha * dPivot / dNewPivot;
+
+        aeCol[iCol - iSkyCol] = (Entry) dNewPivot;
+        aePivotInverse[iCol] = (Entry) ( 1.0 / dNewPivot );
+    }
+
+    return true;
+}
+
+//*
+//* End of updateSkyline
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* StiffnessMatrix::update
+//*     This function changes the decomposed A Matrix for a change of the
+//*     given member's stiffness, given as its global stiffness matrix
+//*     change (New - Old).  The change is split into at most 6 rank one
+//*     changes (one for each of the member's free DoFs) which update or
+//*     downdate the Skyline factor in place.  A change costs about one
+//*     pass over the Skyline below the member's first DoF for each rank
+//*     instead of a new decomposition.  The increases are applied before
+//*     the decreases so the factor stays positive definite throughout.
+//*
+//*     The Mixed solver changes its K Matrix and updates its single
+//*     precision A Matrix.  A cached factor is copied out of the cache
+//*     first.  The Sparse and PCG solvers and condensed Panels are not
+//*     updated.
+//*
+//*     If the factor is not updated, or an update fails, false is returned
+//*     and the SSM must be created and decomposed again.
+//*
+//***************************************************************************
+
+bool StiffnessMatrix::update(Member * member, double adSSM_Delta[6][6])
+{
+    if ( this->sparse != nullptr || this->pcg != nullptr || this->adLocation == nullptr ||
+         ! this->vectSubstructures.empty() )
+        return false;
+
+    int aiPositionIndex[6];
+    aiPositionIndex[0] = member->nodeNeg->iHorzFlag;
+    aiPositionIndex[1] = member->nodeNeg->iVertFlag;
+    aiPositionIndex[2] = member->nodeNeg->iRotFlag;
+    aiPositionIndex[3] = member->nodePos->iHorzFlag;
+    aiPositionIndex[4] = member->nodePos->iVertFlag;
+    aiPositionIndex[5] = member->nodePos->iRotFlag;
+
+    // Gather the change on the member's FREE elements...
+    int aiEquation[6];
+    double adChange[6][6];
+    int iCount = 0;
+    int iFirst = this->iMatrixSize;
+    for (short int siIndex1 = 0; siIndex1 < 6; siIndex1++)
+    {
+        if ( ! aiPositionIndex[siIndex1] ) // ...element is FIXED...
+            continue;
+
+        int iIndex2 = 0;
+        for (short int siIndex2 = 0; siIndex2 < 6; siIndex2++)
+        {
+            if (aiPositionIndex[siIndex2]) // ...element is FREE...
+                adChange[iCount][iIndex2++] = adSSM_Delta[siIndex1][siIndex2];
+        }
+        aiEquation[iCount] = aiPositionIndex[siIndex1] - 1;
+        if (aiEquation[iCount] < iFirst)
+            iFirst = aiEquation[iCount];
+        iCount++;
+    }
+    if (iCount == 0) // ...member holds no FREE element...
+        return true;
+
+    if ( ! this->ownCachedFactor() )
+        return false;
+    this->bCacheSave = false; // ...the factor no longer matches the structure key
+
+    // Change the System Stiffness Matrix Diagonal for use in Column
+    //   Calculations and, for the Mixed solver, the K Matrix...
+    for (int iIndex1 = 0; iIndex1 < iCount; iIndex1++)
+    {
+        this->adDiagonal[ aiEquation[iIndex1] ] += adChange[iIndex1][iIndex1];
+        if (this->afLocation != nullptr)
+        {
+            for (int iIndex2 = iIndex1; iIndex2 < iCount; iIndex2++)
+                this->adLocation[ this->position(aiEquation[iIndex1], aiEquation[iIndex2]) ] +=
+                        adChange[iIndex1][iIndex2];
+        }
+    }
+
+    // Split the change into rank one changes...
+    double adValue[6];
+    double adVector[6][6];
+    StiffnessMatrix::diagonalize(iCount, adChange, adValue, adVector);
+
+    int aiOrder[6];
+    double dLargest = 0.0;
+    for (int iIndex = 0; iIndex < iCount; iIndex++)
+    {
+        aiOrder[iIndex] = iIndex;
+        dLargest = std::max( dLargest, std::fabs(adValue[iIndex]) );
+    }
+    std::sort( aiOrder, aiOrder + iCount,
+               [&adValue](int iIndex1, int iIndex2) { return adValue[iIndex1] > adValue[iIndex2]; } );
+    double dNegligible = dLargest * iCount * std::numeric_limits<double>::epsilon();
+
+    std::vector<double> vectVector(this->iMatrixSize, 0.0);
+    for (int iRank = 0; iRank < iCount; iRank++)
+    {
+        int iValue = aiOrder[iRank];
+        if ( std::fabs(adValue[iValue]) <= dNegligible ) // ...no change in this direction
+            continue;
+
+        for (int iIndex = 0; iIndex < iCount; iIndex++)
+            vectVector[ aiEquation[iIndex] ] = adVector[iIndex][iValue];
+
+        bool bUpdated =
+            (this->afLocation != nullptr) ?
+                updateSkyline( this->afLocation, this->afPivotInverse, this->aiSkyline, this->auiColumnTop,
+                               this->iMatrixSize, iFirst, adValue[iValue], vectVector.data() ) :
+                updateSkyline( this->adLocation, this->adPivotInverse, this->aiSkyline, this->auiColumnTop,
+                               this->iMatrixSize, iFirst, adValue[iValue], vectVector.data() );
+        if ( ! bUpdated )
+        {
+            std::cerr << "\n WARNING: Stiffness Matrix update is not positive definite!\n"
+                      <<   "          Decomposing the Stiffness Matrix again...\n";
+            return false;
+        }
+        this->iUpdateRanks++;
+    }
+
+    // The Legacy kernel divides by the changed pivots...
+    if (this->afLocation == nullptr)
+    {
+        for (int iCol = iFirst; iCol < this->iMatrixSize; iCol++)
+            this->adPivot[iCol] = this->adLocation[ this->auiDiagonalPos[iCol] ];
+    }
+    this->iUpdates++;
+
+    return true;
+}
+
+//*
+//* End of StiffnessMatrix::update
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* StiffnessMatrix::ownCachedFactor
+//*     This function copies a factor mapped from the cache into owned
+//*     arrays so it can be changed.
+//*
+//***************************************************************************
+
+bool StiffnessMatrix::ownCachedFactor(void)
+{
+    if ( ! this->bCached )
+        return true;
+
+    double * adNewLocation = new (std::nothrow) double[this->uiArraySize];
+    double * adNewPivotInverse = new (std::nothrow) double[this->iMatrixSize];
+    if (adNewLocation == nullptr || adNewPivotInverse == nullptr)
+    {
+        delete [] adNewLocation;
+        delete [] adNewPivotInverse;
+        std::cerr << "\n ERROR: OUT OF MEMORY!\n"
+                  <<   "        System Stiffness Matrix too large to update!\n"
+                  <<   "       Profile Size = " << this->uiArraySize << "\n";
+        return false;
+    }
+    std::copy(this->adLocation, this->adLocation + this->uiArraySize, adNewLocation);
+    std::copy(this->adPivotInverse, this->adPivotInverse + this->iMatrixSize, adNewPivotInverse);
+
+    this->adLocation = adNewLocation;
+    this->adPivotInverse = adNewPivotInverse;
+    this->cache.clear();
+    this->bCached = false;
+
+    return true;
+}
+
+//*
+//* End of StiffnessMatrix::ownCachedFactor
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* StiffnessMatrix::diagonalize
+//*     This function finds the eigenvalues and eigenvectors (as columns) of
+//*     the given symmetric matrix of the given size by cyclic Jacobi
+//*     rotations.  The matrix is destroyed.
+//*
+//***************************************************************************
+
+void StiffnessMatrix::diagonalize(int iSize, double adMatrix[6][6], double adValue[6], double adVector[6][6])
+{
+    for (int iRow = 0; iRow < iSize; iRow++)
+    {
+        for (int iCol = 0; iCol < iSize; iCol++)
+            adVector[iRow][iCol] = (iRow == iCol) ? 1.0 : 0.0;
+    }
+
+    for (short int siSweep = 0; siSweep < 50; siSweep++)
+    {
+        double dOff = 0.0;
+        double dNorm = 0.0;
+        for (int iRow = 0; iRow < iSize; iRow++)
+        {
+            dNorm += adMatrix[iRow][iRow] * adMatrix[iRow][iRow];
+            for (int iCol = iRow + 1; iCol < iSize; iCol++)
+                dOff += adMatrix[iRow][iCol] * adMatrix[iRow][iCol];
+        }
+        if ( dOff <= std::numeric_limits<double>::epsilon() * std::numeric_limits<double>::epsilon() * dNorm )
+            break;
+
+        for (int iP = 0; iP < iSize - 1; iP++)
+        {
+            for (int iQ = iP + 1; iQ < iSize; iQ++)
+            {
+                if (adMatrix[iP][iQ] == 0.0)
+                    continue;
+
+                // Rotate Pth and Qth rows and columns to clear the P,Q entry...
+                double dTheta = ( adMatrix[iQ][iQ] - adMatrix[iP][iP] ) / ( 2.0 * adMatrix[iP][iQ] );
+                double dTan = ( (dTheta < 0.0) ? -1.0 : 1.0 ) /
+                              ( std::fabs(dTheta) + std::sqrt(dTheta * dTheta + 1.0) );
+                double dCos = 1.0 / std::sqrt(dTan * dTan + 1.0);
+                double dSin = dTan * dCos;
+
+                for (int iK = 0; iK < iSize; iK++)
+                {
+                    double dKP = adMatrix[iK][iP];
+                    double dKQ = adMatrix[iK][iQ];
+                    adMatrix[iK][iP] = dCos * dKP - dSin * dKQ;
+                    adMatrix[iK][iQ] = dSin * dKP + dCos * dKQ;
+                }
+                for (int iK = 0; iK < iSize; iK++)
+                {
+                    double dPK = adMatrix[iP][iK];
+                    double dQK = adMatrix[iQ][iK];
+                    adMatrix[iP][iK] = dCos * dPK - dSin * dQK;
+                    adMatrix[iQ][iK] = dSin * dPK + dCos * dQK;
+                }
+                for (int iK = 0; iK < iSize; iK++)
+                {
+                    double dKP = adVector[iK][iP];
+                    double dKQ = adVector[iK][iQ];
+                    adVector[iK][iP] = dCos * dKP - dSin * dKQ;
+                    adVector[iK][iQ] = dSin * dKP + dCos * dKQ;
+                }
+            }
+        }
+    }
+
+    for (int iIndex = 0; iIndex < iSize; iIndex++)
+        adValue[iIndex] = adMatrix[iIndex][iIndex];
+}
+
+//*
+//* End of StiffnessMatrix::diagonalize
+//***************************************************************************
+
+std::string StiffnessMatrix::report()
+{
+    double dPercent = 0.0;
+    if (this->uiBandSize > 0)
+        dPercent = 100.0 * (double) this->uiArraySize / (double) this->uiBandSize;
+
+    std::string strFormat;
+    strFormat = strFormat +
+        "      Cut  Matrix    Band  |      Array    Band  Matrix     Cut\n" +
+        "     Size    Side    Size  |       Size    Size    Side    Size\n" +
+        "   ------  ------  ------  |  ---------  ------  ------  ------\n" +
+        "   {:6d} ={:6d} -{:6d}  |  {:9d} ={:6d} ({:6d} +{:6d} + 1 ) / 2\n" +
+        "\n" +
+        "   Skyline (Profile) Storage:  {:9d} of {:9d} ({:5.1f}%)\n";
+    std::string strReport =
+        fmt::vformat(
+                strFormat,
+                fmt::make_format_args(
+                    this->iCut, this->iMatrixSize, this->iBandwidth,
+                    this->uiBandSize, this->iBandwidth, this->iMatrixSize, this->iCut,
+                    this->uiArraySize, this->uiBandSize, dPercent
+                )
+            );
+
+    if (this->sparse != nullptr)
+    {
+        long int liFactorSize = this->sparse->getFactorSize();
+        int iSupernodes = this->sparse->getSupernodes();
+        int iSeparators = this->sparse->getSeparators();
+        strReport +=
+            fmt::format( "   Sparse Supernodal Factor:   {:9d} in {} Supernodes ({} Nested Dissection Separators)\n",
+                         liFactorSize, iSupernodes, iSeparators );
+    }
+
+    if (this->pcg != nullptr)
+    {
+        long int liMatrixEntries = this->pcg->getMatrixEntries();
+        std::string strPrecond = (this->cSolver == StiffnessMatrix::cSolverPCGJacobi) ? "Jacobi" : "IC(0)";
+        double dShift = this->pcg->getShift();
+        strReport +=
+            fmt::format( "   Iterative PCG ({}) Matrix:  {:9d}, Tolerance {:9.3E}",
+                         strPrecond, liMatrixEntries, this->dTolerance );
+        if (dShift > 0.0)
+            strReport += fmt::format( ", Diagonal Shift {:9.3E}", dShift );
+        strReport += "\n";
+    }
+
+    if ( ! this->vectSubstructures.empty() )
+    {
+        int iPanels = 0;
+        for (Substructure * subCurr : this->vectSubstructures)
+            iPanels += (int) subCurr->vectPanels.size();
+        int iCondensed = this->iSystemSize - this->iMatrixSize;
+        std::size_t uiSubstructures = this->vectSubstructures.size();
+        strReport +=
+            fmt::format( "   Condensed Panel Interiors:  {:9d} of {:9d} Equations in {} Panels ({} Substructures)\n",
+                         iCondensed, this->iSystemSize, iPanels, uiSubstructures );
+    }
+
+    if ( this->cKernel == StiffnessMatrix::cKernelVector &&
+         this->sparse == nullptr && this->pcg == nullptr )
+        strReport +=
+            fmt::format( "   Vector Skyline Kernel:      {} ({} Lanes)\n",
+                         StiffnessKernel::getName(), (int) StiffnessKernel::siLanes );
+
+    if (this->iUpdates > 0)
+        strReport +=
+            fmt::format( "   Member Updates:             {:9d} Rank One Changes for {} Members\n",
+                         this->iUpdateRanks, this->iUpdates );
+
+    if ( ! this->cache.getFile().empty() )
+        strReport +=
+            fmt::format( "   Factor Cache:               {} {}\n",
+                         this->bCached ? "Loaded" : "Saved", this->cache.getFile() );
+
+    if (this->cSolver == StiffnessMatrix::cSolverMixed)
+    {
+        if (this->afLocation != nullptr)
+            strReport +=
+                fmt::format( "   Mixed Precision Factor:     {:9d} Single Precision, Refinement Tolerance {:9.3E}\n",
+                             this->uiArraySize, this->dTolerance );
+        else
+            strReport += "   Mixed Precision Factor:     Single Precision failed, Decomposed in Double Precision\n";
+    }
+
+    return strReport;
+}
+
+//***************************************************************************
+//*
+//* StiffnessMatrix::reportSolution
+//*     This function reports the accuracy of the given (0 based) load
+//*     case's displacement solution in the last batch.  Only iterative
+//*     and refined solutions have one to report.
+//*
+//***************************************************************************
+
+std::string StiffnessMatrix::reportSolution(short int siCase)
+{
+    if (this->cSolver == StiffnessMatrix::cSolverMixed)
+    {
+        if ( this->bMixedFallback || siCase >= (short int) this->vectCaseSteps.size() )
+            return "   Mixed Precision Solution: Solved in Double Precision\n\n";
+        int iSteps = this->vectCaseSteps[siCase];
+        double dResidual = this->vectCaseResidual[siCase];
+        return fmt::format( "   Mixed Precision Solution: {:d} Refinement Steps, Relative Residual {:9.3E} (Tolerance {:9.3E})\n\n",
+                            iSteps, dResidual, this->dTolerance );
+    }
+
+    if (this->pcg == nullptr)
+        return std::string();
+
+    int iIterations = this->pcg->getIterations(siCase);
+    double dResidual = this->pcg->getResidual(siCase);
+    return fmt::format( "   Iterative PCG Solution: {:d} Iterations, Scaled Residual {:9.3E} (Tolerance {:9.3E})\n\n",
+                        iIterations, dResidual, this->dTolerance );
+}
+
+//* End of StiffnessMatrix::reportSolution
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* StiffnessMatrix::displacement
+//*     This function calculates the force displacements of the structure's
+//*     K Matrix into the A Matrix.
+//*
+//*     A batch of Force Matrices (one per load case, each System Size long)
+//*     is solved together: each column of the A Matrix is applied to every
+//*     case while it is in cache.  Each case's result is identical to
+//*     solving it alone.
+//*
+//*     The Interior forces of condensed Panels are condensed onto their
+//*     Boundaries first and the Interior displacements are recovered from
+//*     the solved Boundaries.
+//*
+//*     If a solution does not reach the solver's tolerance (PCG) or the
+//*     A Matrix cannot be decomposed again (Mixed fallback), false is
+//*     returned and the displacements must not be used.
+//*
+//***************************************************************************
+
+bool StiffnessMatrix::calcDisplacement(double * adDisplace, double * adForce, short int siCount)
+{
+    if (this->sparse != nullptr)
+    {
+        this->sparse->solve(adDisplace, adForce, siCount);
+        return true;
+    }
+    if (this->pcg != nullptr)
+        return this->pcg->solve(adDisplace, adForce, siCount);
+
+    long int liStride = this->iSystemSize;
+
+    for (Substructure * subCurr : this->vectSubstructures)
+    {
+        for (short int siCase = 0; siCase < siCount; siCase++)
+            subCurr->condenseForce(adForce + siCase * liStride);
+    }
+
+    if ( ! this->solveSkyline(adDisplace, adForce, siCount) )
+        return false;
+
+    for (Substructure * subCurr : this->vectSubstructures)
+    {
+        for (short int siCase = 0; siCase < siCount; siCase++)
+            subCurr->recoverDisplacement(adDisplace + siCase * liStride, adForce + siCase * liStride);
+    }
+
+    return true;
+}
+
+//*
+//* End of StiffnessMatrix::displacement
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* StiffnessMatrix::solveSkyline
+//*     This function solves the batch of Force Matrices with the Skyline
+//*     A Matrix, refining from the single precision A Matrix for the Mixed
+//*     solver.  Only the SSM equations of each case are solved.  If the
+//*     Mixed solver's fallback cannot decompose in double precision, false
+//*     is returned.
+//*
+//***************************************************************************
+
+bool StiffnessMatrix::solveSkyline(double * adDisplace, double * adForce, short int siCount)
+{
+    long int liStride = this->iSystemSize;
+
+    if (this->afLocation != nullptr)
+    {
+        // Refine each case from the single precision A Matrix...
+        this->vectCaseSteps.assign(siCount, 0);
+        this->vectCaseResidual.assign(siCount, 0.0);
+        bool bRefined = true;
+        for (short int siCase = 0; siCase < siCount && bRefined; siCase++)
+            bRefined = this->refine( adDisplace + siCase * liStride, adForce + siCase * liStride,
+                                     this->vectCaseSteps[siCase], this->vectCaseResidual[siCase] );
+        if (bRefined)
+            return true;
+
+        // ...a case did not converge: decompose in double precision and
+        //    solve the whole batch directly...
+        std::cerr << "\n WARNING: Mixed Precision refinement did not converge!\n"
+                  <<   "          Solving in Double Precision...\n";
+        this->clearMixed();
+        this->bMixedFallback = true;
+        if ( ! this->decompose() )
+        {
+            std::fill(adDisplace, adDisplace + siCount * liStride, 0.0);
+            return false;
+        }
+    }
+
+    if (this->cKernel != StiffnessMatrix::cKernelVector)
+    {
+        this->solveLegacy(adDisplace, adForce, siCount);
+        return true;
+    }
+
+    // Decompose Force Matrix...
+
+    for (int iCol = 1; iCol < this->iMatrixSize; iCol++)
+    {
+        int iSkyCol = this->aiSkyline[iCol];
+        const double * adCol = this->adLocation + this->auiColumnTop[iCol];
+        for (short int siCase = 0; siCase < siCount; siCase++)
+        {
+            double * adCaseForce = adForce + siCase * liStride;
+            adCaseForce[iCol] -= StiffnessKernel::dot( adCol,
+                                                        adCaseForce + iSkyCol,
+                                                        this->adPivotInverse + iSkyCol,
+                                                        iCol - iSkyCol );
+        }
+    }
+
+    // Calculate System Displacements...
+
+    // Work back from the last diagonal value, removing each solved
+    // displacement from the forces up its column...
+    for (int iCol = (this->iMatrixSize - 1); iCol >= 0; iCol--)
+    {
+        int iSkyCol = this->aiSkyline[iCol];
+        const double * adCol = this->adLocation + this->auiColumnTop[iCol];
+        for (short int siCase = 0; siCase < siCount; siCase++)
+        {
+            double * adCaseForce = adForce + siCase * liStride;
+            double * adCaseDisplace = adDisplace + siCase * liStride;
+            adCaseDisplace[iCol] = adCaseForce[iCol] * this->adPivotInverse[iCol];
+            StiffnessKernel::axpy( adCaseForce + iSkyCol,
+                                   adCol,
+                                   adCaseDisplace[iCol],
+                                   iCol - iSkyCol );
+        }
+    }
+
+    return true;
+}
+
+//*
+//* End of StiffnessMatrix::solveSkyline
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* StiffnessMatrix::solveLegacy
+//*     This function solves the batch of Force Matrices with the Skyline
+//*     A Matrix using the Legacy kernel.  Each force is reduced term by
+//*     term down its column, dividing by the pivots.  Each displacement is
+//*     then summed across its row from the solved displacements below it,
+//*     stepping from each column's diagonal back up to the row, as PPSA
+//*     does.
+//*
+//***************************************************************************
+
+void StiffnessMatrix::solveLegacy(double * adDisplace, double * adForce, short int siCount)
+{
+    long int liStride = this->iSystemSize;
+    if (this->iMatrixSize < 1)
+        return;
+
+    for (short int siCase = 0; siCase < siCount; siCase++)
+    {
+        double * adCaseForce = adForce + siCase * liStride;
+        double * adCaseDisplace = adDisplace + siCase * liStride;
+
+        // Decompose Force Matrix...
+
+        for (int iCol = 1; iCol < this->iMatrixSize; iCol++)
+        {
+            int iSkyCol = this->aiSkyline[iCol];
+            int iCount = iCol - iSkyCol;
+            const double * adCol = this->adLocation + this->auiColumnTop[iCol];
+            const double * adCaseTop = adCaseForce + iSkyCol;
+            const double * adPivotTop = this->adPivot + iSkyCol;
+
+            double dForce = adCaseForce[iCol];
+            for (int iIndex = 0; iIndex < iCount; iIndex++)
+            {
+                if (adPivotTop[iIndex] != 0.0)
+                    dForce -= (adCol[iIndex] * adCaseTop[iIndex] / adPivotTop[iIndex]);
+            }
+            adCaseForce[iCol] = dForce;
+        }
+
+        // Calculate System Displacements...
+
+        // Start with last diagonal value...
+        int iRow = this->iMatrixSize - 1;
+        adCaseDisplace[iRow] = adCaseForce[iRow] / this->adPivot[iRow];
+        for (iRow = (this->iMatrixSize - 2); iRow >= 0 ; iRow--)
+        {
+            // ...sum across the row, stepping from each column's diagonal
+            //    back up to the row...
+            double dSum = 0.0;
+            for (int iCol = (iRow + 1); iCol <= this->aiRowEnd[iRow]; iCol++)
+            {
+                if (this->aiSkyline[iCol] <= iRow) // ...inside the column's Skyline...
+                    dSum += ( this->adLocation[ this->auiDiagonalPos[iCol] - (iCol - iRow) ] * adCaseDisplace[iCol] );
+            }
+            adCaseDisplace[iRow] = (adCaseForce[iRow] - dSum) / this->adPivot[iRow];
+        }
+    }
+}
+
+//*
+//* End of StiffnessMatrix::solveLegacy
 //***************************************************************************
@@ -9,35 +9,114 @@
 #define STIFFNESSMATRIX_HPP_
 
 #include "Member.hpp"
+#include "SparseCholesky.hpp"
+#include "ConjugateGradient.hpp"
+#include "FactorCache.hpp"
+#include "Substructure.hpp"
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 // System Stiffness Matrix (S Matrix)...
 
 class StiffnessMatrix
 {
 public:
+    static const char cSolverSkyline = 'S'; // Skyline (Profile) LDLt
+    static const char cSolverSparse = 'C';  // Sparse Supernodal Cholesky (LDLt)
+    static const char cSolverPCGJacobi = 'J'; // Iterative PCG, Jacobi preconditioner
+    static const char cSolverPCGIC = 'I';   // Iterative PCG, IC(0) preconditioner
+    static const char cSolverMixed = 'M';   // Skyline LDLt in single precision, refined in double
+    static const int iRefineLimit = 10;     // Mixed: refinement step limit
+    static const char cKernelLegacy = 'L';  // Skyline sums term by term in the PPSA order
+    static const char cKernelVector = 'V';  // Skyline sums in fixed vector lanes (StiffnessKernel)
+
     StiffnessMatrix(void);
     ~StiffnessMatrix(void);
     void clear(void);
 
-    bool create(short int, short int, std::vector<Member *> &);
-    short int getMatrixSize(void);
-    short int getBandwidth(void);
+    bool addPanel(std::vector<Member *> &);
+    bool create(int, int, std::vector<Member *> &);
+    static void calcGlobalStiffness(Member *, double [6][6]);
+    int getSystemSize(void);
+    int getMatrixSize(void);
+    int getBandwidth(void);
     double * getDiagonal(void);
+    void setThreads(short int);
+    short int getThreads(void);
+    void setSolver(char);
+    char getSolver(void);
+    void setTolerance(double);
+    double getTolerance(void);
+    void setKernel(char);
+    char getKernel(void);
+    void setCacheDirectory(std::string);
+    std::string getCacheDirectory(void);
+    bool isCacheEnabled(void);
+    bool openCache(std::uint64_t, int, std::vector<int> &);
+    void setCacheSequence(std::uint64_t, std::vector<int> &);
+    bool isCached(void);
     bool decompose(void);
+    bool update(Member *, double [6][6]);
     std::string report();
-    void calcDisplacement(double *, double *);
+    std::string reportSolution(short int);
+    bool calcDisplacement(double *, double *, short int);
 
 private:
     double * adLocation;            // pointer to first Matrix location
     double * adDiagonal;            // pointer to Matrix diagonal (for Column)
-    unsigned int uiArraySize;       // # of elements in the Square Matrix
-    short int siMatrixSize;         // Matrix size (the Square Matrix side length)
-    short int siBandwidth;          // Banded Matrix upper bandwidth
-    short int siCut;                // Cut = MatrixSize - Bandwidth, the unused triangular matrix portion
+    double * adPivotInverse;        // pointer to decomposed Matrix diagonal reciprocals (Pivots)
+    double * adPivot;               // pointer to decomposed Matrix diagonal (Legacy kernel only)
+    std::size_t * auiDiagonalPos;   // Skyline position of each column's diagonal
+    std::size_t * auiColumnTop;     // Skyline position of each column's first entry
+    int * aiSkyline;                // Skyline: first nonzero row of each column
+    int * aiRowEnd;                 // Skyline: last column reaching each row (or a row above it)
+    std::size_t uiArraySize;        // # of elements in the Skyline (Profile) Matrix
+    std::size_t uiBandSize;         // # of elements the Banded Matrix would require
+    int iMatrixSize;               // Matrix size (the Square Matrix side length)
+    int iBandwidth;                // Banded Matrix upper bandwidth
+    int iCut;                      // Cut = MatrixSize - Bandwidth, the unused triangular matrix portion
+    int iSystemSize;                // System equations: Matrix size and condensed Panel Interiors
+
+    short int siThreads;            // Decomposition threads (1 = Serial)
+    char cSolver;                   // Solver Indicator (see cSolver...)
+    char cKernel;                   // Skyline Kernel Indicator (see cKernel...)
+    SparseCholesky * sparse;        // Sparse factor (Sparse solver only)
+    double dTolerance;              // Residual tolerance (PCG: scaled, Mixed: relative)
+    ConjugateGradient * pcg;        // Iterative solution (PCG solvers only)
+    float * afLocation;             // Single precision A Matrix (Mixed solver only)
+    float * afPivotInverse;         // Single precision Pivots (Mixed solver only)
+    bool bMixedFallback;            // Mixed: refinement failed, decomposed in double precision
+    std::vector<int> vectCaseSteps;         // Mixed: last batch refinement steps of each solution
+    std::vector<double> vectCaseResidual;   // Mixed: last batch relative residual of each solution
+    FactorCache cache;              // Factored SSM cache (Skyline solver only)
+    std::uint64_t uiCacheKey;       // Structure key for the cache
+    std::vector<int> vectCacheSequence; // Node sequence to save with the factor
+    bool bCacheSave;                // Save the factor after decomposing
+    bool bCached;                   // Factor is mapped from the cache (not owned)
+    int iUpdates;                   // Members updated in place since decomposing
+    int iUpdateRanks;               // Rank one changes of the Member updates
+    std::vector<Substructure *> vectSubstructures;  // Condensed Panels (Skyline solvers only)
+    std::unordered_set<Member *> setCondensed;      // Members of the condensed Panels
 
-    unsigned int position(short int, short int);
+    bool createSkyline(std::vector<Member *> &);
+    void reduceColumn(int, std::atomic<bool> *);
+    bool solveSkyline(double *, double *, short int);
+    void solveLegacy(double *, double *, short int);
+    bool decomposeParallel(void);
+    bool decomposeMixed(void);
+    void clearMixed(void);
+    void solveMixed(float *);
+    void calcResidual(const double *, const double *, double *);
+    bool refine(double *, const double *, int &, double &);
+    std::size_t position(int, int);
+    void saveCache(void);
+    bool ownCachedFactor(void);
+    static void diagonalize(int, double [6][6], double [6], double [6][6]);
 };
 
 #endif /* STIFFNESSMATRIX_HPP_ */
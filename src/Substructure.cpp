@@ -0,0 +1,404 @@
+/*
+ * Substructure.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#include "Substructure.hpp"
+#include "StiffnessMatrix.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+Substructure::Substructure(void)
+{
+    this->clear();
+}
+
+Substructure::~Substructure(void)
+{
+    this->clear();
+}
+
+void Substructure::clear(void)
+{
+    this->vectPanels.clear();
+    this->iInterior = 0;
+    this->iBoundary = 0;
+    this->vectKey.clear();
+    this->vectFactor.clear();
+    this->vectCoupling.clear();
+    this->vectCondensed.clear();
+}
+
+//***************************************************************************
+//*
+//* Substructure::findNodes
+//*     This function lists a Panel's Nodes in the order its Members first
+//*     use them.  The order numbers the Panel's equations.
+//*
+//***************************************************************************
+
+void Substructure::findNodes(std::vector<Member *> & members, std::vector<Node *> & vectNodes)
+{
+    vectNodes.clear();
+    for (Member * memberCurr : members)
+    {
+        for (Node * nodeCurr : { memberCurr->nodeNeg, memberCurr->nodePos })
+        {
+            if ( std::find(vectNodes.begin(), vectNodes.end(), nodeCurr) == vectNodes.end() )
+                vectNodes.push_back(nodeCurr);
+        }
+    }
+}
+
+//*
+//* End of Substructure::findNodes
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* Substructure::findKey
+//*     This function describes a Panel by its Nodes (Interior or Boundary
+//*     and the freedom of the Interior Nodes) and its Members (end Nodes
+//*     and global stiffness).  Panels with equal keys condense identically.
+//*
+//***************************************************************************
+
+void Substructure::findKey(std::vector<Member *> & members, std::vector<Node *> & vectNodes,
+                           std::vector<double> & vectNewKey)
+{
+    vectNewKey.clear();
+    vectNewKey.push_back( (double) vectNodes.size() );
+    for (Node * nodeCurr : vectNodes)
+    {
+        vectNewKey.push_back( nodeCurr->bCondensed ? 1.0 : 0.0 );
+        if (nodeCurr->bCondensed)
+        {
+            vectNewKey.push_back( (nodeCurr->iHorzFlag != 0) ? 1.0 : 0.0 );
+            vectNewKey.push_back( (nodeCurr->iVertFlag != 0) ? 1.0 : 0.0 );
+            vectNewKey.push_back( (nodeCurr->iRotFlag  != 0) ? 1.0 : 0.0 );
+        }
+    }
+
+    for (Member * memberCurr : members)
+    {
+        vectNewKey.push_back( (double) ( std::find(vectNodes.begin(), vectNodes.end(), memberCurr->nodeNeg) -
+                                         vectNodes.begin() ) );
+        vectNewKey.push_back( (double) ( std::find(vectNodes.begin(), vectNodes.end(), memberCurr->nodePos) -
+                                         vectNodes.begin() ) );
+
+        double adSSM_Global[6][6];
+        StiffnessMatrix::calcGlobalStiffness(memberCurr, adSSM_Global);
+        for (short int siIndex1 = 0; siIndex1 < 6; siIndex1++)
+        {
+            for (short int siIndex2 = 0; siIndex2 < 6; siIndex2++)
+                vectNewKey.push_back( adSSM_Global[siIndex1][siIndex2] );
+        }
+    }
+}
+
+//*
+//* End of Substructure::findKey
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* Substructure::create
+//*     This function condenses the given Panel and adds it as the first
+//*     Panel of the Substructure.
+//*
+//*     The Panel's stiffness is assembled densely with the Interior
+//*     equations first and 3 Boundary equations for each Boundary Node.
+//*     FIXED Boundary equations are condensed too, but are not used.  Kii
+//*     is decomposed in place (LDLt), then each Boundary column of Kib is
+//*     solved for the coupling and removed from Kbb.
+//*
+//*     A Panel whose Interior is not stable with its Boundary held is not
+//*     condensed.
+//*
+//***************************************************************************
+
+bool Substructure::create(std::vector<Member *> & members)
+{
+    this->clear();
+
+    std::vector<Node *> vectNodes;
+    Substructure::findNodes(members, vectNodes);
+    Substructure::findKey(members, vectNodes, this->vectKey);
+
+    // Number the Panel's equations (-1 = FIXED Interior)...
+    std::vector<int> vectLocal(vectNodes.size() * 3, -1);
+    for (std::size_t uiNode = 0; uiNode < vectNodes.size(); uiNode++)
+    {
+        Node * nodeCurr = vectNodes[uiNode];
+        if ( ! nodeCurr->bCondensed )
+            continue;
+        int aiFlag[3] = { nodeCurr->iHorzFlag, nodeCurr->iVertFlag, nodeCurr->iRotFlag };
+        for (short int siPart = 0; siPart < 3; siPart++)
+        {
+            if (aiFlag[siPart]) // ...element is FREE...
+                vectLocal[uiNode * 3 + siPart] = this->iInterior++;
+        }
+    }
+    for (std::size_t uiNode = 0; uiNode < vectNodes.size(); uiNode++)
+    {
+        if ( vectNodes[uiNode]->bCondensed )
+            continue;
+        for (short int siPart = 0; siPart < 3; siPart++)
+            vectLocal[uiNode * 3 + siPart] = this->iInterior + this->iBoundary++;
+    }
+
+    // Assemble the Panel stiffness...
+    int iSize = this->iInterior + this->iBoundary;
+    std::vector<double> vectStiffness( (std::size_t) iSize * iSize, 0.0 );
+    for (Member * memberCurr : members)
+    {
+        std::size_t uiNeg = std::find(vectNodes.begin(), vectNodes.end(), memberCurr->nodeNeg) - vectNodes.begin();
+        std::size_t uiPos = std::find(vectNodes.begin(), vectNodes.end(), memberCurr->nodePos) - vectNodes.begin();
+        int aiLocal[6] = { vectLocal[uiNeg * 3], vectLocal[uiNeg * 3 + 1], vectLocal[uiNeg * 3 + 2],
+                           vectLocal[uiPos * 3], vectLocal[uiPos * 3 + 1], vectLocal[uiPos * 3 + 2] };
+
+        double adSSM_Global[6][6];
+        StiffnessMatrix::calcGlobalStiffness(memberCurr, adSSM_Global);
+        for (short int siIndex1 = 0; siIndex1 < 6; siIndex1++)
+        {
+            if (aiLocal[siIndex1] < 0) // ...element is FIXED...
+                continue;
+            for (short int siIndex2 = 0; siIndex2 < 6; siIndex2++)
+            {
+                if (aiLocal[siIndex2] >= 0) // ...element is FREE...
+                    vectStiffness[ (std::size_t) aiLocal[siIndex1] * iSize + aiLocal[siIndex2] ] +=
+                            adSSM_Global[siIndex1][siIndex2];
+            }
+        }
+    }
+
+    // Decompose Kii (unit lower triangle below the pivots)...
+    this->vectFactor.assign( (std::size_t) this->iInterior * this->iInterior, 0.0 );
+    for (int iRow = 0; iRow < this->iInterior; iRow++)
+    {
+        for (int iCol = 0; iCol < this->iInterior; iCol++)
+            this->vectFactor[ (std::size_t) iRow * this->iInterior + iCol ] =
+                    vectStiffness[ (std::size_t) iRow * iSize + iCol ];
+    }
+    double * adFactor = this->vectFactor.data();
+    for (int iCol = 0; iCol < this->iInterior; iCol++)
+    {
+        double * adRowCol = adFactor + (std::size_t) iCol * this->iInterior;
+        for (int iK = 0; iK < iCol; iK++)
+            adRowCol[iCol] -= adRowCol[iK] * adRowCol[iK] * adFactor[ (std::size_t) iK * this->iInterior + iK ];
+        double dPivot = adRowCol[iCol];
+        if ( ! (dPivot > 0.0) )
+        {
+            std::cerr << "\n WARNING: Panel Interior is not stable with its Boundary held!\n"
+                      <<   "          The Panel is not condensed...\n";
+            this->clear();
+            return false;
+        }
+
+        for (int iRow = iCol + 1; iRow < this->iInterior; iRow++)
+        {
+            double * adRow = adFactor + (std::size_t) iRow * this->iInterior;
+            for (int iK = 0; iK < iCol; iK++)
+                adRow[iCol] -= adRow[iK] * adRowCol[iK] * adFactor[ (std::size_t) iK * this->iInterior + iK ];
+            adRow[iCol] /= dPivot;
+        }
+    }
+
+    // Solve the coupling of each Boundary equation...
+    this->vectCoupling.assign( (std::size_t) this->iBoundary * this->iInterior, 0.0 );
+    for (int iBound = 0; iBound < this->iBoundary; iBound++)
+    {
+        double * adCoupling = this->vectCoupling.data() + (std::size_t) iBound * this->iInterior;
+        for (int iRow = 0; iRow < this->iInterior; iRow++)
+            adCoupling[iRow] = vectStiffness[ (std::size_t) iRow * iSize + this->iInterior + iBound ];
+        this->solveInterior(adCoupling);
+    }
+
+    // Condense the Boundary stiffness: Kbb - Kbi ( Kii^-1 Kib )...
+    this->vectCondensed.assign( (std::size_t) this->iBoundary * this->iBoundary, 0.0 );
+    for (int iBound1 = 0; iBound1 < this->iBoundary; iBound1++)
+    {
+        const double * adStiffRow = vectStiffness.data() + (std::size_t) (this->iInterior + iBound1) * iSize;
+        for (int iBound2 = 0; iBound2 < this->iBoundary; iBound2++)
+        {
+            const double * adCoupling = this->vectCoupling.data() + (std::size_t) iBound2 * this->iInterior;
+            double dSum = adStiffRow[this->iInterior + iBound2];
+            for (int iRow = 0; iRow < this->iInterior; iRow++)
+                dSum -= adStiffRow[iRow] * adCoupling[iRow];
+            this->vectCondensed[ (std::size_t) iBound1 * this->iBoundary + iBound2 ] = dSum;
+        }
+    }
+
+    this->addPanel(members);
+
+    return true;
+}
+
+//*
+//* End of Substructure::create
+//***************************************************************************
+
+bool Substructure::matches(std::vector<Member *> & members)
+{
+    std::vector<Node *> vectNodes;
+    std::vector<double> vectNewKey;
+    Substructure::findNodes(members, vectNodes);
+    Substructure::findKey(members, vectNodes, vectNewKey);
+    return (vectNewKey == this->vectKey);
+}
+
+//***************************************************************************
+//*
+//* Substructure::addPanel
+//*     This function adds a Panel matching the Substructure and finds the
+//*     SSM indices of its equations in the Substructure's order.
+//*
+//***************************************************************************
+
+void Substructure::addPanel(std::vector<Member *> & members)
+{
+    std::vector<Node *> vectNodes;
+    Substructure::findNodes(members, vectNodes);
+
+    Panel panelNew;
+    panelNew.members = members;
+    for (Node * nodeCurr : vectNodes)
+    {
+        if ( ! nodeCurr->bCondensed )
+            continue;
+        for (int iFlag : { nodeCurr->iHorzFlag, nodeCurr->iVertFlag, nodeCurr->iRotFlag })
+        {
+            if (iFlag) // ...element is FREE...
+                panelNew.vectInterior.push_back(iFlag - 1);
+        }
+    }
+    for (Node * nodeCurr : vectNodes)
+    {
+        if (nodeCurr->bCondensed)
+            continue;
+        for (int iFlag : { nodeCurr->iHorzFlag, nodeCurr->iVertFlag, nodeCurr->iRotFlag })
+            panelNew.vectBoundary.push_back(iFlag - 1);
+    }
+
+    this->vectPanels.push_back(panelNew);
+}
+
+//*
+//* End of Substructure::addPanel
+//***************************************************************************
+
+int Substructure::getInterior(void)
+{
+    return this->iInterior;
+}
+
+int Substructure::getBoundary(void)
+{
+    return this->iBoundary;
+}
+
+const double * Substructure::getCondensed(void)
+{
+    return this->vectCondensed.data();
+}
+
+//***************************************************************************
+//*
+//* Substructure::solveInterior
+//*     This function solves the decomposed Kii for the given Interior
+//*     forces in place.
+//*
+//***************************************************************************
+
+void Substructure::solveInterior(double * adWork)
+{
+    const double * adFactor = this->vectFactor.data();
+    for (int iRow = 1; iRow < this->iInterior; iRow++)
+    {
+        const double * adRow = adFactor + (std::size_t) iRow * this->iInterior;
+        for (int iCol = 0; iCol < iRow; iCol++)
+            adWork[iRow] -= adRow[iCol] * adWork[iCol];
+    }
+    for (int iRow = 0; iRow < this->iInterior; iRow++)
+        adWork[iRow] /= adFactor[ (std::size_t) iRow * this->iInterior + iRow ];
+    for (int iRow = this->iInterior - 1; iRow > 0; iRow--)
+    {
+        const double * adRow = adFactor + (std::size_t) iRow * this->iInterior;
+        for (int iCol = 0; iCol < iRow; iCol++)
+            adWork[iCol] -= adRow[iCol] * adWork[iRow];
+    }
+}
+
+//*
+//* End of Substructure::solveInterior
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* Substructure::condenseForce
+//*     This function condenses each Panel's Interior forces onto its
+//*     Boundary forces in the given Force Matrix:
+//*         Fb = Fb - ( Kii^-1 Kib )t Fi
+//*     The Interior forces are kept for the recovery.
+//*
+//***************************************************************************
+
+void Substructure::condenseForce(double * adForce)
+{
+    for (Panel & panelCurr : this->vectPanels)
+    {
+        for (int iBound = 0; iBound < this->iBoundary; iBound++)
+        {
+            int iEquation = panelCurr.vectBoundary[iBound];
+            if (iEquation < 0) // ...element is FIXED...
+                continue;
+            const double * adCoupling = this->vectCoupling.data() + (std::size_t) iBound * this->iInterior;
+            for (int iRow = 0; iRow < this->iInterior; iRow++)
+                adForce[iEquation] -= adCoupling[iRow] * adForce[ panelCurr.vectInterior[iRow] ];
+        }
+    }
+}
+
+//*
+//* End of Substructure::condenseForce
+//***************************************************************************
+
+//***************************************************************************
+//*
+//* Substructure::recoverDisplacement
+//*     This function recovers each Panel's Interior displacements from its
+//*     solved Boundary displacements and its Interior forces:
+//*         Ui = Kii^-1 Fi - ( Kii^-1 Kib ) Ub
+//*
+//***************************************************************************
+
+void Substructure::recoverDisplacement(double * adDisplace, const double * adForce)
+{
+    std::vector<double> vectWork(this->iInterior);
+    for (Panel & panelCurr : this->vectPanels)
+    {
+        for (int iRow = 0; iRow < this->iInterior; iRow++)
+            vectWork[iRow] = adForce[ panelCurr.vectInterior[iRow] ];
+        this->solveInterior( vectWork.data() );
+
+        for (int iBound = 0; iBound < this->iBoundary; iBound++)
+        {
+            int iEquation = panelCurr.vectBoundary[iBound];
+            if (iEquation < 0) // ...element is FIXED...
+                continue;
+            const double * adCoupling = this->vectCoupling.data() + (std::size_t) iBound * this->iInterior;
+            for (int iRow = 0; iRow < this->iInterior; iRow++)
+                vectWork[iRow] -= adCoupling[iRow] * adDisplace[iEquation];
+        }
+
+        for (int iRow = 0; iRow < this->iInterior; iRow++)
+            adDisplace[ panelCurr.vectInterior[iRow] ] = vectWork[iRow];
+    }
+}
+
+//*
+//* End of Substructure::recoverDisplacement
+//***************************************************************************
@@ -0,0 +1,70 @@
+/*
+ * Substructure.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Keven L. Ates
+ */
+
+#ifndef SUBSTRUCTURE_HPP_
+#define SUBSTRUCTURE_HPP_
+
+#include "Member.hpp"
+#include "Node.hpp"
+
+#include <vector>
+
+// Substructure (Superelement) of repeated Panels...
+//
+//   A Panel is a group of Members whose Interior Nodes are not attached to
+//   any other Member or Reaction.  The Interior equations are statically
+//   condensed to the Panel's Boundary equations once for each distinct
+//   Panel:
+//
+//       Condensed = Kbb - Kbi Kii^-1 Kib
+//
+//   Every identical Panel (same Members, Member Properties, shape and
+//   freedom, in the same order) shares the Substructure, so a run of
+//   repeated Panels is condensed once.  The Interior displacements of each
+//   Panel are recovered after the Boundary displacements are solved:
+//
+//       Ui = Kii^-1 Fi - Kii^-1 Kib Ub
+
+class Substructure
+{
+public:
+    struct Panel
+    {
+        std::vector<Member *> members;  // Panel's Members
+        std::vector<int> vectInterior;  // SSM index (0 based) of each Interior equation
+        std::vector<int> vectBoundary;  // SSM index (0 based) of each Boundary equation (-1 = FIXED)
+    };
+
+    std::vector<Panel> vectPanels;      // Panels sharing the Substructure
+
+    Substructure(void);
+    ~Substructure(void);
+    void clear(void);
+
+    bool create(std::vector<Member *> &);
+    bool matches(std::vector<Member *> &);
+    void addPanel(std::vector<Member *> &);
+    int getInterior(void);
+    int getBoundary(void);
+    const double * getCondensed(void);
+    void condenseForce(double *);
+    void recoverDisplacement(double *, const double *);
+
+private:
+    int iInterior;                      // Interior equations
+    int iBoundary;                      // Boundary equations (3 per Boundary Node)
+    std::vector<double> vectKey;        // Panel description: Nodes, freedom and Member stiffness
+    std::vector<double> vectFactor;     // Kii decomposed (LDLt, dense)
+    std::vector<double> vectCoupling;   // Kii^-1 Kib (a column per Boundary equation)
+    std::vector<double> vectCondensed;  // Condensed Boundary stiffness (dense)
+
+    static void findNodes(std::vector<Member *> &, std::vector<Node *> &);
+    static void findKey(std::vector<Member *> &, std::vector<Node *> &, std::vector<double> &);
+    void solveInterior(double *);
+};
+
+#endif /* SUBSTRUCTURE_HPP_ */
@@ -28,11 +28,15 @@
 #include "PlaneFrame.hpp"
 
 #include <getopt.h>
+#include <climits>
+#include <cstdlib>
 #include <iostream>
 #include <iomanip>
 #include <fstream>
 #include <string>
 #include <ostream>
+#include <utility>
+#include <vector>
 
 
 void help(int iHelp)
@@ -42,7 +46,14 @@ void help(int iHelp)
         Report::reportPreambleDirect();
     }
     std::cout << std::string() +
-            "USAGE: caps [[-i|--input] <infile>] [[-o|--output] <outfile>] [-h|-?|--help]\n" +
+            "USAGE: caps [[-i|--input] <infile>] [[-o|--output] <outfile>] [-t|--threads <count>]\n" +
+            "            [-s|--solver <auto|skyline|sparse|pcg-jacobi|pcg-ic|mixed>]\n" +
+            "            [-k|--kernel <legacy|vector>] [-e|--tolerance <tol>]\n" +
+            "            [-c|--cache-dir <dir>] [-n|--no-cache]\n" +
+            "            [-p|--panel <length>] [-u|--update <member>:<property>]\n" +
+            "            [-r|--order <auto|rcm|sloan|gps|legacy>]\n" +
+            "            [-x|--extremes <sample|exact>] [-m|--combinations <file>]\n" +
+            "            [-l|--moving <file>] [-v|--envelope <add|only>] [-h|-?|--help]\n" +
             "\n" +
             "OPTIONS: Processed before all non-options\n" +
             "\n" +
@@ -60,6 +71,142 @@ void help(int iHelp)
             "                      The last output option overrides previous output options.\n" +
             "                      The last non-option is always treated as the output file.\n" +
             "\n" +
+            "  -t <count>        Threads - System Stiffness Matrix decomposition and\n" +
+            "  --threads <count>   Member force analysis threads.\n" +
+            "                      A count of 0 uses all hardware threads. Default: 1\n" +
+            "                      The results are identical for any thread count.\n" +
+            "                      Only the skyline solver decomposes with threads.\n" +
+            "\n" +
+            "  -s <solver>       Solver - System Stiffness Matrix solver:\n" +
+            "  --solver <solver>   auto    - skyline for small structures, sparse for large\n" +
+            "                      skyline - banded skyline (profile) decomposition\n" +
+            "                      sparse  - sparse supernodal Cholesky with nested\n" +
+            "                                dissection ordering\n" +
+            "                      pcg-jacobi - iterative preconditioned conjugate\n" +
+            "                                gradient with a Jacobi preconditioner\n" +
+            "                      pcg-ic  - iterative preconditioned conjugate gradient\n" +
+            "                                with an incomplete Cholesky IC(0) preconditioner\n" +
+            "                      mixed   - skyline decomposition in single precision,\n" +
+            "                                refined to double precision (falls back to\n" +
+            "                                double precision if refinement fails)\n" +
+            "                      Default: auto\n" +
+            "\n" +
+            "  -k <kernel>       Kernel - skyline decomposition and solution sums:\n" +
+            "  --kernel <kernel>   legacy  - each sum term by term in the PPSA order\n" +
+            "                      vector  - each sum in fixed vector lanes (AVX-512,\n" +
+            "                                AVX2 or Scalar, reported in Table 5)\n" +
+            "                      The vector sums are faster for large structures, but\n" +
+            "                      the round off differs from PPSA, so a tie between a\n" +
+            "                      Member's extremes may report a different value or\n" +
+            "                      location. Default: legacy\n" +
+            "\n" +
+            "  -e <tol>          Tolerance - residual of the pcg and mixed solvers.\n" +
+            "  --tolerance <tol>   The pcg residual |f - Kx| is scaled by |K| |x| + |f|,\n" +
+            "                      the mixed residual by |f|.  The iteration count and\n" +
+            "                      final residual of each solution are reported.  A pcg\n" +
+            "                      solution that does not converge stops the analysis.\n" +
+            "                      Default: 1.0E-12\n" +
+            "\n" +
+            "  -c <dir>          Cache directory - factored System Stiffness Matrices.\n" +
+            "  --cache-dir <dir>   Large structures using the skyline solver save their\n" +
+            "                      factor here.  Later runs of the same structure (any\n" +
+            "                      loads) use it instead of factoring again.  A changed\n" +
+            "                      structure or damaged file is factored again.  The\n" +
+            "                      file loaded or saved is reported in Table 5.\n" +
+            "                      The results are identical. Default: no cache\n" +
+            "\n" +
+            "  -n, --no-cache    No cache - always factor and save nothing.\n" +
+            "\n" +
+            "  -p <length>       Panel length - condense repeated panels along X.\n" +
+            "  --panel <length>    Members are grouped into panels of this length from\n" +
+            "                      the lowest node X by their midpoints.  The interior\n" +
+            "                      nodes of each panel (used by no other panel and no\n" +
+            "                      reaction) are condensed to its boundary nodes once\n" +
+            "                      for all identical panels, and recovered after the\n" +
+            "                      solution.  Only the skyline and mixed solvers\n" +
+            "                      condense panels. Default: no panels\n" +
+            "\n" +
+            "  -u <member>:<property>\n" +
+            "  --update <member>:<property>\n" +
+            "                    Update - resize a member to another member property.\n" +
+            "                      The structure is factored as read, then the factor\n" +
+            "                      is updated in place for each resized member (at most\n" +
+            "                      6 rank one changes each) instead of factoring again.\n" +
+            "                      The results agree with reading the resized member to\n" +
+            "                      round off.  Only the skyline and mixed solvers update\n" +
+            "                      in place; others (and condensed panels) factor again.\n" +
+            "                      The updates are reported in Table 5 and apply to\n" +
+            "                      every structure of the input. Default: no updates\n" +
+            "\n" +
+            "  -r <order>        Order - node ordering of the System Stiffness Matrix:\n" +
+            "  --order <order>     auto    - the least profile of rcm, sloan and gps\n" +
+            "                      rcm     - reverse Cuthill-McKee\n" +
+            "                      sloan   - Sloan profile reduction\n" +
+            "                      gps     - Gibbs-Poole-Stockmeyer\n" +
+            "                      legacy  - the PPSA ordering by node degree (slow\n" +
+            "                                for large structures)\n" +
+            "                      The bandwidth and profile before and after ordering\n" +
+            "                      are reported. An ordering other than legacy solves\n" +
+            "                      the same structure with a smaller profile, but the\n" +
+            "                      round off differs, so a tie between a Member's\n" +
+            "                      extremes may report a different value or location\n" +
+            "                      than prior results. Default: legacy\n" +
+            "\n" +
+            "  -x <mode>         Extremes - Member maximum Axial, Shear and Bending forces:\n" +
+            "  --extremes <mode>   sample  - the greatest at the Member divisions (the\n" +
+            "                                PPSA analysis)\n" +
+            "                      exact   - the greatest of each Member segment between\n" +
+            "                                load points, found at its ends and where\n" +
+            "                                the force's derivative is zero\n" +
+            "                      The divisions still apply to the deflections.\n" +
+            "                      Within a trapezoidal load, sample keeps the PPSA\n" +
+            "                      axial and shear (Start * Delta * U^3 / (2 L)) for\n" +
+            "                      comparison with PPSA, while exact uses the load up\n" +
+            "                      to the point (Start * U + Delta * U^2 / (2 L)), so\n" +
+            "                      they may differ there. Default: sample\n" +
+            "\n" +
+            "  -m <file>         Load Combinations - factored sums of the load cases.\n" +
+            "  --combinations <file>\n" +
+            "                      Each line of the file (after any '#' comment) is an\n" +
+            "                      optional label ending in ':' and then pairs of a\n" +
+            "                      factor and a load case number, for example:\n" +
+            "                          D+0.75(L+S): 1.0 1  0.75 2  0.75 3\n" +
+            "                      Only the load cases are solved.  Each combination\n" +
+            "                      follows them, its displacements superposed from\n" +
+            "                      their solutions and its loads factored from theirs,\n" +
+            "                      and uses its first load case's stress factor and\n" +
+            "                      interaction.  The combinations apply to every\n" +
+            "                      structure of the input. Default: no combinations\n" +
+            "\n" +
+            "  -l <file>         Moving Load - a train of concentrated loads stepped\n" +
+            "  --moving <file>     along a path of members.  Each line of the file\n" +
+            "                      (after any '#' comment) is one of:\n" +
+            "                          load <offset> <x load> <y load>\n" +
+            "                          path <member> [<member> ...]\n" +
+            "                          step <length>\n" +
+            "                      The offset is behind the lead load.  The path starts\n" +
+            "                      at the end of its first member away from the second,\n" +
+            "                      and each member must share a node with the one\n" +
+            "                      before.  The lead load steps from the path start\n" +
+            "                      until the last load leaves its end.  After the load\n" +
+            "                      cases, the positions are solved in batches against\n" +
+            "                      the structure's factor, and each member's greatest\n" +
+            "                      and least axial, shear, moment and deflection over\n" +
+            "                      them are reported with the governing lead load\n" +
+            "                      position.  The moving load applies to every\n" +
+            "                      structure of the input. Default: no moving load\n" +
+            "\n" +
+            "  -v <mode>         Load Case Envelope - each member's greatest moment and\n" +
+            "  --envelope <mode>   shear, maximum and minimum axial force, greatest\n" +
+            "                      stress index and greatest deflection over the load\n" +
+            "                      cases and combinations, each with its governing\n" +
+            "                      load case ('C' marks a combination).  It is updated\n" +
+            "                      as each load case is analyzed and is tabled after\n" +
+            "                      the load cases:\n" +
+            "                      add     - after the tables of each load case\n" +
+            "                      only    - instead of the tables of each load case\n" +
+            "                      Default: no envelope\n" +
+            "\n" +
             "  -h, -?            Print this help\n" +
             "  --help              Multiple help options expands the help with\n" +
             "                      additional information. Max: 3\n" +
@@ -186,6 +333,23 @@ int main(int iArgC, char * pacArgV[])
     int iHelp = 0;
     bool bOptContinue = true;
     bool bInFile = false;
+    short int siThreads = 1;
+    char cSolver = PlaneFrame::cSolverAuto;
+    std::string strSolver;
+    char cKernel = StiffnessMatrix::cKernelLegacy;
+    std::string strKernel;
+    double dTolerance = 1.0E-12;
+    std::string strCacheDir;
+    double dPanelLength = 0.0;
+    std::vector< std::pair<int, int> > vectUpdates;
+    char cOrder = PlaneFrame::cOrderLegacy;
+    std::string strOrder;
+    char cExtreme = PlaneFrame::cExtremeSample;
+    std::string strExtreme;
+    std::string strCombineFile;
+    std::string strMovingFile;
+    std::string strEnvelope;
+    char cEnvelope = Report::cEnvelopeNone;
     int iRetVal = 0;
 
     //
@@ -195,13 +359,26 @@ int main(int iArgC, char * pacArgV[])
     while (bOptContinue)
     {
         int iOptIndex = 0;
-        char strOpts[] = "i:o:h?";
+        char strOpts[] = "i:o:t:s:k:e:c:np:u:r:x:m:l:v:h?";
         static struct option optsLong[] =
         {
-            { "input",  required_argument, 0, 'i' },
-            { "output", required_argument, 0, 'o' },
-            { "help",   no_argument,       0, 'h' },
-            { 0,        0,                 0, 0 }
+            { "input",   required_argument, 0, 'i' },
+            { "output",  required_argument, 0, 'o' },
+            { "help",    no_argument,       0, 'h' },
+            { "threads", required_argument, 0, 't' },
+            { "solver",  required_argument, 0, 's' },
+            { "kernel",  required_argument, 0, 'k' },
+            { "tolerance", required_argument, 0, 'e' },
+            { "cache-dir", required_argument, 0, 'c' },
+            { "no-cache", no_argument,     0, 'n' },
+            { "panel",   required_argument, 0, 'p' },
+            { "update",  required_argument, 0, 'u' },
+            { "order",   required_argument, 0, 'r' },
+            { "extremes", required_argument, 0, 'x' },
+            { "combinations", required_argument, 0, 'm' },
+            { "moving",  required_argument, 0, 'l' },
+            { "envelope", required_argument, 0, 'v' },
+            { 0,         0,                 0, 0 }
         };
 
         cOption = getopt_long(iArgC, pacArgV, strOpts, optsLong, &iOptIndex);
@@ -238,6 +415,184 @@ int main(int iArgC, char * pacArgV[])
                     strOutFile = optarg;
                     break;
 
+                case 't': // threads
+                {
+                    // The whole argument must be the count, and it must fit its short int...
+                    char * pcEnd = nullptr;
+                    long int liThreads = std::strtol(optarg, &pcEnd, 10);
+                    if ( pcEnd == optarg || *pcEnd != '\0' || liThreads < 0 || liThreads > SHRT_MAX )
+                    {
+                        std::cerr << "\n ERROR: Thread count must be a whole number from 0 to " << SHRT_MAX << "!\n";
+                        bHelp = true;
+                        bOptContinue = false;
+                        iRetVal = 1;
+                    }
+                    else
+                        siThreads = (short int) liThreads;
+                    break;
+                }
+
+                case 's': // solver
+                    strSolver = optarg;
+                    if (strSolver == "auto")
+                        cSolver = PlaneFrame::cSolverAuto;
+                    else if (strSolver == "skyline")
+                        cSolver = StiffnessMatrix::cSolverSkyline;
+                    else if (strSolver == "sparse")
+                        cSolver = StiffnessMatrix::cSolverSparse;
+                    else if (strSolver == "pcg-jacobi")
+                        cSolver = StiffnessMatrix::cSolverPCGJacobi;
+                    else if (strSolver == "pcg-ic")
+                        cSolver = StiffnessMatrix::cSolverPCGIC;
+                    else if (strSolver == "mixed")
+                        cSolver = StiffnessMatrix::cSolverMixed;
+                    else
+                    {
+                        std::cerr << "\n ERROR: Solver must be auto, skyline, sparse, pcg-jacobi, pcg-ic or mixed!\n";
+                        bHelp = true;
+                        bOptContinue = false;
+                        iRetVal = 1;
+                    }
+                    break;
+
+                case 'k': // kernel
+                    strKernel = optarg;
+                    if (strKernel == "legacy")
+                        cKernel = StiffnessMatrix::cKernelLegacy;
+                    else if (strKernel == "vector")
+                        cKernel = StiffnessMatrix::cKernelVector;
+                    else
+                    {
+                        std::cerr << "\n ERROR: Kernel must be legacy or vector!\n";
+                        bHelp = true;
+                        bOptContinue = false;
+                        iRetVal = 1;
+                    }
+                    break;
+
+                case 'e': // tolerance
+                    dTolerance = std::atof(optarg);
+                    if ( ! (dTolerance > 0.0 && dTolerance < 1.0) )
+                    {
+                        std::cerr << "\n ERROR: Tolerance must be more than 0 and less than 1!\n";
+                        bHelp = true;
+                        bOptContinue = false;
+                        iRetVal = 1;
+                    }
+                    break;
+
+                case 'c': // cache directory
+                    strCacheDir = optarg;
+                    if ( strCacheDir.empty() )
+                    {
+                        std::cerr << "\n ERROR: Cache directory must not be empty!\n";
+                        bHelp = true;
+                        bOptContinue = false;
+                        iRetVal = 1;
+                    }
+                    break;
+
+                case 'n': // no cache
+                    strCacheDir.clear();
+                    break;
+
+                case 'p': // panel length
+                    dPanelLength = std::atof(optarg);
+                    if ( ! (dPanelLength > 0.0) )
+                    {
+                        std::cerr << "\n ERROR: Panel length must be more than 0!\n";
+                        bHelp = true;
+                        bOptContinue = false;
+                        iRetVal = 1;
+                    }
+                    break;
+
+                case 'u': // member update
+                {
+                    // The argument must be a member and a member property, both positive...
+                    char * pcEnd = nullptr;
+                    long int liMember = std::strtol(optarg, &pcEnd, 10);
+                    long int liMatProp = 0;
+                    bool bUpdate = ( pcEnd != optarg && *pcEnd == ':' );
+                    if (bUpdate)
+                    {
+                        char * pcMatProp = pcEnd + 1;
+                        liMatProp = std::strtol(pcMatProp, &pcEnd, 10);
+                        bUpdate = ( pcEnd != pcMatProp && *pcEnd == '\0' &&
+                                    liMember > 0 && liMember <= INT_MAX &&
+                                    liMatProp > 0 && liMatProp <= INT_MAX );
+                    }
+                    if ( ! bUpdate )
+                    {
+                        std::cerr << "\n ERROR: Update must be a member and a member property, for example 7:2!\n";
+                        bHelp = true;
+                        bOptContinue = false;
+                        iRetVal = 1;
+                    }
+                    else
+                        vectUpdates.emplace_back( (int) liMember, (int) liMatProp );
+                    break;
+                }
+
+                case 'r': // node ordering
+                    strOrder = optarg;
+                    if (strOrder == "auto")
+                        cOrder = PlaneFrame::cOrderAuto;
+                    else if (strOrder == "rcm")
+                        cOrder = NodeGraph::cOrderRCM;
+                    else if (strOrder == "sloan")
+                        cOrder = NodeGraph::cOrderSloan;
+                    else if (strOrder == "gps")
+                        cOrder = NodeGraph::cOrderGPS;
+                    else if (strOrder == "legacy")
+                        cOrder = PlaneFrame::cOrderLegacy;
+                    else
+                    {
+                        std::cerr << "\n ERROR: Order must be auto, rcm, sloan, gps or legacy!\n";
+                        bHelp = true;
+                        bOptContinue = false;
+                        iRetVal = 1;
+                    }
+                    break;
+
+                case 'x': // member extremes
+                    strExtreme = optarg;
+                    if (strExtreme == "sample")
+                        cExtreme = PlaneFrame::cExtremeSample;
+                    else if (strExtreme == "exact")
+                        cExtreme = PlaneFrame::cExtremeExact;
+                    else
+                    {
+                        std::cerr << "\n ERROR: Extremes must be sample or exact!\n";
+                        bHelp = true;
+                        bOptContinue = false;
+                        iRetVal = 1;
+                    }
+                    break;
+
+                case 'm': // load combinations
+                    strCombineFile = optarg;
+                    break;
+
+                case 'l': // moving load
+                    strMovingFile = optarg;
+                    break;
+
+                case 'v': // load case envelope
+                    strEnvelope = optarg;
+                    if (strEnvelope == "add")
+                        cEnvelope = Report::cEnvelopeAdd;
+                    else if (strEnvelope == "only")
+                        cEnvelope = Report::cEnvelopeOnly;
+                    else
+                    {
+                        std::cerr << "\n ERROR: Envelope must be add or only!\n";
+                        bHelp = true;
+                        bOptContinue = false;
+                        iRetVal = 1;
+                    }
+                    break;
+
                 case 'h': // help
                 case '?': // help
                     bHelp = true;
@@ -310,9 +665,48 @@ int main(int iArgC, char * pacArgV[])
         return iRetVal;
     }
 
+    //
+    //  Read the Load Combinations...
+    //
+
+    std::vector<LoadCombination *> vectCombos;
+    if ( ! strCombineFile.empty() && ! LoadCombination::readFile(strCombineFile, vectCombos) )
+    {
+        iRetVal = 1;
+        for (LoadCombination * comboCurr : vectCombos)
+            delete comboCurr;
+        pinPPSA->close();
+        pOutCAPS->close();
+        return iRetVal;
+    }
+
+    //
+    //  Read the Moving Load...
+    //
+
+    LoadMoving lmove;
+    if ( ! strMovingFile.empty() && ! lmove.readFile(strMovingFile) )
+    {
+        iRetVal = 1;
+        for (LoadCombination * comboCurr : vectCombos)
+            delete comboCurr;
+        pinPPSA->close();
+        pOutCAPS->close();
+        return iRetVal;
+    }
+
     // Setup Plane Frame and its reporting...
     PlaneFrame pframe;
+    pframe.ssm.setThreads(siThreads);
+    pframe.setSolverOption(cSolver);
+    pframe.ssm.setKernel(cKernel);
+    pframe.ssm.setTolerance(dTolerance);
+    pframe.ssm.setCacheDirectory(strCacheDir);
+    pframe.setPanelLength(dPanelLength);
+    pframe.setOrderOption(cOrder);
+    pframe.setExtremeOption(cExtreme);
     pOutCAPS->setPlaneFrame( &pframe );
+    pOutCAPS->setEnvelopeOption(cEnvelope);
 
     //
     //  Print the CAPS Introduction heading...
@@ -354,53 +748,134 @@ int main(int iArgC, char * pacArgV[])
             break;
         }
 
+        // Resize the updated Members in the factored structure...
+        bool bUpdated = true;
+        for (std::pair<int, int> & pairUpdate : vectUpdates)
+        {
+            bUpdated = pframe.updateMember(pairUpdate.first, pairUpdate.second);
+            if ( ! bUpdated )
+                break;
+        }
+        if ( ! bUpdated )
+        {
+            iRetVal = 1;
+            bContinue = false;
+            break;
+        }
+
         // Report the Plane Frame structure (Tables 1 - 5)...
         pOutCAPS->reportStructure();
 
         //
-        // Set up loop for multiple loading conditions...
+        // Read and load all of the loading conditions, then solve them
+        // together as one batch of Force Matrices...
         //********************************************************************************
 
+        short int siLoadCasesRead = 0;
         for (short int siLoadCase = 1; siLoadCase <= pframe.ps.siLoads; siLoadCase++)
         {
             // Clear the loads and related load analysis info on the Plane Frame...
             pframe.clearLoads();
 
-            pOutCAPS->setLoadCase(siLoadCase);
-            pOutCAPS->reportLoadCaseReading();
-
             // Read CAPS structure loading (Sections 8 - 12) from file...
             if ( pinPPSA->getLoadCase(pframe) == false )
-            {
-                bContinue = false;
                 break;
+
+            // Process the structure loading for External Forces and apply
+            // the loading to the members to set up the Force Matrix...
+            //   NOTE: A failed case is kept to be reported, but stops the batch
+            bool bLoaded = ( pframe.processLoads() && pframe.loadMembers() );
+            if ( ! bLoaded )
+                pframe.clearLoadAnalysis();
+
+            if ( ! pframe.storeLoadCase(pinPPSA->isWarningForTPIConcLoad(), pinPPSA->isWarningForTPITrapLoad()) )
+                break;
+            siLoadCasesRead++;
+
+            if ( ! bLoaded )
+                break;
+        }
+
+        // Calculate the System Displacement Matrices of the loaded cases...
+        if ( ! pframe.solveLoadCases() )
+        {
+            siLoadCasesRead = 0;
+            iRetVal = 1;
+        }
+
+        // Add the Load Combinations of the solved cases...
+        short int siLoadCases = pframe.ps.siLoads;
+        if ( ! vectCombos.empty() )
+        {
+            if ( siLoadCasesRead != pframe.ps.siLoads )
+            {
+                std::cerr << "\n ERROR: Load Combinations not analyzed!\n"
+                          <<   "        Every Load Case must be loaded and solved.\n";
+            }
+            else if ( pframe.storeLoadCombinations(vectCombos) )
+            {
+                siLoadCases += (short int) vectCombos.size();
+                siLoadCasesRead = siLoadCases;
             }
+        }
 
-            // Report structure Loading Case (Table 5)...
-            pOutCAPS->reportLoadCase(pinPPSA->isWarningForTPIConcLoad(), pinPPSA->isWarningForTPITrapLoad() );
+        //
+        // Set up loop for multiple loading conditions...
+        //********************************************************************************
 
-            pOutCAPS->reportLoadCaseProcessing();
+        for (short int siLoadCase = 1; siLoadCase <= siLoadCases; siLoadCase++)
+        {
+            pOutCAPS->setLoadCase(siLoadCase);
+            pOutCAPS->reportLoadCaseReading();
 
-            // Process the structure loading for External Forces...
-            if ( ! pframe.processLoads() )
+            // The load case could not be read...
+            if (siLoadCase > siLoadCasesRead)
             {
                 bContinue = false;
                 break;
             }
 
-            pOutCAPS->reportLoadCaseLoading();
+            // Restore the read ahead CAPS structure loading on the Plane Frame...
+            pframe.restoreLoadCase(siLoadCase);
+            LoadCase * lcCurr = pframe.lc[siLoadCase - 1];
 
-            // Apply the loading to the members and setup Internal Forces...
-            if ( ! pframe.loadMembers() )
+            // Report structure Loading Case (Table 5)...
+            pOutCAPS->reportLoadCase(lcCurr->bWarnTPIConcLoad, lcCurr->bWarnTPITrapLoad);
+
+            // The load case could not be loaded...
+            if ( ! lcCurr->bLoaded )
             {
                 bContinue = false;
                 break;
             }
 
+            // A basic load case was processed and loaded when it was read:
+            //   restoreLoadCase() restored its processed loading...
+            if ( ! lcCurr->bProcessed )
+            {
+                pOutCAPS->reportLoadCaseProcessing();
+
+                // Process the structure loading for External Forces...
+                if ( ! pframe.processLoads() )
+                {
+                    bContinue = false;
+                    break;
+                }
+
+                pOutCAPS->reportLoadCaseLoading();
+
+                // Apply the loading to the members and setup Internal Forces...
+                if ( ! pframe.loadMembers() )
+                {
+                    bContinue = false;
+                    break;
+                }
+            }
+
             pOutCAPS->reportCalcDisplacementMatrix();
 
-            // Calculate the System Displacement Matrix...
-            if ( ! pframe.createDisplacementMatrix() )
+            // Set up the System Displacement Matrix from the batch...
+            if ( ! pframe.createDisplacementMatrix(siLoadCase) )
             {
                 bContinue = false;
                 break;
@@ -437,11 +912,45 @@ int main(int iArgC, char * pacArgV[])
 
             pOutCAPS->reportResults();
 
+            // Update the Members' Load Case envelope...
+            pframe.envelopeLoadCase(siLoadCase);
+
             pOutCAPS->reportLoadCaseNext();
 
             // Perform another loading condition on the matrix if possible...
         }
 
+        //
+        // Report the Load Case envelope...
+        //********************************************************************************
+
+        if ( bContinue && cEnvelope != Report::cEnvelopeNone )
+        {
+            pOutCAPS->reportLoadCaseEnvelope(siLoadCases);
+
+            pOutCAPS->reportLoadCaseNext();
+        }
+
+        //
+        // Solve the Moving Load positions together and report the envelopes...
+        //********************************************************************************
+
+        if ( bContinue && lmove.isSet() )
+        {
+            pOutCAPS->reportMovingLoadSolving();
+
+            if ( ! pframe.solveMovingLoad(lmove) )
+            {
+                iRetVal = 1;
+                bContinue = false;
+                break;
+            }
+
+            pOutCAPS->reportMovingLoad(lmove);
+
+            pOutCAPS->reportLoadCaseNext();
+        }
+
         // Clear the Plane Frame information...
         pframe.clear();
 
@@ -461,7 +970,10 @@ int main(int iArgC, char * pacArgV[])
     pinPPSA->close();  // Not Req: destructor closes
     pOutCAPS->close(); // Not Req: destructor closes
 
-    return 0;
+    for (LoadCombination * comboCurr : vectCombos)
+        delete comboCurr;
+
+    return iRetVal;
 }
 
 //***************